@@ -77,6 +77,7 @@ struct edge
  * @details The testing function
  * @b Testing @b Command @n
  * make test @n
+ * When built with "make STATS=1" the heap and UnionFind operation counters are printed on stderr.
  */
 int main(int argc , char* argv[])
 {
@@ -132,5 +133,8 @@ int main(int argc , char* argv[])
 		delete tempEdge;
 	}
 	cout << maxSpacing << endl;
+#ifdef ALGOPP_STATS
+	cerr << defaultStatsPolicy::snapshot();
+#endif
 	return 0;
 }
@@ -0,0 +1,765 @@
+/**
+ *  @file GraphAnalytics/src/main.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the testing scenarios for the graph analytics: ranking, structure and communities. All the data
+ *  structures present in the file are in a namespace called GraphAnalytics.
+ */
+#include <graph.hpp>
+#include <GraphCSR.hpp>
+#include <GraphPageRank.hpp>
+#include <GraphTriangles.hpp>
+#include <GraphCores.hpp>
+#include <GraphCommunities.hpp>
+#include <GraphPartition.hpp>
+#include <GraphBetweenness.hpp>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+/**
+ * @brief GraphAnalytics to wrap the object model specific to this testing suite.
+ */
+namespace GraphAnalytics
+{
+/**
+ * @brief Vertex OM for the graph
+ * @details This class has a single member to signify the ID of the graph vertex
+ */
+struct node
+{
+	size_t m_id;	///< Member to store the ID of the graph node
+
+	///@brief Default constructor for initializing class members
+	node():m_id(0){};
+
+	///@brief Single argument constructor to initialize class member m_id
+	node(size_t id):m_id(id){};
+};
+
+/**
+ * @brief Edge OM for the graph
+ * @details This class has a weight member to signify the capacity or strength of the edge.
+ */
+struct edge
+{
+	int m_weight;		///< Weight of the edge.
+
+	///@brief Default constructor for initializing class members
+	edge():m_weight(0){};
+
+	///@brief Single argument constructor to initialize class members
+	edge(int weight):m_weight(weight){};
+};
+
+///@brief Linear congruential generator, so that the random scenarios give the same output everywhere
+struct lcg
+{
+	unsigned long long m_state;	///< Member to hold the state of the generator
+	///@brief Single argument constructor
+	explicit lcg(unsigned long long seed) : m_state(seed){}
+	///@brief Member function to get a number in 0..n-1
+	size_t operator() (size_t n)
+	{
+		m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+		return size_t(m_state >> 33) % n;
+	}
+};
+
+typedef graph<node*, edge*, graphTraits::directed> directedGraph;	///< Directed graph of the scenarios
+typedef graph<node*, edge*, graphTraits::bidirectional> undirectedGraph;	///< Undirected graph of the scenarios
+typedef graphPageRank<> pageRank;	///< PageRank in double precision
+typedef graphTriangles<> triangles;	///< Triangle counting
+typedef graphCores<> cores;	///< k-core decomposition
+typedef graphCommunities<> communities;	///< Community detection with double weights
+typedef graphPartition<> partition;	///< Multilevel k-way partitioning
+typedef graphBetweenness<> betweenness;	///< Betweenness centrality with int weights
+
+///@brief Function to build a directed graph on a small scripted set of edges, in which vertex 5 is dangling
+void buildScripted(directedGraph& g, std::vector<directedGraph::vertexDescriptor>& v)
+{
+	const int edges[][2] = {{0,1}, {0,2}, {1,2}, {2,0}, {3,2}, {4,3}, {4,5}, {3,4}, {1,5}};
+	for (size_t i = 0; i < 6; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) g.addEdge(v[edges[i][0]], v[edges[i][1]], new edge(1));
+}
+
+///@brief Function to build a random directed graph with n vertices and m edges
+csrGraph buildRandom(size_t n, size_t m, unsigned long long seed)
+{
+	lcg rng(seed);
+	directedGraph g;
+	std::vector<directedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[rng(n)], new edge(1));
+	return csrGraph(g);
+}
+
+///@brief Function to build a random directed graph with n vertices and m edges, all but about one in ten going to a higher vertex id
+csrGraph buildForward(size_t n, size_t m, unsigned long long seed)
+{
+	lcg rng(seed);
+	directedGraph g;
+	std::vector<directedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++)
+	{
+		size_t from = rng(n);
+		size_t to = rng(n);
+		if (0 != rng(10) && from > to) std::swap(from, to);
+		g.addEdge(v[from], v[to], new edge(1));
+	}
+	return csrGraph(g);
+}
+
+/**
+ * @brief Function to build a random undirected graph with n vertices and m edges, of which every third goes to a vertex below
+ * hubs, so that the degrees are skewed, with some loops and parallel edges among them
+ */
+csrGraph buildRandomUndirected(size_t n, size_t m, size_t hubs, unsigned long long seed)
+{
+	lcg rng(seed);
+	undirectedGraph g;
+	std::vector<undirectedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[(0 == i % 3) ? rng(hubs) : rng(n)], new edge(1));
+	return csrGraph(g);
+}
+
+///@brief Function to count the triangles of every vertex of an undirected graph by checking all the triples, as the reference
+std::vector<size_t> trianglesReference(const csrGraph& g)
+{
+	size_t n = g.numVertices();
+	std::vector<std::vector<bool> > adjacent(n, std::vector<bool>(n, false));
+	for (csrGraph::vertexId u = 0; u < n; u++)
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++) adjacent[u][g.targets[slot]] = (u != g.targets[slot]);
+	std::vector<size_t> retVal(n, 0);
+	for (size_t u = 0; u < n; u++)
+		for (size_t v = u + 1; v < n; v++)
+			if (true == adjacent[u][v])
+				for (size_t w = v + 1; w < n; w++)
+					if (true == adjacent[u][w] && true == adjacent[v][w])
+					{
+						retVal[u]++;
+						retVal[v]++;
+						retVal[w]++;
+					}
+	return retVal;
+}
+
+///@brief Function to get the core numbers by removing a vertex of least degree at a time, as the reference
+std::vector<size_t> coresReference(const csrGraph& g)
+{
+	size_t n = g.numVertices(), k = 0;
+	std::vector<std::vector<bool> > adjacent(n, std::vector<bool>(n, false));
+	for (csrGraph::vertexId u = 0; u < n; u++)
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++) adjacent[u][g.targets[slot]] = (u != g.targets[slot]);
+	std::vector<size_t> degree(n, 0), retVal(n, 0);
+	std::vector<bool> removed(n, false);
+	for (size_t u = 0; u < n; u++)
+		for (size_t v = 0; v < n; v++) degree[u] += adjacent[u][v];
+	for (size_t step = 0; step < n; step++)
+	{
+		size_t best = n;
+		for (size_t v = 0; v < n; v++) if (false == removed[v] && (n == best || degree[v] < degree[best])) best = v;
+		k = std::max(k, degree[best]);
+		retVal[best] = k;
+		removed[best] = true;
+		for (size_t v = 0; v < n; v++) if (true == adjacent[best][v]) degree[v]--;
+	}
+	return retVal;
+}
+
+///@brief Function to build the karate club network of Zachary, 34 members and 78 friendships
+csrGraph buildKarate()
+{
+	const int edges[][2] = {{0,1}, {0,2}, {0,3}, {0,4}, {0,5}, {0,6}, {0,7}, {0,8}, {0,10}, {0,11}, {0,12}, {0,13}, {0,17}, {0,19},
+		{0,21}, {0,31}, {1,2}, {1,3}, {1,7}, {1,13}, {1,17}, {1,19}, {1,21}, {1,30}, {2,3}, {2,7}, {2,8}, {2,9}, {2,13}, {2,27}, {2,28},
+		{2,32}, {3,7}, {3,12}, {3,13}, {4,6}, {4,10}, {5,6}, {5,10}, {5,16}, {6,16}, {8,30}, {8,32}, {8,33}, {9,33}, {13,33}, {14,32},
+		{14,33}, {15,32}, {15,33}, {18,32}, {18,33}, {19,33}, {20,32}, {20,33}, {22,32}, {22,33}, {23,25}, {23,27}, {23,29}, {23,32},
+		{23,33}, {24,25}, {24,27}, {24,31}, {25,31}, {26,29}, {26,33}, {27,33}, {28,31}, {28,33}, {29,32}, {29,33}, {30,32}, {30,33},
+		{31,32}, {31,33}, {32,33}};
+	undirectedGraph g;
+	std::vector<undirectedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < 34; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) g.addEdge(v[edges[i][0]], v[edges[i][1]], new edge(1));
+	return csrGraph(g);
+}
+
+/**
+ * @brief Function to build a random undirected graph of groups of the given size, where an edge stays inside a group with
+ * probability inside percent and weighs 1..maxWeight
+ */
+void buildPlanted(undirectedGraph& g, size_t groups, size_t size, size_t m, size_t inside, int maxWeight, unsigned long long seed)
+{
+	lcg rng(seed);
+	std::vector<undirectedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < groups * size; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++)
+	{
+		size_t a = rng(groups * size), b = (rng(100) < inside) ? (a / size) * size + rng(size) : rng(groups * size);
+		g.addEdge(v[a], v[b], new edge(1 + int(rng(size_t(maxWeight)))));
+	}
+}
+
+///@brief Function to count the vertices which are not in the community most of their planted group of the given size is in
+size_t misplaced(const communities::communityMap& membership, size_t size)
+{
+	size_t retVal = 0;
+	for (size_t first = 0; first < membership.size(); first += size)
+	{
+		std::vector<size_t> votes(membership.size(), 0);
+		size_t most = 0;
+		for (size_t i = first; i < first + size; i++) most = std::max(most, ++votes[membership[i]]);
+		retVal += size - most;
+	}
+	return retVal;
+}
+
+///@brief Function to count the communities whose members are not connected by edges inside the community
+size_t disconnected(const csrGraph& g, const communities::communityMap& membership, size_t count)
+{
+	std::vector<bool> reached(g.numVertices(), false), started(count, false);
+	size_t retVal = 0;
+	for (csrGraph::vertexId root = 0; root < g.numVertices(); root++)
+	{
+		if (true == reached[root]) continue;
+		retVal += started[membership[root]];
+		started[membership[root]] = true;
+		std::vector<csrGraph::vertexId> stack(1, root);
+		reached[root] = true;
+		while (false == stack.empty())
+		{
+			csrGraph::vertexId u = stack.back();
+			stack.pop_back();
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				csrGraph::vertexId w = g.targets[slot];
+				if (false == reached[w] && membership[w] == membership[u])
+				{
+					reached[w] = true;
+					stack.push_back(w);
+				}
+			}
+		}
+	}
+	return retVal;
+}
+
+///@brief Function to check that two hierarchies are the same
+bool sameHierarchy(const communities::hierarchy& a, const communities::hierarchy& b)
+{
+	if (a.size() != b.size()) return false;
+	for (size_t l = 0; l < a.size(); l++)
+	{
+		if (a[l].communities != b[l].communities || a[l].modularity != b[l].modularity) return false;
+		for (size_t i = 0; i < a[l].membership.size(); i++)
+			if (a[l].membership[i] != b[l].membership[i]) return false;
+	}
+	return true;
+}
+
+///@brief Function to build a side x side grid with unit edges
+csrGraph buildGrid(size_t side)
+{
+	undirectedGraph g;
+	std::vector<undirectedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < side * side; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < side * side; i++)
+	{
+		if (i % side + 1 < side) g.addEdge(v[i], v[i+1], new edge(1));
+		if (i + side < side * side) g.addEdge(v[i], v[i+side], new edge(1));
+	}
+	return csrGraph(g);
+}
+
+/**
+ * @brief Function to check the saved subgraphs of all the parts against the partition
+ * @details Every vertex must be in the subgraph of its part exactly once, every slot of the graph but the loops must be an edge of
+ * a subgraph or an edge leaving it, and the edges leaving the parts must weigh twice the cut. A truncated save and one with a bad magic number
+ * must not load.
+ * @return The number of violations
+ */
+size_t shardViolations(const partition& p, const csrGraph& g, const partition::partitionMap& part, size_t k)
+{
+	size_t retVal = 0, slots = 0;
+	long long leaving = 0;
+	std::vector<size_t> seen(g.numVertices(), 0);
+	for (size_t which = 0; which < k; which++)
+	{
+		std::stringstream saved;
+		retVal += (false == p.savePart(saved, part, k, which));
+		std::string bytes = saved.str();
+		partition::shard s;
+		retVal += (false == partition::loadPart(saved, s)) + (s.part != which) + (s.parts != k);
+		for (size_t i = 0; i < s.ids.size(); i++)
+		{
+			retVal += (part[s.ids[i]] != which);
+			seen[s.ids[i]]++;
+			for (size_t slot = g.offsets[s.ids[i]]; slot < g.offsets[s.ids[i]+1]; slot++) slots += (g.targets[slot] != s.ids[i]);
+		}
+		slots -= s.g.numSlots() + s.cutSources.size();
+		for (size_t i = 0; i < s.cutSources.size(); i++)
+		{
+			retVal += (part[s.cutTargets[i]] == which);
+			leaving += s.cutWeights[i];
+		}
+		std::stringstream truncated(bytes.substr(0, bytes.size() - 1)), badMagic("X" + bytes.substr(1));
+		retVal += partition::loadPart(truncated, s) + partition::loadPart(badMagic, s) + (0 != s.ids.size());
+	}
+	for (size_t v = 0; v < seen.size(); v++) retVal += (1 != seen[v]);
+	return retVal + (0 != slots) + (leaving != 2 * p.edgeCut(part));
+}
+
+///@brief Function to build a random directed graph with n vertices and m edges of weights 1..maxWeight, with loops and parallel edges
+void buildRandomWeighted(directedGraph& g, size_t n, size_t m, int maxWeight, unsigned long long seed)
+{
+	lcg rng(seed);
+	std::vector<directedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[rng(n)], new edge(1 + int(rng(maxWeight))));
+}
+
+/**
+ * @brief Function to get the betweenness from the distances and path counts of all the pairs, as the reference
+ * @details The distances come from Floyd-Warshall and the number of shortest paths from s to t from the arcs into t on them,
+ * taking the vertices by distance from s. v is on sigma(s,v) sigma(v,t) of the sigma(s,t) shortest paths from s to t when the
+ * distances add up.
+ */
+std::vector<double> betweennessReference(const csrGraph& g, const std::vector<long long>& length)
+{
+	size_t n = g.numVertices();
+	const long long none = std::numeric_limits<long long>::max() / 4;
+	std::vector<std::vector<long long> > dist(n, std::vector<long long>(n, none));
+	std::vector<std::vector<double> > sigma(n, std::vector<double>(n, 0));
+	for (csrGraph::vertexId u = 0; u < n; u++)
+	{
+		dist[u][u] = 0;
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			if (g.targets[slot] != u) dist[u][g.targets[slot]] = std::min(dist[u][g.targets[slot]], length[slot]);
+	}
+	for (size_t k = 0; k < n; k++)
+		for (size_t s = 0; s < n; s++)
+			for (size_t t = 0; t < n; t++) dist[s][t] = std::min(dist[s][t], dist[s][k] + dist[k][t]);
+	for (size_t s = 0; s < n; s++)
+	{
+		std::vector<std::pair<long long,csrGraph::vertexId> > byDistance;
+		for (csrGraph::vertexId u = 0; u < n; u++) if (dist[s][u] < none) byDistance.push_back(std::make_pair(dist[s][u], u));
+		std::sort(byDistance.begin(), byDistance.end());
+		sigma[s][s] = 1;
+		for (size_t i = 0; i < byDistance.size(); i++)
+		{
+			csrGraph::vertexId u = byDistance[i].second;
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				csrGraph::vertexId w = g.targets[slot];
+				if (w != u && dist[s][u] + length[slot] == dist[s][w]) sigma[s][w] += sigma[s][u];
+			}
+		}
+	}
+	std::vector<double> retVal(n, 0);
+	for (size_t s = 0; s < n; s++)
+		for (size_t t = 0; t < n; t++)
+			for (size_t v = 0; v < n; v++)
+				if (s != t && v != s && v != t && dist[s][t] < none && dist[s][v] + dist[v][t] == dist[s][t])
+					retVal[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+	return retVal;
+}
+
+///@brief Function to get the largest difference between two rankings
+template <class aType, class bType>
+double maxDifference(const aType& a, const bType& b)
+{
+	double retVal = 0;
+	for (size_t v = 0; v < a.size(); v++) retVal = std::max(retVal, std::fabs(double(a[v]) - double(b[v])));
+	return retVal;
+}
+
+/**
+ * @brief Function to compute the PageRank personalized to a set of seeds by plain power iteration, as the reference
+ * @details Dangling vertices jump to the seeds, as in #graphPageRank::personalized.
+ */
+std::vector<double> personalizedReference(const csrGraph& g, const std::vector<csrGraph::vertexId>& seeds, double damping)
+{
+	size_t n = g.numVertices();
+	std::vector<double> retVal(n, 0), next(n);
+	for (size_t i = 0; i < seeds.size(); i++) retVal[seeds[i]] += 1.0 / seeds.size();
+	for (size_t iteration = 0; iteration < 300; iteration++)
+	{
+		next.assign(n, 0);
+		for (size_t i = 0; i < seeds.size(); i++) next[seeds[i]] += (1 - damping) / seeds.size();
+		for (csrGraph::vertexId u = 0; u < n; u++)
+		{
+			if (0 == g.degree(u))
+			{
+				for (size_t i = 0; i < seeds.size(); i++) next[seeds[i]] += damping * retVal[u] / seeds.size();
+				continue;
+			}
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++) next[g.targets[slot]] += damping * retVal[u] / g.degree(u);
+		}
+		retVal.swap(next);
+	}
+	return retVal;
+}
+}
+
+/**
+ * @brief Main function to run the graph analytics test scenarios
+ * @details PageRank runs on a small scripted graph with a dangling vertex, by pull iteration on one and several threads and by
+ * Gauss-Seidel sweeps, and then on a random graph where the variants must agree, and on one whose arcs mostly go to higher ids,
+ * where the sweeps must be fewer. Personalized PageRank by forward push is checked against power iteration, within the residual
+ * it reports. Triangles are counted on a scripted graph with a loop and a parallel edge, and on random graphs with skewed degrees,
+ * where every kernel on several threads must agree with checking all the triples.
+ * The core numbers of the same graphs by bucket peeling and by level peeling on several threads must agree with removing one
+ * vertex of least degree at a time. Communities by Louvain and Leiden are found on the karate club network and on weighted graphs
+ * of planted groups, where the groups must be found again, the modularity of every level must match the one recomputed from its
+ * partition, several threads must give the same hierarchy as one and no community of Leiden may be disconnected. Multilevel
+ * partitioning splits two cliques at their bridge, cuts grids close to straight lines and planted groups close to the planted cut,
+ * keeping every part within the imbalance, and the saved subgraphs of the parts must load back to the partition. Betweenness by
+ * Brandes on unweighted and weighted graphs, with ties among the shortest paths, must agree with counting the paths of all the
+ * pairs on any number of threads, and sampling sources must stay within its error bound and be exact when it takes them all.
+ */
+int main()
+{
+	cout << fixed << setprecision(6);
+	cout << "/**********************************************************/" << endl;
+	cout << "/*PageRank: pull, threads and Gauss-Seidel                 */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		GraphAnalytics::directedGraph g;
+		std::vector<GraphAnalytics::directedGraph::vertexDescriptor> v;
+		GraphAnalytics::buildScripted(g, v);
+		GraphAnalytics::pageRank pr(g);
+		GraphAnalytics::pageRank::rankMap rank = pr.pageRank(0.85, 1e-12, 1000);
+		double total = 0;
+		cout << "Pull:";
+		for (size_t i = 0; i < rank.size(); i++)
+		{
+			cout << " " << rank[i];
+			total += rank[i];
+		}
+		cout << endl << "Sum: " << total << endl;
+		size_t pullIterations = pr.lastIterations();
+		GraphAnalytics::pageRank::rankMap threaded = pr.pageRank(0.85, 1e-12, 1000, 3);
+		cout << "Three threads agree: " << (GraphAnalytics::maxDifference(rank, threaded) < 1e-12) << endl;
+		GraphAnalytics::pageRank::rankMap sweeps = pr.gaussSeidel(0.85, 1e-12, 1000);
+		cout << "Gauss-Seidel agrees: " << (GraphAnalytics::maxDifference(rank, sweeps) < 1e-9) << endl;
+		cout << "Gauss-Seidel needs fewer sweeps: " << (pr.lastIterations() < pullIterations) << endl;
+		cout << "Capped at 3: " << (pr.pageRank(0.85, 0, 3).size() == 6 && 3 == pr.lastIterations()) << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*PageRank on a random graph                               */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		csrGraph g = GraphAnalytics::buildRandom(2000, 7000, 2041);
+		GraphAnalytics::pageRank pr(g);
+		GraphAnalytics::pageRank::rankMap rank = pr.pageRank(0.85, 1e-12, 1000);
+		size_t pullIterations = pr.lastIterations();
+		cout << "Pull iterations: " << pullIterations << endl;
+		cout << "Threads agree:";
+		for (size_t t = 2; t <= 8; t *= 2) cout << " " << (GraphAnalytics::maxDifference(rank, pr.pageRank(0.85, 1e-12, 1000, t)) < 1e-12);
+		cout << endl;
+		GraphAnalytics::pageRank::rankMap sweeps = pr.gaussSeidel(0.85, 1e-12, 1000);
+		cout << "Gauss-Seidel agrees: " << (GraphAnalytics::maxDifference(rank, sweeps) < 1e-9) << endl;
+		cout << "Gauss-Seidel sweeps: " << pr.lastIterations() << endl;
+		csrGraph::vertexId best = 0;
+		for (csrGraph::vertexId u = 0; u < rank.size(); u++) if (rank[u] > rank[best]) best = u;
+		cout << "Top vertex: " << best << " " << rank[best] << endl;
+		csrGraph forward = GraphAnalytics::buildForward(2000, 7000, 2041);
+		GraphAnalytics::pageRank ordered(forward);
+		rank = ordered.pageRank(0.85, 1e-12, 1000);
+		pullIterations = ordered.lastIterations();
+		sweeps = ordered.gaussSeidel(0.85, 1e-12, 1000);
+		cout << "Arcs along the order, Gauss-Seidel agrees: " << (GraphAnalytics::maxDifference(rank, sweeps) < 1e-9) << endl;
+		cout << "Arcs along the order, iterations and sweeps: " << pullIterations << " " << ordered.lastIterations() << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Personalized PageRank by forward push                    */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		csrGraph g = GraphAnalytics::buildRandom(2000, 7000, 2041);
+		GraphAnalytics::pageRank pr(g);
+		const csrGraph::vertexId seedList[][2] = {{0, 1}, {17, 17}, {1999, 5}};
+		for (size_t q = 0; q < sizeof(seedList) / sizeof(seedList[0]); q++)
+		{
+			std::vector<csrGraph::vertexId> seeds(seedList[q], seedList[q] + 2);
+			GraphAnalytics::pageRank::sparseRanks ppr = pr.personalized(seeds, 0.85, 1e-7);
+			std::vector<double> exact = GraphAnalytics::personalizedReference(g, seeds, 0.85);
+			std::vector<double> estimate(g.numVertices(), 0);
+			for (size_t i = 0; i < ppr.size(); i++) estimate[ppr[i].first] = ppr[i].second;
+			bool below = true;
+			for (size_t u = 0; u < exact.size(); u++) below = below && (estimate[u] <= exact[u] + 1e-12);
+			cout << "Seeds " << seeds[0] << " " << seeds[1] << ": top " << ppr[0].first << " " << ppr[0].second << ", below exact "
+				<< below << ", within residual " << (GraphAnalytics::maxDifference(estimate, exact) <= pr.lastResidual() + 1e-12)
+				<< ", residual under 1e-3 " << (pr.lastResidual() < 1e-3) << endl;
+		}
+		cout << "Empty seeds: " << pr.personalized(std::vector<csrGraph::vertexId>()).size() << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Triangles and clustering coefficients                    */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		GraphAnalytics::undirectedGraph g;
+		std::vector<GraphAnalytics::undirectedGraph::vertexDescriptor> v;
+		const int edges[][2] = {{0,1}, {0,2}, {0,3}, {1,2}, {1,3}, {2,3}, {3,4}, {4,5}, {5,3}, {6,0}, {2,2}, {1,0}};
+		for (size_t i = 0; i < 8; i++) v.push_back(g.addVertex(new GraphAnalytics::node(i)));
+		for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) g.addEdge(v[edges[i][0]], v[edges[i][1]], new GraphAnalytics::edge(1));
+		GraphAnalytics::triangles t(g);
+		GraphAnalytics::triangles::countType total = 0;
+		GraphAnalytics::triangles::countMap local = t.local(GraphAnalytics::triangles::adaptive, 1, &total);
+		cout << "Edges: " << t.numEdges() << " Triangles: " << total << " Wedges: " << t.wedges() << endl;
+		cout << "Local:";
+		for (size_t i = 0; i < local.size(); i++) cout << " " << local[i];
+		cout << endl << "Local clustering:";
+		propertyMap<double> coefficient = t.localClustering(local);
+		for (size_t i = 0; i < coefficient.size(); i++) cout << " " << coefficient[i];
+		cout << endl << "Global clustering: " << t.globalClustering(total) << " Average clustering: " << t.averageClustering(local) << endl;
+		const char* names[] = {"merge", "galloping", "simd", "adaptive"};
+		const size_t sizes[][3] = {{300, 6000, 300}, {400, 3000, 5}, {400, 20000, 40}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			csrGraph random = GraphAnalytics::buildRandomUndirected(sizes[r][0], sizes[r][1], sizes[r][2], 2042 + r);
+			std::vector<size_t> expected = GraphAnalytics::trianglesReference(random);
+			size_t expectedTotal = 0;
+			for (size_t i = 0; i < expected.size(); i++) expectedTotal += expected[i];
+			GraphAnalytics::triangles rt(random);
+			cout << "Random " << sizes[r][0] << " " << sizes[r][1] << " triangles " << expectedTotal / 3 << ", mismatches:";
+			for (size_t k = 0; k < 4; k++)
+				for (size_t threads = 1; threads <= 3; threads += 2)
+				{
+					GraphAnalytics::triangles::kernel kind = GraphAnalytics::triangles::kernel(k);
+					GraphAnalytics::triangles::countMap counts = rt.local(kind, threads, &total);
+					size_t wrong = (total != expectedTotal / 3) + (rt.count(kind, threads) != expectedTotal / 3);
+					for (size_t i = 0; i < expected.size(); i++) wrong += (counts[i] != expected[i]);
+					cout << " " << names[k] << "/" << threads << "=" << wrong;
+				}
+			cout << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*k-core decomposition                                     */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		GraphAnalytics::undirectedGraph g;
+		std::vector<GraphAnalytics::undirectedGraph::vertexDescriptor> v;
+		const int edges[][2] = {{0,1}, {0,2}, {0,3}, {1,2}, {1,3}, {2,3}, {3,4}, {4,5}, {5,3}, {6,0}, {2,2}, {1,0}, {5,7}};
+		for (size_t i = 0; i < 9; i++) v.push_back(g.addVertex(new GraphAnalytics::node(i)));
+		for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) g.addEdge(v[edges[i][0]], v[edges[i][1]], new GraphAnalytics::edge(1));
+		GraphAnalytics::cores c(g);
+		std::vector<csrGraph::vertexId> order;
+		GraphAnalytics::cores::coreMap core = c.coreness(&order);
+		cout << "Edges: " << c.numEdges() << endl << "Core:";
+		for (size_t i = 0; i < core.size(); i++) cout << " " << core[i];
+		cout << endl << "Parallel:";
+		GraphAnalytics::cores::coreMap parallel = c.parallelCoreness(3);
+		for (size_t i = 0; i < parallel.size(); i++) cout << " " << parallel[i];
+		cout << endl << "Order:";
+		for (size_t i = 0; i < order.size(); i++) cout << " " << order[i];
+		cout << endl << "Histogram:";
+		std::vector<size_t> histogram = GraphAnalytics::cores::histogram(core);
+		for (size_t i = 0; i < histogram.size(); i++) cout << " " << histogram[i];
+		cout << endl << "3-core:";
+		std::vector<csrGraph::vertexId> kept = GraphAnalytics::cores::kCore(core, 3);
+		for (size_t i = 0; i < kept.size(); i++) cout << " " << kept[i];
+		cout << endl;
+		const size_t sizes[][3] = {{300, 6000, 300}, {400, 3000, 5}, {400, 20000, 40}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			csrGraph random = GraphAnalytics::buildRandomUndirected(sizes[r][0], sizes[r][1], sizes[r][2], 2042 + r);
+			std::vector<size_t> expected = GraphAnalytics::coresReference(random);
+			GraphAnalytics::cores rc(random);
+			GraphAnalytics::cores::coreMap sequential = rc.coreness();
+			size_t wrong = 0;
+			for (size_t i = 0; i < expected.size(); i++) wrong += (sequential[i] != expected[i]);
+			cout << "Random " << sizes[r][0] << " " << sizes[r][1] << " degeneracy " << GraphAnalytics::cores::histogram(sequential).size() - 1
+				<< ", mismatches: buckets=" << wrong;
+			for (size_t threads = 1; threads <= 4; threads++)
+			{
+				GraphAnalytics::cores::coreMap levels = rc.parallelCoreness(threads);
+				wrong = 0;
+				for (size_t i = 0; i < expected.size(); i++) wrong += (levels[i] != expected[i]);
+				cout << " levels/" << threads << "=" << wrong;
+			}
+			cout << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Communities by Louvain and Leiden                        */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		const char* names[] = {"Louvain", "Leiden"};
+		csrGraph karate = GraphAnalytics::buildKarate();
+		GraphAnalytics::communities c(karate);
+		cout << "Karate: vertices " << c.numVertices() << " weight " << c.totalWeight() << endl;
+		cout << fixed << setprecision(4);
+		for (size_t k = 0; k < 2; k++)
+		{
+			GraphAnalytics::communities::method kind = GraphAnalytics::communities::method(k);
+			GraphAnalytics::communities::hierarchy levels = c.detect(kind);
+			for (size_t l = 0; l < levels.size(); l++)
+				cout << names[k] << " level " << l << ": communities " << levels[l].communities << " modularity " << levels[l].modularity
+					<< " recomputed " << c.modularity(levels[l].membership) << " disconnected "
+					<< GraphAnalytics::disconnected(karate, levels[l].membership, levels[l].communities) << endl;
+			cout << names[k] << " members:";
+			for (size_t i = 0; i < levels.back().membership.size(); i++) cout << " " << levels.back().membership[i];
+			cout << endl << names[k] << " same on 3 threads: " << GraphAnalytics::sameHierarchy(levels, c.detect(kind, 1.0, 3)) << endl;
+		}
+		GraphAnalytics::communities::hierarchy fine = c.detect(GraphAnalytics::communities::leiden, 2.0);
+		cout << "Leiden resolution 2: communities " << fine.back().communities << " modularity " << fine.back().modularity << endl;
+		const size_t sizes[][5] = {{8, 50, 2000, 90, 1}, {20, 100, 12000, 80, 5}, {50, 200, 60000, 70, 3}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			GraphAnalytics::undirectedGraph g;
+			GraphAnalytics::buildPlanted(g, sizes[r][0], sizes[r][1], sizes[r][2], sizes[r][3], int(sizes[r][4]), 4700 + r);
+			csrGraph csr(g);
+			GraphAnalytics::communities rc(g, graphProperties<GraphAnalytics::undirectedGraph>::edgeProperty(g, &GraphAnalytics::edge::m_weight));
+			cout << "Planted " << sizes[r][0] << "x" << sizes[r][1] << " edges " << sizes[r][2] << " inside " << sizes[r][3] << "%:";
+			for (size_t k = 0; k < 2; k++)
+			{
+				GraphAnalytics::communities::method kind = GraphAnalytics::communities::method(k);
+				GraphAnalytics::communities::hierarchy levels = rc.detect(kind, 1.0, 4);
+				const GraphAnalytics::communities::level& top = levels.back();
+				cout << " " << names[k] << " levels " << levels.size() << " communities " << top.communities << " modularity " << top.modularity
+					<< " misplaced " << GraphAnalytics::misplaced(top.membership, sizes[r][1]) << " disconnected "
+					<< GraphAnalytics::disconnected(csr, top.membership, top.communities) << " recomputed "
+					<< (fabs(rc.modularity(top.membership) - top.modularity) < 1e-9) << " same on 1 thread "
+					<< GraphAnalytics::sameHierarchy(levels, rc.detect(kind, 1.0, 1)) << ";";
+			}
+			cout << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Multilevel k-way partitioning                            */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		GraphAnalytics::undirectedGraph g;
+		std::vector<GraphAnalytics::undirectedGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < 10; i++) v.push_back(g.addVertex(new GraphAnalytics::node(i)));
+		for (size_t a = 0; a < 10; a++)
+			for (size_t b = a + 1; b < 10; b++)
+				if (a / 5 == b / 5) g.addEdge(v[a], v[b], new GraphAnalytics::edge(3));
+		g.addEdge(v[4], v[5], new GraphAnalytics::edge(1));
+		g.addEdge(v[0], v[0], new GraphAnalytics::edge(7));
+		GraphAnalytics::partition p(g, graphProperties<GraphAnalytics::undirectedGraph>::edgeProperty(g, &GraphAnalytics::edge::m_weight));
+		GraphAnalytics::partition::partitionMap part = p.partition(2);
+		cout << "Cliques: vertices " << p.numVertices() << " edges " << p.numEdges() << " cut " << p.edgeCut(part) << " parts:";
+		for (size_t i = 0; i < part.size(); i++) cout << " " << part[i];
+		cout << endl;
+		const size_t ks[] = {0, 1, 3, 12};
+		for (size_t i = 0; i < sizeof(ks) / sizeof(ks[0]); i++)
+		{
+			part = p.partition(ks[i]);
+			std::vector<size_t> sizes = p.partSizes(part, ks[i]);
+			cout << "k " << ks[i] << ": mapped " << part.size() << " cut " << (part.size() ? p.edgeCut(part) : 0) << " largest "
+				<< (sizes.empty() ? 0 : *std::max_element(sizes.begin(), sizes.end())) << " allowed " << (ks[i] ? p.maxPartSize(ks[i], 0.03) : 0) << endl;
+		}
+	}
+	{
+		csrGraph grid = GraphAnalytics::buildGrid(30);
+		GraphAnalytics::partition p(grid);
+		for (size_t k = 2; k <= 8; k *= 2)
+		{
+			size_t levels = 0;
+			GraphAnalytics::partition::partitionMap part = p.partition(k, 0.03, 1, &levels);
+			std::vector<size_t> sizes = p.partSizes(part, k);
+			cout << "Grid 30x30 k " << k << ": levels " << levels << " cut " << p.edgeCut(part) << " largest "
+				<< *std::max_element(sizes.begin(), sizes.end()) << " allowed " << p.maxPartSize(k, 0.03) << " shards "
+				<< GraphAnalytics::shardViolations(p, grid, part, k) << endl;
+		}
+	}
+	{
+		const size_t sizes[][5] = {{8, 50, 2000, 90, 1}, {20, 100, 12000, 80, 5}, {16, 500, 40000, 95, 3}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			GraphAnalytics::undirectedGraph g;
+			GraphAnalytics::buildPlanted(g, sizes[r][0], sizes[r][1], sizes[r][2], sizes[r][3], int(sizes[r][4]), 4800 + r);
+			csrGraph csr(g);
+			GraphAnalytics::partition p(g, graphProperties<GraphAnalytics::undirectedGraph>::edgeProperty(g, &GraphAnalytics::edge::m_weight));
+			size_t k = sizes[r][0], levels = 0;
+			GraphAnalytics::partition::partitionMap planted(p.numVertices()), hashed(p.numVertices());
+			for (size_t i = 0; i < p.numVertices(); i++)
+			{
+				planted[i] = csrGraph::vertexId(i / sizes[r][1]);
+				hashed[i] = csrGraph::vertexId(i % k);
+			}
+			GraphAnalytics::partition::partitionMap part = p.partition(k, 0.03, 7, &levels), again = p.partition(k, 0.03, 7);
+			std::vector<size_t> partSizes = p.partSizes(part, k);
+			size_t same = 0;
+			for (size_t i = 0; i < part.size(); i++) same += (part[i] == again[i]);
+			cout << "Planted " << k << "x" << sizes[r][1] << " edges " << sizes[r][2] << " inside " << sizes[r][3] << "%: levels " << levels
+				<< " cut " << p.edgeCut(part) << " planted cut " << p.edgeCut(planted) << " hashed cut " << p.edgeCut(hashed) << " largest "
+				<< *std::max_element(partSizes.begin(), partSizes.end()) << " allowed " << p.maxPartSize(k, 0.03) << " repeatable "
+				<< (same == part.size()) << " shards " << GraphAnalytics::shardViolations(p, csr, part, k) << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Betweenness centrality by Brandes                        */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		GraphAnalytics::directedGraph g;
+		std::vector<GraphAnalytics::directedGraph::vertexDescriptor> v;
+		GraphAnalytics::buildScripted(g, v);
+		GraphAnalytics::betweenness b(g);
+		GraphAnalytics::betweenness::centralityMap exact = b.exact();
+		cout << "Scripted:";
+		for (size_t i = 0; i < exact.size(); i++) cout << " " << exact[i];
+		cout << endl;
+		csrGraph csr(g);
+		cout << "Matches reference: " << (GraphAnalytics::maxDifference(exact, GraphAnalytics::betweennessReference(csr,
+			std::vector<long long>(csr.numSlots(), 1))) < 1e-9) << endl;
+		csrGraph karate = GraphAnalytics::buildKarate();
+		GraphAnalytics::betweenness kb(karate);
+		exact = kb.exact();
+		csrGraph::vertexId best = 0;
+		for (csrGraph::vertexId u = 0; u < exact.size(); u++) if (exact[u] > exact[best]) best = u;
+		cout << "Karate club: most between " << best << " with " << exact[best] / 2 << " unordered pairs" << endl;
+		double bound = -1;
+		GraphAnalytics::betweenness::centralityMap all = kb.approximate(34, 2, 5, 0.05, &bound);
+		cout << "All the sources sampled: exact " << (GraphAnalytics::maxDifference(exact, all) < 1e-9) << " bound " << bound << " searches "
+			<< kb.lastSearches() << endl;
+		cout << "No sources sampled: " << GraphAnalytics::maxDifference(kb.approximate(0), std::vector<double>(34, 0)) << " bound "
+			<< GraphAnalytics::betweenness::errorBound(34, 0, 0.05) << endl;
+	}
+	{
+		const size_t sizes[][3] = {{40, 120, 1}, {60, 150, 3}, {50, 400, 2}, {80, 200, 10}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			GraphAnalytics::directedGraph g;
+			GraphAnalytics::buildRandomWeighted(g, sizes[r][0], sizes[r][1], int(sizes[r][2]), 4900 + r);
+			csrGraph csr(g);
+			propertyMap<int> slots = csr.slotProperty(graphProperties<GraphAnalytics::directedGraph>::edgeProperty(g, &GraphAnalytics::edge::m_weight));
+			std::vector<long long> length(slots.data(), slots.data() + slots.size());
+			GraphAnalytics::betweenness unweighted(csr), weighted(g, graphProperties<GraphAnalytics::directedGraph>::edgeProperty(g, &GraphAnalytics::edge::m_weight));
+			std::vector<double> expectedUnweighted = GraphAnalytics::betweennessReference(csr, std::vector<long long>(csr.numSlots(), 1));
+			std::vector<double> expectedWeighted = GraphAnalytics::betweennessReference(csr, length);
+			cout << "Random " << sizes[r][0] << " vertices " << sizes[r][1] << " edges weights up to " << sizes[r][2] << ": agree";
+			for (size_t t = 1; t <= 4; t++)
+				cout << " " << (GraphAnalytics::maxDifference(unweighted.exact(t), expectedUnweighted) < 1e-6)
+					<< (GraphAnalytics::maxDifference(weighted.exact(t), expectedWeighted) < 1e-6);
+			cout << endl;
+		}
+	}
+	{
+		csrGraph g = GraphAnalytics::buildRandomUndirected(1500, 4500, 30, 4950);
+		GraphAnalytics::betweenness b(g);
+		GraphAnalytics::betweenness::centralityMap exact = b.exact(4);
+		size_t samples = GraphAnalytics::betweenness::samplesFor(g.numVertices(), 0.1, 0.05);
+		cout << "Random 1500 vertices: " << samples << " samples for 10% of the pairs, bound "
+			<< GraphAnalytics::betweenness::errorBound(g.numVertices(), samples, 0.05) / (1500.0 * 1499.0) << endl;
+		const size_t counts[] = {50, 200, samples};
+		for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+		{
+			double bound = 0;
+			GraphAnalytics::betweenness::centralityMap estimate = b.approximate(counts[i], 3, 11, 0.05, &bound);
+			GraphAnalytics::betweenness::centralityMap again = b.approximate(counts[i], 1, 11, 0.05);
+			double error = GraphAnalytics::maxDifference(exact, estimate);
+			cout << counts[i] << " samples: within bound " << (error <= bound) << " error " << error / (1500.0 * 1499.0) << " repeatable " << (GraphAnalytics::maxDifference(estimate, again) < 1e-6) << endl;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ *  @file GraphBench/om/include/GraphBench.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the object model and the input handling shared by the benchmarks of the GraphBench application.
+ *  All the data structures present in the file are in a namespace called GraphBench.
+ */
+#ifndef APPS_GRAPHBENCH_OM_INCLUDE_GRAPHBENCH_HPP_
+#define APPS_GRAPHBENCH_OM_INCLUDE_GRAPHBENCH_HPP_
+
+#include <graph.hpp>
+#include <GraphCSR.hpp>
+#include <GraphProperty.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+using namespace std;
+
+/**
+ * @brief GraphBench to wrap the object model specific to this benchmarking suite.
+ */
+namespace GraphBench
+{
+/**
+ * @brief Vertex OM for the graph
+ * @details This class has a single member to signify the ID of the graph vertex
+ */
+struct node
+{
+	size_t m_id;	///< Member to store the ID of the graph node
+
+	///@brief Default constructor for initializing class members
+	node():m_id(0){};
+
+	///@brief Single argument constructor to initialize class member m_id
+	node(size_t id):m_id(id){};
+};
+
+/**
+ * @brief Edge OM for the graph
+ * @details This class has a weight member to signify the weight of the edge.
+ */
+struct edge
+{
+	int m_weight;		///< Weight of the edge.
+
+	///@brief Default constructor for initializing class members
+	edge():m_weight(0){};
+
+	///@brief Single argument constructor to initialize class members
+	edge(int weight):m_weight(weight){};
+};
+
+typedef graph<GraphBench::node*,GraphBench::edge*,graphTraits::bidirectional> Graph;	///< Type of graph used by the benchmarks
+
+/**
+ * @brief Input of a benchmark
+ * @details The #graph is built first, exactly as GraphRead does, and then flattened into a #csrGraph with the edge weights
+ * gathered in slot order.
+ */
+struct benchInput
+{
+	Graph g;	///< The graph as read from the input
+	csrGraph csr;	///< Flat adjacency of g
+	propertyMap<int> weights;	///< Weight of every edge, keyed by #edge::index
+	propertyMap<int> slotWeights;	///< Weight of every slot of csr
+	std::vector<Graph::vertexDescriptor> idToDescriptorMap;	///< Descriptor of every vertex by the id used in the input, 1 based
+};
+
+/**
+ * @brief Function to read the input of a benchmark
+ * @param	args	Command line arguments after the benchmark name. Either a file in the GraphRead format, "grid side" for a
+ * side x side grid or "random n m" for a graph with n vertices and m random edges. The synthetic graphs get their ids shuffled, so
+ * that like real inputs neighbors do not have nearby ids.
+ * @param	in		The input to be filled
+ * @return false if the arguments could not be understood
+ */
+bool readInput(const std::vector<std::string>& args, benchInput& in);
+
+/**
+ * @brief Wall clock stopwatch
+ */
+class stopWatch
+{
+	std::chrono::steady_clock::time_point m_start;	///< Member to hold the time the watch was started
+public:
+	///@brief Constructor which starts the watch
+	stopWatch() : m_start(std::chrono::steady_clock::now()){}
+	///@brief Member function to restart the watch
+	void restart() {m_start = std::chrono::steady_clock::now();}
+	///@brief Member function to get the milliseconds since the watch was started
+	double elapsedMs() const {return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - m_start).count();}
+};
+
+/**
+ * @brief Function to run breadth first searches from the given sources
+ * @tparam	graphClass	#csrGraph or #compressedGraph, anything providing numVertices, neighborBegin and neighborEnd
+ * @return Sum of the depths of all the reached vertices, to keep the work from being optimized away
+ */
+template <class graphClass>
+size_t breadthFirstKernel(const graphClass& g, const std::vector<csrGraph::vertexId>& sources)
+{
+	std::vector<unsigned int> depth(g.numVertices());
+	std::vector<csrGraph::vertexId> queue(g.numVertices());
+	size_t retVal = 0;
+	for (size_t s = 0; s < sources.size(); s++)
+	{
+		depth.assign(g.numVertices(), ~0u);
+		size_t head = 0, tail = 0;
+		depth[sources[s]] = 0;
+		queue[tail++] = sources[s];
+		while (head < tail)
+		{
+			csrGraph::vertexId v = queue[head++];
+			retVal += depth[v];
+			typename graphClass::neighborIterator end = g.neighborEnd(v);
+			for (typename graphClass::neighborIterator u = g.neighborBegin(v); u != end; ++u)
+				if (~0u == depth[*u])
+				{
+					depth[*u] = depth[v] + 1;
+					queue[tail++] = *u;
+				}
+		}
+	}
+	return retVal;
+}
+
+int reorderBench(const std::vector<std::string>& args);	///< Benchmark of the traversal speedup given by the vertex orderings
+int compressBench(const std::vector<std::string>& args);	///< Benchmark of the size and decode cost of #compressedGraph
+int versionedBench(const std::vector<std::string>& args);	///< Benchmark of the reader throughput of #versionedGraph during ingest
+int heapsBench(const std::vector<std::string>& args);	///< Benchmark of the meldable heaps against the binary #heap
+int multiQueueBench(const std::vector<std::string>& args);	///< Benchmark of the throughput and rank error of #multiQueue
+int ssspBench(const std::vector<std::string>& args);	///< Benchmark of the strong scaling of delta-stepping
+int p2pBench(const std::vector<std::string>& args);	///< Benchmark of the point to point queries of #graphPointToPoint
+int chBench(const std::vector<std::string>& args);	///< Benchmark of the preprocessing and queries of #contractionHierarchy
+int apspBench(const std::vector<std::string>& args);	///< Benchmark of Floyd-Warshall and Johnson in #graphAllPairs
+int pageRankBench(const std::vector<std::string>& args);	///< Benchmark of the PageRank variants of #graphPageRank
+int trianglesBench(const std::vector<std::string>& args);	///< Benchmark of the intersection kernels of #graphTriangles
+int coresBench(const std::vector<std::string>& args);	///< Benchmark of the k-core decomposition of #graphCores
+int maxFlowBench(const std::vector<std::string>& args);	///< Benchmark of Dinic and push-relabel in #graphMaxFlow
+int minCutBench(const std::vector<std::string>& args);	///< Benchmark of the global minimum cut algorithms of #graphMinCut
+int matchingBench(const std::vector<std::string>& args);	///< Benchmark of #bipartiteMatching and #bipartiteAssignment, warm and cold
+int communitiesBench(const std::vector<std::string>& args);	///< Louvain and Leiden community detection on one and several threads
+int partitionBench(const std::vector<std::string>& args);	///< Multilevel k-way partitioning into 2 to 64 parts against hashing
+int betweennessBench(const std::vector<std::string>& args);	///< Benchmark of exact and sampled betweenness centrality
+int labelsBench(const std::vector<std::string>& args);	///< Pruned landmark labels: construction, size, save and load, and queries against Dijkstra
+}
+
+#endif /* APPS_GRAPHBENCH_OM_INCLUDE_GRAPHBENCH_HPP_ */
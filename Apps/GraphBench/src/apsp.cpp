@@ -0,0 +1,106 @@
+/**
+ *  @file GraphBench/src/apsp.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the all pairs shortest paths of #graphAllPairs.
+ */
+#include <GraphBench.hpp>
+#include <GraphAllPairs.hpp>
+#include <thread>
+#include <limits>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to check #allPairsKernel against plain loops on random rows of every length up to 40, so that both the vector
+ * part and the tail are covered, with distances at a quarter of the largest value, as Floyd-Warshall keeps for no path, as well
+ * as small ones
+ * @tparam	distanceType	Type of the distances
+ */
+template <typename distanceType>
+static bool kernelMatches()
+{
+	const distanceType infinity = std::numeric_limits<distanceType>::max() / 4;
+	unsigned long long state = 2029;
+	std::vector<distanceType> row, krows[4], expected;
+	for (size_t count = 0; count <= 40; count++)
+	{
+		distanceType dik[4];
+		const distanceType* krow[4];
+		for (size_t k = 0; k < 4; k++)
+		{
+			krows[k].resize(count);
+			for (size_t j = 0; j < count; j++)
+			{
+				state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+				krows[k][j] = (0 == (state >> 60)) ? infinity : distanceType((state >> 33) % 1000) - 100;
+			}
+			krow[k] = &krows[k][0];
+			dik[k] = distanceType(k * 37) - 50;
+		}
+		row.resize(count);
+		for (size_t j = 0; j < count; j++) row[j] = (0 == j % 3) ? infinity : distanceType(j * 11);
+		expected = row;
+		for (size_t j = 0; j < count; j++) expected[j] = std::min(expected[j], distanceType(dik[0] + krow[0][j]));
+		std::vector<distanceType> one(row);
+		allPairsKernel<distanceType>::relax(&one[0], krow[0], dik[0], count);
+		if (one != expected) return false;
+		for (size_t k = 1; k < 4; k++)
+			for (size_t j = 0; j < count; j++) expected[j] = std::min(expected[j], distanceType(dik[k] + krow[k][j]));
+		allPairsKernel<distanceType>::relaxFour(&row[0], krow, dik, count);
+		if (row != expected) return false;
+	}
+	return true;
+}
+
+/**
+ * @details Floyd-Warshall and Johnson are timed on 1, 2, 4, ... threads up to twice the hardware threads and checked against
+ * Floyd-Warshall on one thread, and the algorithm #graphAllPairs::allPairs would pick is reported. The kernel line tells whether
+ * Floyd-Warshall runs the AVX2 kernel, which the Makefile enables, and whether the kernels for 32 and 64 bit distances give
+ * the same rows as plain loops.
+ */
+int apspBench(const std::vector<std::string>& args)
+{
+	typedef graphAllPairs<int> allPairs;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: apsp (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+#ifdef __AVX2__
+	const char* kernel = "AVX2";
+#else
+	const char* kernel = "portable";
+#endif
+	printf("Vertices %zu Slots %zu Hardware threads %u Kernel %s Preferred %s\n", n, in.csr.numSlots(), hardware, kernel,
+			allPairs::preferFloydWarshall(n, in.csr.numSlots()) ? "floyd-warshall" : "johnson");
+	printf("Kernel against plain loops, int %s, long long %s\n", kernelMatches<int>() ? "ok" : "MISMATCH",
+			kernelMatches<long long>() ? "ok" : "MISMATCH");
+	printf("%-16s %-8s %12s %12s %8s\n", "Method", "Threads", "Time(ms)", "Speedup", "Check");
+	allPairs::distanceMatrix expected;
+	double oneThread = 0;
+	for (size_t method = 0; method < 2; method++)
+		for (size_t p = 1; p <= 2 * hardware; p *= 2)
+		{
+			allPairs::distanceMatrix d;
+			stopWatch watch;
+			bool ok = (0 == method) ? allPairs::floydWarshall(in.csr, in.slotWeights, d, p) : allPairs::johnson(in.csr, in.slotWeights, d, p);
+			double time = watch.elapsedMs();
+			if (0 == method && 1 == p)
+			{
+				oneThread = time;
+				expected = d;
+			}
+			for (size_t u = 0; u < n && true == ok; u++)
+				for (size_t v = 0; v < n; v++) ok = ok && (d(u, v) == expected(u, v));
+			printf("%-16s %-8zu %12.2f %11.2fx %8s\n", (0 == method) ? "floyd-warshall" : "johnson", p, time, oneThread / time, ok ? "ok" : "MISMATCH");
+		}
+	return 0;
+}
+}
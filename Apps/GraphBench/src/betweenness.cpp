@@ -0,0 +1,73 @@
+/**
+ *  @file GraphBench/src/betweenness.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the betweenness centrality of #graphBetweenness.
+ */
+#include <GraphBench.hpp>
+#include <GraphBetweenness.hpp>
+#include <thread>
+#include <cstdio>
+#include <cmath>
+
+namespace GraphBench
+{
+/**
+ * @details The unweighted and the weighted betweenness are estimated from 256 sampled sources on 1, 2, 4, ... threads up to twice
+ * the hardware threads, next to one breadth first search of the whole graph as the cost of a single source, with the time an exact
+ * run would take extrapolated from it. On graphs of up to 5000 vertices the exact values are computed as well, and the largest
+ * error of the samples is checked against the bound they report, both as a share of the ordered pairs.
+ */
+int betweennessBench(const std::vector<std::string>& args)
+{
+	typedef graphBetweenness<> betweenness;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: betweenness (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (n < 3) return 0;
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	const size_t samples = 256;
+	const double pairs = double(n) * double(n - 1);
+	stopWatch watch;
+	betweenness unweighted(in.csr), weighted(in.csr, in.slotWeights);
+	printf("Vertices %zu Slots %zu Hardware threads %u Setup(ms) %.2f\n", n, in.csr.numSlots(), hardware, watch.elapsedMs());
+	watch.restart();
+	size_t depths = breadthFirstKernel(in.csr, std::vector<csrGraph::vertexId>(1, 0));
+	double pass = watch.elapsedMs();
+	printf("BFS(ms) %.2f Exact estimate(s) %.1f Samples %zu Bound %.4f\n", pass, (depths > 0) ? pass * n / 1000 : 0.0,
+		std::min(samples, n), betweenness::errorBound(n, samples, 0.05) / pairs);
+	printf("%-12s %-8s %12s %12s %10s\n", "Method", "Threads", "Time(ms)", "Per source", "Error");
+	betweenness* kinds[] = {&unweighted, &weighted};
+	const char* names[] = {"unweighted", "weighted"};
+	for (size_t k = 0; k < 2; k++)
+	{
+		betweenness::centralityMap exact;
+		if (n <= 5000)
+		{
+			watch.restart();
+			exact = kinds[k]->exact();
+			double time = watch.elapsedMs();
+			printf("%-12s %-8d %12.2f %12.3f %10s\n", names[k], 1, time, time / n, "exact");
+		}
+		for (size_t p = 1; p <= 2 * hardware; p *= 2)
+		{
+			double bound = 0;
+			watch.restart();
+			betweenness::centralityMap estimate = kinds[k]->approximate(samples, p, 1, 0.05, &bound);
+			double time = watch.elapsedMs();
+			double error = 0;
+			for (size_t v = 0; v < exact.size(); v++) error = std::max(error, std::fabs(exact[v] - estimate[v]));
+			char check[32];
+			if (0 == exact.size()) snprintf(check, sizeof(check), "-");
+			else snprintf(check, sizeof(check), "%.4f%s", error / pairs, (error <= bound) ? "" : "!");
+			printf("%-12s %-8zu %12.2f %12.3f %10s\n", names[k], p, time, time / kinds[k]->lastSearches(), check);
+		}
+	}
+	return 0;
+}
+}
@@ -0,0 +1,82 @@
+/**
+ *  @file GraphBench/src/ch.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the preprocessing, the queries and the save and load of #contractionHierarchy.
+ */
+#include <GraphBench.hpp>
+#include <GraphContraction.hpp>
+#include <GraphPointToPoint.hpp>
+#include <sstream>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details The hierarchy is built once, reporting the time and the shortcuts, then saved to memory and loaded back. The same random
+ * source and target pairs are answered by Dijkstra stopping at the target, bidirectional Dijkstra and the hierarchy before and after
+ * the reload, reporting the mean query time, the mean number of settled vertices and the speedup over Dijkstra.
+ */
+int chBench(const std::vector<std::string>& args)
+{
+	typedef contractionHierarchy<int> hierarchy;
+	typedef graphPointToPoint<int> pointToPoint;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: ch (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	stopWatch watch;
+	hierarchy ch(in.csr, in.slotWeights);
+	double preprocess = watch.elapsedMs();
+	printf("Vertices %zu Slots %zu Shortcuts %zu Preprocessing %.2f ms\n", n, in.csr.numSlots(), ch.numShortcuts(), preprocess);
+	std::stringstream saved;
+	watch.restart();
+	bool ok = ch.save(saved);
+	double saveTime = watch.elapsedMs();
+	hierarchy loaded;
+	watch.restart();
+	ok = ok && loaded.load(saved);
+	printf("Save %.2f ms Load %.2f ms Size %.2f MB %s\n", saveTime, watch.elapsedMs(), saved.str().size() / 1048576.0, ok ? "ok" : "FAILED");
+	const size_t noOfQueries = 1000;
+	std::vector<std::pair<csrGraph::vertexId,csrGraph::vertexId> > queries;
+	unsigned long long state = 2015;
+	for (size_t i = 0; i < noOfQueries; i++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		csrGraph::vertexId s = csrGraph::vertexId((state >> 33) % n);
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		queries.push_back(std::make_pair(s, csrGraph::vertexId((state >> 33) % n)));
+	}
+	pointToPoint p(in.csr, in.slotWeights);
+	printf("%-16s %12s %12s %10s %8s\n", "Method", "Query(us)", "Settled", "Speedup", "Check");
+	std::vector<long long> expected(noOfQueries);
+	double dijkstraTime = 0;
+	for (size_t method = 0; method < 4; method++)
+	{
+		const char* names[] = {"dijkstra", "bidirectional", "ch", "ch reloaded"};
+		size_t settled = 0;
+		ok = true;
+		watch.restart();
+		for (size_t q = 0; q < noOfQueries; q++)
+		{
+			long long d;
+			if (0 == method) d = expected[q] = p.dijkstra(queries[q].first, queries[q].second);
+			else if (1 == method) d = p.bidirectional(queries[q].first, queries[q].second);
+			else if (2 == method) d = ch.distance(queries[q].first, queries[q].second);
+			else d = loaded.distance(queries[q].first, queries[q].second);
+			ok = ok && (d == expected[q]);
+			settled += (method < 2) ? p.lastSettled() : (2 == method) ? ch.lastSettled() : loaded.lastSettled();
+		}
+		double time = watch.elapsedMs();
+		if (0 == method) dijkstraTime = time;
+		printf("%-16s %12.2f %12.1f %9.2fx %8s\n", names[method], time * 1000.0 / noOfQueries, double(settled) / noOfQueries,
+				dijkstraTime / time, ok ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,67 @@
+/**
+ *  @file GraphBench/src/communities.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the community detection of #graphCommunities.
+ */
+#include <GraphBench.hpp>
+#include <GraphCommunities.hpp>
+#include <thread>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details Louvain and Leiden on 1, 2, 4, ... threads up to twice the hardware threads are timed on the weighted graph, next to
+ * one breadth first search of the whole graph, and checked to give the same hierarchy as on one thread. The communities and the
+ * modularity of every level of Leiden follow.
+ */
+int communitiesBench(const std::vector<std::string>& args)
+{
+	typedef graphCommunities<> communities;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: communities (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	stopWatch watch;
+	communities c(in.csr, in.slotWeights);
+	printf("Vertices %zu Slots %zu Hardware threads %u Setup(ms) %.2f\n", n, in.csr.numSlots(), hardware, watch.elapsedMs());
+	watch.restart();
+	size_t depths = breadthFirstKernel(in.csr, std::vector<csrGraph::vertexId>(1, 0));
+	double pass = watch.elapsedMs();
+	printf("%-16s %-8s %12s %12s %8s %12s %10s %8s\n", "Method", "Threads", "Time(ms)", "vs BFS", "Levels", "Communities", "Modularity", "Check");
+	printf("%-16s %-8d %12.2f %11.2fx %8s %12s %10s %8s\n", "bfs", 1, pass, 1.0, "-", "-", "-", (depths > 0 || n == 1) ? "ok" : "-");
+	const char* names[] = {"louvain", "leiden"};
+	communities::hierarchy leiden;
+	for (size_t k = 0; k < 2; k++)
+	{
+		communities::hierarchy first;
+		for (size_t p = 1; p <= 2 * hardware; p *= 2)
+		{
+			watch.restart();
+			communities::hierarchy levels = c.detect(communities::method(k), 1.0, p);
+			double time = watch.elapsedMs();
+			bool ok = true;
+			if (1 == p) first = levels;
+			else
+			{
+				ok = (levels.size() == first.size());
+				for (size_t l = 0; true == ok && l < levels.size(); l++)
+					for (size_t v = 0; v < n; v++) ok = ok && (levels[l].membership[v] == first[l].membership[v]);
+			}
+			printf("%-16s %-8zu %12.2f %11.2fx %8zu %12zu %10.4f %8s\n", names[k], p, time, time / pass, levels.size(),
+				levels.back().communities, levels.back().modularity, ok ? "ok" : "MISMATCH");
+		}
+		if (communities::leiden == communities::method(k)) leiden = first;
+	}
+	for (size_t l = 0; l < leiden.size(); l++)
+		printf("Leiden level %zu: communities %zu modularity %.4f\n", l, leiden[l].communities, leiden[l].modularity);
+	return 0;
+}
+}
@@ -0,0 +1,113 @@
+/**
+ *  @file GraphBench/src/compress.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the compressed adjacency #compressedGraph.
+ */
+#include <GraphBench.hpp>
+#include <GraphReorder.hpp>
+#include <GraphCompressed.hpp>
+#include <iterator>
+#include <algorithm>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to run breadth first searches decoding whole rows with #compressedGraph::decode
+ * @return @copydoc breadthFirstKernel
+ */
+static size_t breadthFirstDecodeKernel(const compressedGraph& g, const std::vector<csrGraph::vertexId>& sources)
+{
+	std::vector<unsigned int> depth(g.numVertices());
+	std::vector<csrGraph::vertexId> queue(g.numVertices()), row;
+	size_t retVal = 0;
+	for (size_t s = 0; s < sources.size(); s++)
+	{
+		depth.assign(g.numVertices(), ~0u);
+		size_t head = 0, tail = 0;
+		depth[sources[s]] = 0;
+		queue[tail++] = sources[s];
+		while (head < tail)
+		{
+			csrGraph::vertexId v = queue[head++];
+			retVal += depth[v];
+			g.decode(v, row);
+			for (size_t i = 0; i < row.size(); i++)
+				if (~0u == depth[row[i]])
+				{
+					depth[row[i]] = depth[v] + 1;
+					queue[tail++] = row[i];
+				}
+		}
+	}
+	return retVal;
+}
+
+/**
+ * @brief Function to check that every row decoded with #compressedGraph::decode holds the neighbors the iterator gives, one
+ * delta at a time, and those of the #csrGraph it was built from
+ */
+static bool rowsMatch(const csrGraph& csr, const compressedGraph& g)
+{
+	std::vector<csrGraph::vertexId> row;
+	for (csrGraph::vertexId v = 0; v < csr.numVertices(); v++)
+	{
+		if (csr.degree(v) != g.decode(v, row)) return false;
+		if (false == std::equal(row.begin(), row.end(), g.neighborBegin(v))) return false;
+		if (false == std::equal(row.begin(), row.end(), csr.neighborBegin(v))) return false;
+	}
+	return true;
+}
+
+/**
+ * @details The input is first put in reverse Cuthill-McKee order, which is what makes the deltas small. The sizes of the
+ * #graph adjacency, the #csrGraph and both encodings of #compressedGraph are reported together with the time of the same
+ * breadth first searches over each of them. Every row is then decoded whole, with SSSE3 when the build enables it, and checked
+ * against the iterator and the #csrGraph.
+ */
+int compressBench(const std::vector<std::string>& args)
+{
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: compress (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	typedef std::iterator_traits<Graph::edgeDescriptor>::value_type edgeType;
+	csrGraph csr = graphReorder::apply(in.csr, graphReorder::reverseCuthillMcKee(in.csr));
+	size_t slots = csr.numSlots(), n = csr.numVertices();
+	std::vector<csrGraph::vertexId> sources;
+	for (size_t i = 0; i < 8 && 0 != n; i++) sources.push_back(csrGraph::vertexId((i * 7919) % n));
+	stopWatch watch;
+	compressedGraph varintGraph(csr, compressedGraph::varint);
+	double varintBuild = watch.elapsedMs();
+	watch.restart();
+	compressedGraph vbyteGraph(csr, compressedGraph::streamVByte);
+	double vbyteBuild = watch.elapsedMs();
+	double graphBits = (0 == slots) ? 0 : 8.0 * (slots * (sizeof(void*) + sizeof(edgeType) + 2 * sizeof(void*))) / slots;
+	double csrBits = (0 == slots) ? 0 : 8.0 * (slots * sizeof(csrGraph::vertexId) + (n + 1) * sizeof(size_t)) / slots;
+	printf("Vertices %zu Slots %zu\n", n, slots);
+	printf("%-22s %10s %12s %10s %10s %8s\n", "Layout", "Build(ms)", "Bits/edge", "Ratio", "BFS(ms)", "Check");
+	watch.restart();
+	size_t base = breadthFirstKernel(csr, sources);
+	double csrTime = watch.elapsedMs();
+	printf("%-22s %10s %12.2f %10.2f %10s %8s\n", "graph<> (estimate)", "-", graphBits, graphBits / csrBits, "-", "-");
+	printf("%-22s %10s %12.2f %10.2f %10.2f %8s\n", "csr", "-", csrBits, 1.0, csrTime, "ok");
+	const compressedGraph* graphs[] = {&varintGraph, &vbyteGraph, &vbyteGraph};
+	const char* names[] = {"varint iterator", "stream-vbyte iterator", "stream-vbyte decode"};
+	double builds[] = {varintBuild, vbyteBuild, vbyteBuild};
+	for (size_t i = 0; i < 3; i++)
+	{
+		watch.restart();
+		size_t result = (2 == i) ? breadthFirstDecodeKernel(*graphs[i], sources) : breadthFirstKernel(*graphs[i], sources);
+		double time = watch.elapsedMs();
+		printf("%-22s %10.2f %12.2f %10.2f %10.2f %8s\n", names[i], builds[i], graphs[i]->totalBitsPerEdge(),
+				graphs[i]->totalBitsPerEdge() / csrBits, time, (result == base) ? "ok" : "MISMATCH");
+	}
+	printf("Row decode with SSSE3 %s, varint rows %s, stream-vbyte rows %s\n", compressedGraph::simdAvailable() ? "yes" : "no",
+			rowsMatch(csr, varintGraph) ? "ok" : "MISMATCH", rowsMatch(csr, vbyteGraph) ? "ok" : "MISMATCH");
+	return 0;
+}
+}
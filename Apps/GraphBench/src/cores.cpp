@@ -0,0 +1,59 @@
+/**
+ *  @file GraphBench/src/cores.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the k-core decomposition of #graphCores.
+ */
+#include <GraphBench.hpp>
+#include <GraphCores.hpp>
+#include <thread>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details Bucket peeling and level peeling on 1, 2, 4, ... threads up to twice the hardware threads are timed and checked against
+ * bucket peeling, next to one breadth first search of the whole graph as the cost of a single pass of the algorithms the cores
+ * are meant to prune for. The histogram of the core numbers follows.
+ */
+int coresBench(const std::vector<std::string>& args)
+{
+	typedef graphCores<> cores;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: cores (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	stopWatch watch;
+	cores c(in.csr);
+	printf("Vertices %zu Edges %zu Hardware threads %u Setup(ms) %.2f\n", n, c.numEdges(), hardware, watch.elapsedMs());
+	watch.restart();
+	size_t depths = breadthFirstKernel(in.csr, std::vector<csrGraph::vertexId>(1, 0));
+	double pass = watch.elapsedMs();
+	printf("%-16s %-8s %12s %12s %8s\n", "Method", "Threads", "Time(ms)", "vs BFS", "Check");
+	printf("%-16s %-8d %12.2f %11.2fx %8s\n", "bfs", 1, pass, 1.0, (depths > 0 || n == 1) ? "ok" : "-");
+	watch.restart();
+	cores::coreMap expected = c.coreness();
+	double time = watch.elapsedMs();
+	printf("%-16s %-8d %12.2f %11.2fx %8s\n", "buckets", 1, time, time / pass, "ok");
+	for (size_t p = 1; p <= 2 * hardware; p *= 2)
+	{
+		watch.restart();
+		cores::coreMap core = c.parallelCoreness(p);
+		time = watch.elapsedMs();
+		bool ok = true;
+		for (size_t v = 0; v < n; v++) ok = ok && (core[v] == expected[v]);
+		printf("%-16s %-8zu %12.2f %11.2fx %8s\n", "levels", p, time, time / pass, ok ? "ok" : "MISMATCH");
+	}
+	std::vector<size_t> histogram = cores::histogram(expected);
+	printf("Degeneracy %zu Histogram", histogram.size() - 1);
+	for (size_t k = 0; k < histogram.size(); k++) if (histogram[k] > 0) printf(" %zu:%zu", k, histogram[k]);
+	printf("\n");
+	return 0;
+}
+}
@@ -0,0 +1,178 @@
+/**
+ *  @file GraphBench/src/heaps.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the meldable heaps #pairingHeap and #fibonacciHeap against the binary #heap.
+ */
+#include <GraphBench.hpp>
+#include <heap.hpp>
+#include <PairingHeap.hpp>
+#include <FibonacciHeap.hpp>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Tentative distance of a vertex, as kept in the heaps
+ */
+struct distEntry
+{
+	unsigned long long dist;	///< Member to hold the tentative distance
+	csrGraph::vertexId v;	///< Member to hold the vertex
+	///@brief Member function to get the key required by heap.
+	static unsigned long long getKey(distEntry& a) {return a.dist;}
+};
+
+/**
+ * @brief Function to run Dijkstra with the binary #heap, which has no decreaseKey
+ * @details A vertex is inserted again every time its distance improves and the stale entries are skipped when extracted.
+ * @return Sum of the distances of the reached vertices
+ */
+static unsigned long long dijkstraBinary(const csrGraph& g, const propertyMap<int>& weights, csrGraph::vertexId source)
+{
+	std::vector<unsigned long long> dist(g.numVertices(), ~0ULL);
+	heap<distEntry,basic_heap_min_traits<distEntry> > queue;
+	distEntry s = {0, source};
+	dist[source] = 0;
+	queue.insert(s);
+	unsigned long long retVal = 0;
+	while (0 != queue.getSize())
+	{
+		distEntry top = queue.extractTop();
+		if (top.dist != dist[top.v]) continue;
+		retVal += top.dist;
+		for (size_t slot = g.offsets[top.v]; slot < g.offsets[top.v + 1]; slot++)
+		{
+			distEntry next = {top.dist + weights[slot], g.targets[slot]};
+			if (next.dist >= dist[next.v]) continue;
+			dist[next.v] = next.dist;
+			queue.insert(next);
+		}
+	}
+	return retVal;
+}
+
+/**
+ * @brief Function to run Dijkstra with a heap which has handles and decreaseKey
+ * @tparam	heapType	#pairingHeap or #fibonacciHeap of #distEntry
+ * @return @copydoc dijkstraBinary
+ */
+template <class heapType>
+static unsigned long long dijkstraDecrease(const csrGraph& g, const propertyMap<int>& weights, csrGraph::vertexId source)
+{
+	std::vector<unsigned long long> dist(g.numVertices(), ~0ULL);
+	std::vector<typename heapType::handle> handles(g.numVertices(), NULL);
+	std::vector<bool> done(g.numVertices(), false);
+	heapType queue;
+	distEntry s = {0, source};
+	dist[source] = 0;
+	handles[source] = queue.insert(s);
+	unsigned long long retVal = 0;
+	while (false == queue.empty())
+	{
+		distEntry top = queue.extractTop();
+		done[top.v] = true;
+		retVal += top.dist;
+		for (size_t slot = g.offsets[top.v]; slot < g.offsets[top.v + 1]; slot++)
+		{
+			distEntry next = {top.dist + weights[slot], g.targets[slot]};
+			if (done[next.v] || next.dist >= dist[next.v]) continue;
+			if (~0ULL == dist[next.v]) handles[next.v] = queue.insert(next);
+			else queue.decreaseKey(handles[next.v], next);
+			dist[next.v] = next.dist;
+		}
+	}
+	return retVal;
+}
+
+/**
+ * @brief Function to merge k heaps of m random keys each into one by pairwise melds
+ * @tparam	heapType	#pairingHeap or #fibonacciHeap of int
+ * @return Sum of the first keys extracted from the merged heap, to check the kinds of heap agree
+ */
+template <class heapType>
+static long long meldKernel(size_t k, size_t m)
+{
+	std::vector<heapType*> heaps(k);
+	for (size_t i = 0; i < k; i++)
+	{
+		heaps[i] = new heapType();
+		for (size_t j = 0; j < m; j++) heaps[i]->insert(int((i * 2654435761u + j * 40503u) % 1000003u));
+	}
+	for (size_t step = 1; step < k; step *= 2)
+		for (size_t i = 0; i + step < k; i += 2 * step) heaps[i]->meld(*heaps[i + step]);
+	long long retVal = 0;
+	for (size_t i = 0; i < m; i++) retVal += heaps[0]->extractTop();
+	for (size_t i = 0; i < k; i++) delete heaps[i];
+	return retVal;
+}
+
+/**
+ * @brief Function to merge k binary heaps of m random keys each by inserting the elements of one into the other
+ * @return @copydoc meldKernel
+ */
+static long long binaryMeldKernel(size_t k, size_t m)
+{
+	typedef heap<int,basic_heap_min_traits<int> > binaryHeap;
+	std::vector<binaryHeap*> heaps(k);
+	for (size_t i = 0; i < k; i++)
+	{
+		heaps[i] = new binaryHeap();
+		for (size_t j = 0; j < m; j++) heaps[i]->insert(int((i * 2654435761u + j * 40503u) % 1000003u));
+	}
+	for (size_t step = 1; step < k; step *= 2)
+		for (size_t i = 0; i + step < k; i += 2 * step)
+			while (0 != heaps[i + step]->getSize()) heaps[i]->insert(heaps[i + step]->extractTop());
+	long long retVal = 0;
+	for (size_t i = 0; i < m; i++) retVal += heaps[0]->extractTop();
+	for (size_t i = 0; i < k; i++) delete heaps[i];
+	return retVal;
+}
+
+/**
+ * @details Dijkstra is run from the same sources with the binary #heap, using lazy deletion, and with the meldable heaps, using
+ * decreaseKey. Then 1024 heaps of 256 keys are merged into one, by melds for the meldable heaps and by moving every element for the
+ * binary heap.
+ */
+int heapsBench(const std::vector<std::string>& args)
+{
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: heaps (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	std::vector<csrGraph::vertexId> sources;
+	for (size_t i = 0; i < 4 && 0 != n; i++) sources.push_back(csrGraph::vertexId((i * 7919) % n));
+	printf("Vertices %zu Slots %zu\n", n, in.csr.numSlots());
+	printf("%-16s %14s %14s %8s\n", "Heap", "Dijkstra(ms)", "Meld(ms)", "Check");
+	const char* names[] = {"binary heap", "pairing heap", "fibonacci heap"};
+	const size_t k = 1024, m = 256;
+	unsigned long long base = 0;
+	long long meldBase = 0;
+	for (size_t h = 0; h < 3; h++)
+	{
+		stopWatch watch;
+		unsigned long long result = 0;
+		for (size_t s = 0; s < sources.size(); s++)
+		{
+			if (0 == h) result += dijkstraBinary(in.csr, in.slotWeights, sources[s]);
+			else if (1 == h) result += dijkstraDecrease<pairingHeap<distEntry> >(in.csr, in.slotWeights, sources[s]);
+			else result += dijkstraDecrease<fibonacciHeap<distEntry> >(in.csr, in.slotWeights, sources[s]);
+		}
+		double dijkstraTime = watch.elapsedMs();
+		watch.restart();
+		long long meldResult = (0 == h) ? binaryMeldKernel(k, m) : (1 == h) ? meldKernel<pairingHeap<int> >(k, m) : meldKernel<fibonacciHeap<int> >(k, m);
+		double meldTime = watch.elapsedMs();
+		if (0 == h)
+		{
+			base = result;
+			meldBase = meldResult;
+		}
+		printf("%-16s %14.2f %14.2f %8s\n", names[h], dijkstraTime, meldTime, (result == base && meldResult == meldBase) ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,82 @@
+/**
+ *  @file GraphBench/src/labels.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the construction, the queries and the save and load of #hubLabeling.
+ */
+#include <GraphBench.hpp>
+#include <GraphLabeling.hpp>
+#include <GraphPointToPoint.hpp>
+#include <sstream>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details The weighted, unweighted and reachability labels are built in turn, reporting the construction time, the entries, the
+ * mean label and the size of the index, which is then saved to memory and loaded back. The loaded labels answer a million random
+ * source and target pairs, of which the first thousand are checked against Dijkstra stopping at the target, with unit weights for
+ * the unweighted and reachability labels, and the mean query time is compared with that of Dijkstra.
+ */
+int labelsBench(const std::vector<std::string>& args)
+{
+	typedef hubLabeling<int> labeling;
+	typedef graphPointToPoint<int> pointToPoint;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: labels (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	const size_t noOfQueries = 1000000, noOfChecks = 1000;
+	std::vector<std::pair<csrGraph::vertexId,csrGraph::vertexId> > queries;
+	unsigned long long state = 2015;
+	for (size_t i = 0; i < noOfQueries; i++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		csrGraph::vertexId s = csrGraph::vertexId((state >> 33) % n);
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		queries.push_back(std::make_pair(s, csrGraph::vertexId((state >> 33) % n)));
+	}
+	propertyMap<int> unit(in.csr.numSlots(), 1);
+	pointToPoint weighted(in.csr, in.slotWeights), unweighted(in.csr, unit);
+	printf("Vertices %zu Slots %zu\n", n, in.csr.numSlots());
+	printf("%-14s %10s %12s %8s %10s %10s %12s %10s %8s\n", "Labels", "Build(ms)", "Entries", "Mean", "Size(MB)", "Load(ms)", "Query(ns)",
+		"Speedup", "Check");
+	for (size_t kind = 0; kind < 3; kind++)
+	{
+		const char* names[] = {"weighted", "unweighted", "reachability"};
+		labeling built = (0 == kind) ? labeling(in.csr, in.slotWeights) : labeling(in.csr, (1 == kind) ? labeling::distances : labeling::reachability);
+		std::stringstream saved;
+		bool ok = built.save(saved);
+		labeling l;
+		stopWatch watch;
+		ok = ok && l.load(saved);
+		double load = watch.elapsedMs();
+		pointToPoint& p = (0 == kind) ? weighted : unweighted;
+		std::vector<long long> expected(noOfChecks);
+		watch.restart();
+		for (size_t q = 0; q < noOfChecks; q++) expected[q] = p.dijkstra(queries[q].first, queries[q].second);
+		double dijkstraTime = watch.elapsedMs() / noOfChecks;
+		size_t checksum = 0;
+		watch.restart();
+		if (2 == kind) for (size_t q = 0; q < noOfQueries; q++) checksum += l.reachable(queries[q].first, queries[q].second);
+		else for (size_t q = 0; q < noOfQueries; q++) checksum += l.distance(queries[q].first, queries[q].second);
+		double time = watch.elapsedMs() / noOfQueries;
+		for (size_t q = 0; q < noOfChecks; q++)
+		{
+			bool reached = (pointToPoint::unreachable() != expected[q]);
+			if (2 == kind) ok = ok && (reached == l.reachable(queries[q].first, queries[q].second));
+			else ok = ok && (reached ? expected[q] == (long long)l.distance(queries[q].first, queries[q].second)
+				: labeling::unreachable() == l.distance(queries[q].first, queries[q].second));
+		}
+		printf("%-14s %10.2f %12zu %8.2f %10.2f %10.2f %12.1f %9.0fx %8s\n", names[kind], built.buildSeconds() * 1000.0, l.numEntries(),
+			l.averageLabel(), l.indexBytes() / 1048576.0, load, time * 1e6, dijkstraTime / time, ok ? "ok" : "MISMATCH");
+		if (0 == checksum) printf("No pair connected\n");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,131 @@
+/**
+ *  @file GraphBench/src/main.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the entry point of the GraphBench application and the reading of its inputs.
+ */
+#include <GraphBench.hpp>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to build the graph out of a list of edges over ids 1..noOfNodes
+ * @param	noOfNodes	Number of vertices
+ * @param	edges		The edges as (start id, end id, weight)
+ * @param	in			The input to be filled
+ */
+static void buildInput(size_t noOfNodes, const std::vector<std::pair<std::pair<size_t,size_t>,int> >& edges, benchInput& in)
+{
+	in.idToDescriptorMap.assign(noOfNodes, Graph::vertexDescriptor());
+	for (size_t id = 1; id <= noOfNodes; id++) in.idToDescriptorMap[id-1] = in.g.addVertex(new GraphBench::node(id));
+	for (size_t i = 0; i < edges.size(); i++)
+		in.g.addEdge(in.idToDescriptorMap[edges[i].first.first-1], in.idToDescriptorMap[edges[i].first.second-1], new GraphBench::edge(edges[i].second));
+	in.csr = csrGraph(in.g);
+	in.weights = graphProperties<Graph>::edgeProperty(in.g, &GraphBench::edge::m_weight);
+	in.slotWeights = in.csr.slotProperty(in.weights);
+}
+
+bool readInput(const std::vector<std::string>& args, benchInput& in)
+{
+	std::vector<std::pair<std::pair<size_t,size_t>,int> > edges;
+	std::mt19937 rng(2015);
+	if (args.empty()) return false;
+	if ("grid" == args[0] || "random" == args[0])
+	{
+		if (("grid" == args[0] && args.size() < 2) || ("random" == args[0] && args.size() < 3)) return false;
+		size_t side = strtoul(args[1].c_str(), NULL, 10);
+		size_t noOfNodes = ("grid" == args[0]) ? side * side : side;
+		std::vector<size_t> id(noOfNodes);
+		for (size_t i = 0; i < noOfNodes; i++) id[i] = i + 1;
+		std::shuffle(id.begin(), id.end(), rng);
+		std::uniform_int_distribution<int> weight(1, 100);
+		if ("grid" == args[0])
+		{
+			for (size_t r = 0; r < side; r++)
+				for (size_t c = 0; c < side; c++)
+				{
+					if (c + 1 < side) edges.push_back(std::make_pair(std::make_pair(id[r*side+c], id[r*side+c+1]), weight(rng)));
+					if (r + 1 < side) edges.push_back(std::make_pair(std::make_pair(id[r*side+c], id[(r+1)*side+c]), weight(rng)));
+				}
+		}
+		else
+		{
+			size_t noOfEdges = strtoul(args[2].c_str(), NULL, 10);
+			std::uniform_int_distribution<size_t> pick(1, noOfNodes);
+			for (size_t i = 0; i < noOfEdges; i++) edges.push_back(std::make_pair(std::make_pair(pick(rng), pick(rng)), weight(rng)));
+		}
+		buildInput(noOfNodes, edges, in);
+		return true;
+	}
+	ifstream infile(args[0].c_str());
+	if (false == infile.good()) return false;
+	size_t noOfNodes, tempNodeStartVal, tempNodeEndVal;
+	int tempWeight;
+	infile >> noOfNodes;
+	while (infile >> tempNodeStartVal >> tempNodeEndVal >> tempWeight)
+		edges.push_back(std::make_pair(std::make_pair(tempNodeStartVal, tempNodeEndVal), tempWeight));
+	buildInput(noOfNodes, edges, in);
+	return true;
+}
+}
+
+/**
+ * @brief Main function to run the benchmarks
+ * @details The first argument selects the benchmark, the rest describe its input, see #GraphBench::readInput.@n
+ * @b Usage @n
+ * exec reorder (file | grid side | random n m) @n
+ * exec compress (file | grid side | random n m) @n
+ * exec versioned (file | grid side | random n m) @n
+ * exec heaps (file | grid side | random n m) @n
+ * exec multiqueue (file | grid side | random n m) @n
+ * exec sssp (file | grid side | random n m) @n
+ * exec p2p (file | grid side | random n m) @n
+ * exec ch (file | grid side | random n m) @n
+ * exec apsp (file | grid side | random n m) @n
+ * exec pagerank (file | grid side | random n m) @n
+ * exec triangles (file | grid side | random n m) @n
+ * exec cores (file | grid side | random n m) @n
+ * exec maxflow (dimacs file | file | grid side | random n m) @n
+ * exec mincut (file | grid side | random n m) @n
+ * exec matching (file | grid side | random n m) @n
+ * exec communities (file | grid side | random n m) @n
+ * exec partition (file | grid side | random n m) @n
+ * exec betweenness (file | grid side | random n m) @n
+ * exec labels (file | grid side | random n m) @n
+ */
+int main(int argc , char* argv[])
+{
+	std::vector<std::string> args(argv + 1, argv + argc);
+	if (false == args.empty())
+	{
+		std::string bench = args[0];
+		args.erase(args.begin());
+		if ("reorder" == bench) return GraphBench::reorderBench(args);
+		if ("compress" == bench) return GraphBench::compressBench(args);
+		if ("versioned" == bench) return GraphBench::versionedBench(args);
+		if ("heaps" == bench) return GraphBench::heapsBench(args);
+		if ("multiqueue" == bench) return GraphBench::multiQueueBench(args);
+		if ("sssp" == bench) return GraphBench::ssspBench(args);
+		if ("p2p" == bench) return GraphBench::p2pBench(args);
+		if ("ch" == bench) return GraphBench::chBench(args);
+		if ("apsp" == bench) return GraphBench::apspBench(args);
+		if ("pagerank" == bench) return GraphBench::pageRankBench(args);
+		if ("triangles" == bench) return GraphBench::trianglesBench(args);
+		if ("cores" == bench) return GraphBench::coresBench(args);
+		if ("maxflow" == bench) return GraphBench::maxFlowBench(args);
+		if ("mincut" == bench) return GraphBench::minCutBench(args);
+		if ("matching" == bench) return GraphBench::matchingBench(args);
+		if ("communities" == bench) return GraphBench::communitiesBench(args);
+		if ("partition" == bench) return GraphBench::partitionBench(args);
+		if ("betweenness" == bench) return GraphBench::betweennessBench(args);
+		if ("labels" == bench) return GraphBench::labelsBench(args);
+	}
+	cerr << "Usage: " << argv[0] << " (reorder | compress | versioned | heaps | multiqueue | sssp | p2p | ch | apsp | pagerank | triangles | cores | maxflow | mincut | matching | communities | partition | betweenness | labels) (file | grid side | random n m)" << endl;
+	return 1;
+}
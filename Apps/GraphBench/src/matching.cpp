@@ -0,0 +1,74 @@
+/**
+ *  @file GraphBench/src/matching.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the bipartite matching and assignment of #bipartiteMatching and #bipartiteAssignment.
+ */
+#include <GraphBench.hpp>
+#include <GraphMatching.hpp>
+#include <random>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details The input is turned into a bipartite graph with a left copy u and a right copy V + v of every vertex and an edge from u
+ * to V + v for every slot u->v, weighing the weight of the slot. Hopcroft-Karp and the Hungarian method are timed from scratch, and
+ * then a few rounds change the weights of 0.1% of the edges and time the repair from the last solution against solving again,
+ * checking that both give the same cost.
+ */
+int matchingBench(const std::vector<std::string>& args)
+{
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: matching (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	csrGraph g;
+	g.offsets.assign(2 * n + 1, in.csr.numSlots());
+	for (size_t v = 0; v <= n; v++) g.offsets[v] = in.csr.offsets[v];
+	g.targets.resize(in.csr.numSlots());
+	g.edgeIndex.resize(in.csr.numSlots());
+	propertyMap<long long> cost(in.csr.numSlots());
+	for (size_t slot = 0; slot < in.csr.numSlots(); slot++)
+	{
+		g.targets[slot] = csrGraph::vertexId(n + in.csr.targets[slot]);
+		g.edgeIndex[slot] = slot;
+		cost[slot] = in.slotWeights[slot];
+	}
+	stopWatch watch;
+	bipartiteMatching<> m(g);
+	size_t size = m.maximumMatching();
+	printf("Jobs %zu Machines %zu Edges %zu\n", n, n, g.numSlots());
+	printf("%-24s %12s %16s %10s %10s %8s\n", "Method", "Time(ms)", "Cost", "Pairs", "Searches", "Check");
+	printf("%-24s %12.2f %16s %10zu %10zu %8s\n", "hopcroft-karp", watch.elapsedMs(), "-", size, m.lastPhases(), "ok");
+	watch.restart();
+	bipartiteAssignment<long long> a(g, cost);
+	long long value = a.solve();
+	printf("%-24s %12.2f %16lld %10zu %10zu %8s\n", "hungarian", watch.elapsedMs(), value, a.size(), a.lastSearches(),
+			(a.size() == size) ? "ok" : "MISMATCH");
+	std::mt19937 rng(1);
+	for (size_t round = 0; round < 3 && g.numSlots() > 0; round++)
+	{
+		std::uniform_int_distribution<size_t> pick(0, g.numSlots() - 1);
+		std::uniform_int_distribution<int> weight(1, 100);
+		for (size_t i = 0; i < std::max<size_t>(1, g.numSlots() / 1000); i++) cost[pick(rng)] = weight(rng);
+		watch.restart();
+		a.update(g, cost);
+		value = a.solve();
+		double warm = watch.elapsedMs();
+		size_t searches = a.lastSearches();
+		watch.restart();
+		bipartiteAssignment<long long> fresh(g, cost);
+		long long expected = fresh.solve();
+		printf("%-24s %12.2f %16lld %10zu %10zu %8s\n", "hungarian update", warm, value, a.size(), searches,
+				(value == expected && a.size() == fresh.size()) ? "ok" : "MISMATCH");
+		printf("%-24s %12.2f %16lld %10zu %10zu %8s\n", "hungarian from scratch", watch.elapsedMs(), expected, fresh.size(),
+				fresh.lastSearches(), "ok");
+	}
+	return 0;
+}
+}
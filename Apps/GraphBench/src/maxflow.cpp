@@ -0,0 +1,127 @@
+/**
+ *  @file GraphBench/src/maxflow.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the maximum flow algorithms of #graphMaxFlow.
+ */
+#include <GraphBench.hpp>
+#include <GraphFlow.hpp>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to read a maximum flow instance in the DIMACS format
+ * @details The lines are "p max n m", "n id s", "n id t" and "a u v capacity" with 1 based ids, and the lines starting with c are
+ * comments.
+ * @return false if the file cannot be read or has no problem line, terminals or valid arcs
+ */
+static bool readDimacs(const std::string& fileName, csrGraph& g, propertyMap<long long>& c, csrGraph::vertexId& s, csrGraph::vertexId& t)
+{
+	std::ifstream in(fileName.c_str());
+	std::string line;
+	size_t n = 0;
+	bool haveSource = false, haveSink = false;
+	std::vector<std::pair<size_t,size_t> > arcs;
+	std::vector<long long> capacities;
+	while (std::getline(in, line))
+	{
+		std::istringstream fields(line);
+		std::string kind;
+		fields >> kind;
+		if ("p" == kind)
+		{
+			std::string problem;
+			size_t m = 0;
+			if (!(fields >> problem >> n >> m) || "max" != problem) return false;
+		}
+		else if ("n" == kind)
+		{
+			size_t id = 0;
+			std::string which;
+			if (!(fields >> id >> which) || 0 == id || id > n) return false;
+			if ("s" == which) {s = csrGraph::vertexId(id - 1); haveSource = true;}
+			else if ("t" == which) {t = csrGraph::vertexId(id - 1); haveSink = true;}
+		}
+		else if ("a" == kind)
+		{
+			size_t u = 0, v = 0;
+			long long capacity = 0;
+			if (!(fields >> u >> v >> capacity) || 0 == u || 0 == v || u > n || v > n || capacity < 0) return false;
+			arcs.push_back(std::make_pair(u - 1, v - 1));
+			capacities.push_back(capacity);
+		}
+	}
+	if (0 == n || false == haveSource || false == haveSink) return false;
+	g.offsets.assign(n + 1, 0);
+	for (size_t i = 0; i < arcs.size(); i++) g.offsets[arcs[i].first + 1]++;
+	for (size_t i = 0; i < n; i++) g.offsets[i+1] += g.offsets[i];
+	g.targets.resize(arcs.size());
+	g.edgeIndex.resize(arcs.size());
+	c = propertyMap<long long>(arcs.size());
+	std::vector<size_t> next(g.offsets.begin(), g.offsets.end() - 1);
+	for (size_t i = 0; i < arcs.size(); i++)
+	{
+		size_t slot = next[arcs[i].first]++;
+		g.targets[slot] = csrGraph::vertexId(arcs[i].second);
+		g.edgeIndex[slot] = i;
+		c[slot] = capacities[i];
+	}
+	return true;
+}
+
+/**
+ * @details The input is either "dimacs file" for an instance in the DIMACS format, or any other input with its weights as
+ * capacities, from vertex 0 to the last vertex. Dinic and push-relabel are timed and checked against each other and against the
+ * capacity of the cut they give.
+ */
+int maxFlowBench(const std::vector<std::string>& args)
+{
+	typedef graphMaxFlow<long long> maxFlow;
+	csrGraph g;
+	propertyMap<long long> c;
+	csrGraph::vertexId s = 0, t = 0;
+	benchInput in;
+	if (2 == args.size() && "dimacs" == args[0])
+	{
+		if (false == readDimacs(args[1], g, c, s, t))
+		{
+			cerr << "Cannot read the DIMACS instance " << args[1] << endl;
+			return 1;
+		}
+	}
+	else if (true == readInput(args, in))
+	{
+		g = in.csr;
+		c = propertyMap<long long>(in.slotWeights.size());
+		for (size_t slot = 0; slot < c.size(); slot++) c[slot] = in.slotWeights[slot];
+		t = csrGraph::vertexId(g.numVertices() - (g.numVertices() > 0));
+	}
+	else
+	{
+		cerr << "Usage: maxflow (dimacs file | file | grid side | random n m)" << endl;
+		return 1;
+	}
+	stopWatch watch;
+	maxFlow f(g, c);
+	printf("Vertices %zu Arcs %zu Source %u Sink %u Setup(ms) %.2f\n", g.numVertices(), f.numArcs(), s + 1, t + 1, watch.elapsedMs());
+	printf("%-16s %12s %16s %8s\n", "Method", "Time(ms)", "Flow", "Check");
+	long long expected = 0;
+	for (size_t method = 0; method < 2; method++)
+	{
+		watch.restart();
+		long long value = (0 == method) ? f.dinic(s, t) : f.pushRelabel(s, t);
+		double time = watch.elapsedMs();
+		if (0 == method) expected = value;
+		std::vector<size_t> cut = f.cutSlots(s);
+		long long capacity = 0;
+		for (size_t i = 0; i < cut.size(); i++) capacity += c[cut[i]];
+		printf("%-16s %12.2f %16lld %8s\n", (0 == method) ? "dinic" : "push-relabel", time, value,
+				(value == expected && capacity == value) ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,61 @@
+/**
+ *  @file GraphBench/src/mincut.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the global minimum cut algorithms of #graphMinCut.
+ */
+#include <GraphBench.hpp>
+#include <GraphMinCut.hpp>
+#include <thread>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details Nagamochi-Ibaraki contraction is timed and checked against the weight of the side it gives, and then Stoer-Wagner on
+ * graphs of up to 5000 vertices and Karger-Stein with a fixed number of trials on 1, 2, 4, ... threads up to twice the hardware
+ * threads on graphs of up to 500 vertices, both checked against it.
+ */
+int minCutBench(const std::vector<std::string>& args)
+{
+	typedef graphMinCut<long long> minCut;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: mincut (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	propertyMap<long long> w(in.slotWeights.size());
+	for (size_t slot = 0; slot < w.size(); slot++) w[slot] = in.slotWeights[slot];
+	stopWatch watch;
+	minCut c(in.csr, w);
+	printf("Vertices %zu Edges %zu Hardware threads %u Setup(ms) %.2f\n", n, c.numEdges(), hardware, watch.elapsedMs());
+	printf("%-20s %-8s %12s %16s %10s %8s\n", "Method", "Threads", "Time(ms)", "Cut", "Side", "Check");
+	std::vector<csrGraph::vertexId> side;
+	std::vector<bool> onSide(n, false);
+	long long expected = 0;
+	for (size_t method = 0; method < 3; method++)
+	{
+		if ((1 == method && n > 5000) || (2 == method && n > 500)) continue;
+		for (size_t p = 1; p <= ((2 == method) ? 2 * hardware : 1); p *= 2)
+		{
+			watch.restart();
+			long long value = (0 == method) ? c.nagamochiIbaraki(&side) : (1 == method) ? c.stoerWagner(&side) : c.kargerStein(16, p, 1, &side);
+			double time = watch.elapsedMs();
+			if (0 == method) expected = value;
+			onSide.assign(n, false);
+			for (size_t i = 0; i < side.size(); i++) onSide[side[i]] = true;
+			long long weight = 0;
+			for (csrGraph::vertexId u = 0; u < n; u++)
+				for (size_t slot = in.csr.offsets[u]; slot < in.csr.offsets[u+1]; slot++)
+					if (true == onSide[u] && false == onSide[in.csr.targets[slot]]) weight += w[slot];
+			printf("%-20s %-8zu %12.2f %16lld %10zu %8s\n", (0 == method) ? "nagamochi-ibaraki" : (1 == method) ? "stoer-wagner" : "karger-stein",
+					p, time, value, side.size(), (value == expected && weight == value) ? "ok" : "MISMATCH");
+		}
+	}
+	return 0;
+}
+}
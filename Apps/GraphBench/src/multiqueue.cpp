@@ -0,0 +1,242 @@
+/**
+ *  @file GraphBench/src/multiqueue.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the relaxed concurrent priority queue #multiQueue against a binary #heap behind a
+ *  single lock.
+ */
+#include <GraphBench.hpp>
+#include <MultiQueue.hpp>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Binary #heap behind a single lock, with the interface of #multiQueue
+ */
+template <class T>
+class lockedHeap
+{
+	std::mutex m_lock;	///< Member to hold the lock of the heap
+	heap<T,basic_heap_min_traits<T>,noStats> m_heap;	///< Member to hold the heap
+public:
+	///@brief Member function to insert a node
+	void insert(T node)
+	{
+		std::lock_guard<std::mutex> guard(m_lock);
+		m_heap.insert(node);
+	}
+	///@brief Member function to extract the top node, returning false if the heap is empty
+	bool tryExtractTop(T& node)
+	{
+		std::lock_guard<std::mutex> guard(m_lock);
+		if (0 == m_heap.getSize()) return false;
+		node = m_heap.extractTop();
+		return true;
+	}
+};
+
+/**
+ * @brief Tentative distance of a vertex, as kept in the queues
+ */
+struct queuedDistance
+{
+	unsigned long long dist;	///< Member to hold the tentative distance
+	csrGraph::vertexId v;	///< Member to hold the vertex
+	///@brief Member function to get the key required by heap.
+	static unsigned long long getKey(queuedDistance& a) {return a.dist;}
+};
+
+/**
+ * @brief Function to run the hold model on a queue: every operation extracts a key and inserts a new random one
+ * @param	q			The queue, already filled
+ * @param	seed		Seed of the keys of this thread
+ * @param	noOfOperations	Number of extract and insert pairs
+ */
+template <class queueType>
+static void holdLoop(queueType& q, unsigned int seed, size_t noOfOperations)
+{
+	unsigned int state = seed;
+	for (size_t i = 0; i < noOfOperations; i++)
+	{
+		int key;
+		q.tryExtractTop(key);
+		state = state * 1664525u + 1013904223u;
+		q.insert(int(state >> 12));
+	}
+}
+
+/**
+ * @brief Function to time the hold model over several threads
+ * @return Millions of extract and insert pairs per second
+ */
+template <class queueType>
+static double holdThroughput(queueType& q, size_t noOfThreads, size_t noOfOperations)
+{
+	unsigned int state = 2015;
+	for (size_t i = 0; i < 100000; i++)
+	{
+		state = state * 1664525u + 1013904223u;
+		q.insert(int(state >> 12));
+	}
+	stopWatch watch;
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < noOfThreads; t++) threads.push_back(std::thread(holdLoop<queueType>, std::ref(q), unsigned(t + 1), noOfOperations));
+	for (size_t t = 0; t < noOfThreads; t++) threads[t].join();
+	return double(noOfThreads * noOfOperations) / watch.elapsedMs() / 1000.0;
+}
+
+/**
+ * @brief Function to measure the rank error of the hold model on one thread
+ * @details The rank of an extracted key is the number of keys left in the queue which are strictly smaller, counted with a Fenwick
+ * tree over the 20 bit keys. An exact priority queue always has rank 0.
+ * @return Mean rank of the extracted keys
+ */
+template <class queueType>
+static double holdRankError(queueType& q, size_t noOfOperations)
+{
+	const size_t range = size_t(1) << 20;
+	std::vector<size_t> fenwick(range + 1, 0);
+	size_t totalRank = 0;
+	unsigned int state = 2015;
+	for (size_t i = 0; i < 100000 + noOfOperations; i++)
+	{
+		int key = 0;
+		if (i >= 100000 && true == q.tryExtractTop(key))
+		{
+			for (size_t k = size_t(key); k > 0; k -= k & (0 - k)) totalRank += fenwick[k];
+			for (size_t k = size_t(key) + 1; k <= range; k += k & (0 - k)) fenwick[k]--;
+		}
+		state = state * 1664525u + 1013904223u;
+		key = int(state >> 12);
+		q.insert(key);
+		for (size_t k = size_t(key) + 1; k <= range; k += k & (0 - k)) fenwick[k]++;
+	}
+	return double(totalRank) / noOfOperations;
+}
+
+/**
+ * @brief Function run by every thread of the label correcting shortest paths
+ * @details Nodes are extracted in relaxed order, so a vertex may be settled with a too large distance and improved later. pending
+ * counts the nodes inserted and not yet processed, the search is over when it drops to zero.
+ */
+template <class queueType>
+static void ssspLoop(const csrGraph& g, const propertyMap<int>& weights, queueType& q, std::vector<std::atomic<unsigned long long> >& dist,
+		std::atomic<size_t>& pending, std::atomic<size_t>& processed)
+{
+	size_t local = 0;
+	while (0 != pending.load())
+	{
+		queuedDistance top;
+		if (false == q.tryExtractTop(top)) continue;
+		if (top.dist == dist[top.v].load())
+		{
+			local++;
+			for (size_t slot = g.offsets[top.v]; slot < g.offsets[top.v + 1]; slot++)
+			{
+				queuedDistance next = {top.dist + weights[slot], g.targets[slot]};
+				unsigned long long old = dist[next.v].load();
+				while (next.dist < old && false == dist[next.v].compare_exchange_weak(old, next.dist));
+				if (next.dist >= old) continue;
+				pending.fetch_add(1);
+				q.insert(next);
+			}
+		}
+		pending.fetch_sub(1);
+	}
+	processed.fetch_add(local);
+}
+
+/**
+ * @brief Function to run the label correcting shortest paths from a source over several threads
+ * @param	processed	Output, number of vertices whose edges were relaxed, equal to the reached vertices for an exact queue
+ * @return Sum of the distances of the reached vertices
+ */
+template <class queueType>
+static unsigned long long parallelShortestPaths(const csrGraph& g, const propertyMap<int>& weights, csrGraph::vertexId source, queueType& q,
+		size_t noOfThreads, size_t& processed)
+{
+	std::vector<std::atomic<unsigned long long> > dist(g.numVertices());
+	for (size_t v = 0; v < g.numVertices(); v++) dist[v].store(~0ULL);
+	std::atomic<size_t> pending(1), relaxed(0);
+	dist[source].store(0);
+	queuedDistance s = {0, source};
+	q.insert(s);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < noOfThreads; t++)
+		threads.push_back(std::thread(ssspLoop<queueType>, std::cref(g), std::cref(weights), std::ref(q), std::ref(dist), std::ref(pending), std::ref(relaxed)));
+	for (size_t t = 0; t < noOfThreads; t++) threads[t].join();
+	unsigned long long retVal = 0;
+	for (size_t v = 0; v < g.numVertices(); v++) if (~0ULL != dist[v].load()) retVal += dist[v].load();
+	processed = relaxed.load();
+	return retVal;
+}
+
+/**
+ * @details For 1, 2, 4, ... threads up to the number of hardware threads (at least 2), the locked heap and #multiQueue with c = 2 and
+ * c = 4 are timed on the hold model, with the mean rank error measured separately on one thread with the same number of internal
+ * heaps, and then used for label correcting shortest paths on the input. The extra vertex relaxations over an exact queue show
+ * what the rank error costs an algorithm.
+ */
+int multiQueueBench(const std::vector<std::string>& args)
+{
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: multiqueue (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	if (0 == in.csr.numVertices()) return 0;
+	size_t maxThreads = std::max(2u, std::thread::hardware_concurrency());
+	printf("Vertices %zu Slots %zu Hardware threads %u\n", in.csr.numVertices(), in.csr.numSlots(), std::thread::hardware_concurrency());
+	printf("%-8s %-16s %12s %12s %12s %12s %8s\n", "Threads", "Queue", "Hold(Mop/s)", "Rank error", "SSSP(ms)", "Relaxed", "Check");
+	size_t exactProcessed = 0;
+	unsigned long long base = 0;
+	{
+		lockedHeap<queuedDistance> q;
+		base = parallelShortestPaths(in.csr, in.slotWeights, 0, q, 1, exactProcessed);
+	}
+	const size_t noOfOperations = 200000;
+	for (size_t p = 1; p <= maxThreads; p *= 2)
+		for (size_t c = 0; c <= 4; c += 2)
+		{
+			double throughput, rankError;
+			if (0 == c)
+			{
+				lockedHeap<int> hold, quality;
+				throughput = holdThroughput(hold, p, noOfOperations / p);
+				rankError = holdRankError(quality, noOfOperations);
+			}
+			else
+			{
+				multiQueue<int> hold(p, c), quality(p, c);
+				throughput = holdThroughput(hold, p, noOfOperations / p);
+				rankError = holdRankError(quality, noOfOperations);
+			}
+			size_t processed = 0;
+			unsigned long long result;
+			stopWatch watch;
+			if (0 == c)
+			{
+				lockedHeap<queuedDistance> q;
+				result = parallelShortestPaths(in.csr, in.slotWeights, 0, q, p, processed);
+			}
+			else
+			{
+				multiQueue<queuedDistance> q(p, c);
+				result = parallelShortestPaths(in.csr, in.slotWeights, 0, q, p, processed);
+			}
+			double time = watch.elapsedMs();
+			char name[32];
+			if (0 == c) snprintf(name, sizeof(name), "locked heap");
+			else snprintf(name, sizeof(name), "multiqueue c=%zu", c);
+			printf("%-8zu %-16s %12.2f %12.2f %12.2f %11.2fx %8s\n", p, name, throughput, rankError, time,
+					(0 == exactProcessed) ? 1.0 : double(processed) / exactProcessed, (result == base) ? "ok" : "MISMATCH");
+		}
+	return 0;
+}
+}
@@ -0,0 +1,78 @@
+/**
+ *  @file GraphBench/src/p2p.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the point to point queries of #graphPointToPoint.
+ */
+#include <GraphBench.hpp>
+#include <GraphPointToPoint.hpp>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details The same random source and target pairs are answered by Dijkstra stopping at the target, bidirectional Dijkstra and
+ * ALT with 4, 8 and 16 landmarks picked by farthest and by avoid. For every method the time to pick the landmarks, the mean query
+ * time, the mean number of settled vertices and the speedup over Dijkstra are reported, and the distances must agree with Dijkstra.
+ */
+int p2pBench(const std::vector<std::string>& args)
+{
+	typedef graphPointToPoint<int> pointToPoint;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: p2p (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	const size_t noOfQueries = 200;
+	std::vector<std::pair<csrGraph::vertexId,csrGraph::vertexId> > queries;
+	unsigned long long state = 2015;
+	for (size_t i = 0; i < noOfQueries; i++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		csrGraph::vertexId s = csrGraph::vertexId((state >> 33) % n);
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		queries.push_back(std::make_pair(s, csrGraph::vertexId((state >> 33) % n)));
+	}
+	pointToPoint p(in.csr, in.slotWeights);
+	printf("Vertices %zu Slots %zu Queries %zu\n", n, in.csr.numSlots(), noOfQueries);
+	printf("%-16s %14s %12s %12s %10s %8s\n", "Method", "Landmarks(ms)", "Query(us)", "Settled", "Speedup", "Check");
+	std::vector<long long> expected(noOfQueries);
+	double dijkstraTime = 0;
+	for (size_t method = 0; method < 8; method++)
+	{
+		char name[32];
+		double preprocess = 0;
+		stopWatch watch;
+		if (method >= 2)
+		{
+			size_t k = size_t(4) << ((method - 2) % 3);
+			pointToPoint::landmarkSelection selection = (method < 5) ? pointToPoint::farthest : pointToPoint::avoid;
+			p.selectLandmarks(k, selection);
+			preprocess = watch.elapsedMs();
+			snprintf(name, sizeof(name), "alt %s %zu", (method < 5) ? "farthest" : "avoid", k);
+		}
+		else snprintf(name, sizeof(name), (0 == method) ? "dijkstra" : "bidirectional");
+		size_t settled = 0;
+		bool ok = true;
+		watch.restart();
+		for (size_t q = 0; q < noOfQueries; q++)
+		{
+			long long d;
+			if (0 == method) d = expected[q] = p.dijkstra(queries[q].first, queries[q].second);
+			else if (1 == method) d = p.bidirectional(queries[q].first, queries[q].second);
+			else d = p.alt(queries[q].first, queries[q].second);
+			ok = ok && (d == expected[q]);
+			settled += p.lastSettled();
+		}
+		double time = watch.elapsedMs();
+		if (0 == method) dijkstraTime = time;
+		printf("%-16s %14.2f %12.2f %12.1f %9.2fx %8s\n", name, preprocess, time * 1000.0 / noOfQueries, double(settled) / noOfQueries,
+				dijkstraTime / time, ok ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,125 @@
+/**
+ *  @file GraphBench/src/pagerank.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the PageRank variants of #graphPageRank.
+ */
+#include <GraphBench.hpp>
+#include <GraphPageRank.hpp>
+#include <thread>
+#include <cmath>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to compute the PageRank personalized to one seed by power iteration over the whole graph, to an L1 tolerance
+ * @details Dangling vertices jump to the seed, as in #graphPageRank::personalized.
+ */
+static std::vector<double> personalizedPower(const csrGraph& g, csrGraph::vertexId seed, double damping, double tolerance)
+{
+	size_t n = g.numVertices();
+	std::vector<double> retVal(n, 0), next(n);
+	retVal[seed] = 1;
+	for (size_t iteration = 0; iteration < 1000; iteration++)
+	{
+		next.assign(n, 0);
+		next[seed] = 1 - damping;
+		for (csrGraph::vertexId u = 0; u < n; u++)
+		{
+			if (0 == g.degree(u))
+			{
+				next[seed] += damping * retVal[u];
+				continue;
+			}
+			double share = damping * retVal[u] / g.degree(u);
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++) next[g.targets[slot]] += share;
+		}
+		double change = 0;
+		for (size_t v = 0; v < n; v++) change += std::fabs(next[v] - retVal[v]);
+		retVal.swap(next);
+		if (change < tolerance) break;
+	}
+	return retVal;
+}
+
+/**
+ * @details Pull iteration is timed on 1, 2, 4, ... threads up to twice the hardware threads and Gauss-Seidel on one, all to an L1
+ * tolerance of 1e-9, and checked against pull iteration on one thread. Then personalized PageRank answers queries from single
+ * random seeds by forward push for a few values of epsilon, and by power iteration over the whole graph to an L1 tolerance of
+ * 1e-9 as the baseline. The average latency, the pushes and the L1 error against power iteration are reported, and the check
+ * holds when the error is within the residual the push leaves.
+ */
+int pageRankBench(const std::vector<std::string>& args)
+{
+	typedef graphPageRank<> pageRank;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: pagerank (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	stopWatch watch;
+	pageRank pr(in.csr);
+	printf("Vertices %zu Slots %zu Hardware threads %u Setup(ms) %.2f\n", n, in.csr.numSlots(), hardware, watch.elapsedMs());
+	printf("%-16s %-8s %12s %12s %12s %8s\n", "Method", "Threads", "Time(ms)", "Speedup", "Iterations", "Check");
+	pageRank::rankMap expected;
+	double oneThread = 0;
+	for (size_t p = 1; p <= 2 * hardware + 1; p = (p == 2 * hardware) ? p + 1 : p * 2)
+	{
+		bool sweeps = (p > 2 * hardware);
+		watch.restart();
+		pageRank::rankMap rank = (true == sweeps) ? pr.gaussSeidel(0.85, 1e-9, 1000) : pr.pageRank(0.85, 1e-9, 1000, p);
+		double time = watch.elapsedMs();
+		if (1 == p)
+		{
+			oneThread = time;
+			expected = rank;
+		}
+		double error = 0;
+		for (size_t v = 0; v < n; v++) error += std::fabs(rank[v] - expected[v]);
+		printf("%-16s %-8zu %12.2f %11.2fx %12zu %8s\n", sweeps ? "gauss-seidel" : "pull", sweeps ? 1 : p, time, oneThread / time,
+				pr.lastIterations(), (error < 1e-7) ? "ok" : "MISMATCH");
+	}
+	const size_t queries = 50;
+	std::vector<csrGraph::vertexId> seeds(queries);
+	unsigned long long state = 2041;
+	for (size_t q = 0; q < queries; q++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		seeds[q] = csrGraph::vertexId((state >> 33) % n);
+	}
+	std::vector<std::vector<double> > exact(queries);
+	watch.restart();
+	for (size_t q = 0; q < queries; q++) exact[q] = personalizedPower(in.csr, seeds[q], 0.85, 1e-9);
+	printf("%-16s %-8s %12s %12s %12s %8s\n", "Personalized", "Epsilon", "Time(ms)", "Pushes", "L1 error", "Check");
+	printf("%-16s %-8s %12.3f %12s %12s %8s\n", "power", "-", watch.elapsedMs() / queries, "-", "-", "-");
+	const double epsilons[] = {1e-4, 1e-5, 1e-6};
+	for (size_t e = 0; e < sizeof(epsilons) / sizeof(epsilons[0]); e++)
+	{
+		size_t pushes = 0;
+		double time = 0, error = 0;
+		bool ok = true;
+		for (size_t q = 0; q < queries; q++)
+		{
+			watch.restart();
+			pageRank::sparseRanks ppr = pr.personalized(std::vector<csrGraph::vertexId>(1, seeds[q]), 0.85, epsilons[e]);
+			time += watch.elapsedMs();
+			pushes += pr.lastIterations();
+			std::vector<double> estimate(n, 0);
+			for (size_t i = 0; i < ppr.size(); i++) estimate[ppr[i].first] = ppr[i].second;
+			double l1 = 0;
+			for (size_t v = 0; v < n; v++) l1 += std::fabs(estimate[v] - exact[q][v]);
+			error += l1;
+			ok = ok && (l1 <= pr.lastResidual() + 1e-8);
+		}
+		printf("%-16s %-8.0e %12.3f %12zu %12.2e %8s\n", "push", epsilons[e], time / queries, pushes / queries, error / queries,
+				ok ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,62 @@
+/**
+ *  @file GraphBench/src/partition.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the multilevel k-way partitioning of #graphPartition.
+ */
+#include <GraphBench.hpp>
+#include <GraphPartition.hpp>
+#include <sstream>
+#include <algorithm>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details The weighted graph is partitioned into 2, 4, 8, ... 64 parts with 3% imbalance, next to one breadth first search of the
+ * whole graph, and the cut is set against the cut of assigning the vertices to the parts round robin, as hashing them would. The
+ * size of the saved subgraphs of the parts follows.
+ */
+int partitionBench(const std::vector<std::string>& args)
+{
+	typedef graphPartition<> partitioner;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: partition (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	stopWatch watch;
+	partitioner p(in.csr, in.slotWeights);
+	printf("Vertices %zu Edges %zu Setup(ms) %.2f\n", n, p.numEdges(), watch.elapsedMs());
+	watch.restart();
+	size_t depths = breadthFirstKernel(in.csr, std::vector<csrGraph::vertexId>(1, 0));
+	double pass = watch.elapsedMs();
+	printf("%-8s %8s %12s %12s %14s %14s %10s %10s %12s\n", "Parts", "Levels", "Time(ms)", "vs BFS", "Cut", "Hashed cut", "Largest", "Allowed",
+		"Saved(KB)");
+	printf("%-8s %8s %12.2f %11.2fx %14s %14s %10s %10s %12s\n", "bfs", "-", pass, 1.0, (depths > 0 || n == 1) ? "ok" : "-", "-", "-", "-", "-");
+	for (size_t k = 2; k <= 64; k *= 2)
+	{
+		size_t levels = 0;
+		watch.restart();
+		partitioner::partitionMap part = p.partition(k, 0.03, 1, &levels);
+		double time = watch.elapsedMs();
+		partitioner::partitionMap hashed(n);
+		for (size_t v = 0; v < n; v++) hashed[v] = csrGraph::vertexId(v % k);
+		std::vector<size_t> sizes = p.partSizes(part, k);
+		size_t bytes = 0;
+		for (size_t which = 0; which < k; which++)
+		{
+			std::stringstream saved;
+			p.savePart(saved, part, k, which);
+			bytes += saved.str().size();
+		}
+		printf("%-8zu %8zu %12.2f %11.2fx %14lld %14lld %10zu %10zu %12.1f\n", k, levels, time, time / pass, p.edgeCut(part), p.edgeCut(hashed),
+			*std::max_element(sizes.begin(), sizes.end()), p.maxPartSize(k, 0.03), double(bytes) / 1024);
+	}
+	return 0;
+}
+}
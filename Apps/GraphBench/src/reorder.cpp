@@ -0,0 +1,112 @@
+/**
+ *  @file GraphBench/src/reorder.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the vertex orderings of #graphReorder.
+ */
+#include <GraphBench.hpp>
+#include <GraphReorder.hpp>
+#include <cstdio>
+#include <cmath>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to run sweeps which pull a value from every neighbor, the access pattern of PageRank style algorithms
+ * @return Sum of the final values, to keep the work from being optimized away
+ */
+static double pullKernel(const csrGraph& g, const propertyMap<int>& slotWeights, size_t sweeps)
+{
+	std::vector<double> x(g.numVertices(), 1.0), y(g.numVertices());
+	for (size_t i = 0; i < sweeps; i++)
+	{
+		for (csrGraph::vertexId v = 0; v < g.numVertices(); v++)
+		{
+			double sum = 0;
+			for (size_t slot = g.offsets[v]; slot < g.offsets[v+1]; slot++) sum += x[g.targets[slot]] * slotWeights[slot];
+			y[v] = sum / (1.0 + 100.0 * g.degree(v));
+		}
+		x.swap(y);
+	}
+	double retVal = 0;
+	for (size_t v = 0; v < x.size(); v++) retVal += x[v];
+	return retVal;
+}
+
+///@brief Function to get the average log2 distance between the ids of the two ends of every slot, lower means better locality
+static double averageGap(const csrGraph& g)
+{
+	double sum = 0;
+	for (csrGraph::vertexId v = 0; v < g.numVertices(); v++)
+		for (const csrGraph::vertexId* u = g.neighborBegin(v); u != g.neighborEnd(v); u++)
+			sum += std::log2(1.0 + std::fabs(double(*u) - double(v)));
+	return (0 == g.numSlots()) ? 0 : sum / g.numSlots();
+}
+
+/**
+ * @details Every ordering is computed on the CSR of the input, applied, and then the same sources are searched and the same
+ * sweeps are run on the relabeled CSR. The sources are mapped through the permutation so every ordering does identical work,
+ * which is checked by comparing the results with the ones of the original ordering.
+ */
+int reorderBench(const std::vector<std::string>& args)
+{
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: reorder (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	const size_t noOfSources = 8, sweeps = 10;
+	std::vector<csrGraph::vertexId> sources;
+	for (size_t i = 0; i < noOfSources && 0 != in.csr.numVertices(); i++)
+		sources.push_back(csrGraph::vertexId((i * 7919) % in.csr.numVertices()));
+	printf("Vertices %zu Slots %zu\n", in.csr.numVertices(), in.csr.numSlots());
+	printf("%-10s %10s %10s %10s %10s %10s %8s\n", "Ordering", "Build(ms)", "Gap(log2)", "BFS(ms)", "Pull(ms)", "Speedup", "Check");
+	const char* names[] = {"original", "rcm", "degree", "bfs", "dfs", "gorder"};
+	double baseTime = 0;
+	size_t baseDepth = 0;
+	double basePull = 0;
+	for (size_t o = 0; o < sizeof(names)/sizeof(names[0]); o++)
+	{
+		stopWatch watch;
+		vertexPermutation p;
+		switch (o)
+		{
+		case 1: p = graphReorder::reverseCuthillMcKee(in.csr); break;
+		case 2: p = graphReorder::degreeSort(in.csr); break;
+		case 3: p = graphReorder::breadthFirstOrder(in.csr); break;
+		case 4: p = graphReorder::depthFirstOrder(in.csr); break;
+		case 5: p = graphReorder::gorder(in.csr); break;
+		default:
+		{
+			std::vector<csrGraph::vertexId> identity(in.csr.numVertices());
+			for (size_t v = 0; v < identity.size(); v++) identity[v] = csrGraph::vertexId(v);
+			p = vertexPermutation(identity);
+		}
+		break;
+		}
+		csrGraph g = graphReorder::apply(in.csr, p);
+		propertyMap<int> slotWeights = g.slotProperty(in.weights);
+		double buildTime = watch.elapsedMs();
+		std::vector<csrGraph::vertexId> mappedSources(sources.size());
+		for (size_t i = 0; i < sources.size(); i++) mappedSources[i] = p.newIndex[sources[i]];
+		watch.restart();
+		size_t depth = breadthFirstKernel(g, mappedSources);
+		double bfsTime = watch.elapsedMs();
+		watch.restart();
+		double pull = pullKernel(g, slotWeights, sweeps);
+		double pullTime = watch.elapsedMs();
+		if (0 == o)
+		{
+			baseTime = bfsTime + pullTime;
+			baseDepth = depth;
+			basePull = pull;
+		}
+		bool same = (depth == baseDepth) && (std::fabs(pull - basePull) <= 1e-6 * std::fabs(basePull));
+		printf("%-10s %10.2f %10.2f %10.2f %10.2f %10.2f %8s\n", names[o], buildTime, averageGap(g), bfsTime, pullTime,
+				baseTime / (bfsTime + pullTime), same ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
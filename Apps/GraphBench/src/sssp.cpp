@@ -0,0 +1,59 @@
+/**
+ *  @file GraphBench/src/sssp.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the strong scaling benchmark of the delta-stepping shortest paths of #graphShortestPath.
+ */
+#include <GraphBench.hpp>
+#include <GraphShortestPath.hpp>
+#include <thread>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details Dijkstra gives the reference time and distances. The bucket width is tuned once with #graphShortestPath::tuneDelta on
+ * one thread, and delta-stepping is then timed from the same sources on 1, 2, 4, ... threads up to twice the hardware threads,
+ * reporting the speedup over one thread and over Dijkstra.
+ */
+int ssspBench(const std::vector<std::string>& args)
+{
+	typedef graphShortestPath<int> shortestPath;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: sssp (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	size_t n = in.csr.numVertices();
+	if (0 == n) return 0;
+	std::vector<csrGraph::vertexId> sources;
+	for (size_t i = 0; i < 4; i++) sources.push_back(csrGraph::vertexId((i * 7919) % n));
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	printf("Vertices %zu Slots %zu Hardware threads %u\n", n, in.csr.numSlots(), hardware);
+	std::vector<shortestPath::distanceMap> expected;
+	stopWatch watch;
+	for (size_t s = 0; s < sources.size(); s++) expected.push_back(shortestPath::dijkstra(in.csr, in.slotWeights, sources[s]));
+	double dijkstraTime = watch.elapsedMs();
+	int suggested = shortestPath::suggestDelta(in.csr, in.slotWeights);
+	int delta = shortestPath::tuneDelta(in.csr, in.slotWeights, sources[0]);
+	printf("Dijkstra %.2f ms, delta suggested %d tuned %d\n", dijkstraTime, suggested, delta);
+	printf("%-8s %12s %12s %12s %8s\n", "Threads", "Time(ms)", "Speedup", "vs Dijkstra", "Check");
+	double oneThread = 0;
+	for (size_t p = 1; p <= 2 * hardware; p *= 2)
+	{
+		bool ok = true;
+		watch.restart();
+		for (size_t s = 0; s < sources.size(); s++)
+		{
+			shortestPath::distanceMap dist = shortestPath::deltaStepping(in.csr, in.slotWeights, sources[s], p, delta);
+			for (size_t v = 0; v < n; v++) ok = ok && (dist[v] == expected[s][v]);
+		}
+		double time = watch.elapsedMs();
+		if (1 == p) oneThread = time;
+		printf("%-8zu %12.2f %11.2fx %11.2fx %8s\n", p, time, oneThread / time, dijkstraTime / time, ok ? "ok" : "MISMATCH");
+	}
+	return 0;
+}
+}
@@ -0,0 +1,60 @@
+/**
+ *  @file GraphBench/src/triangles.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the intersection kernels of #graphTriangles.
+ */
+#include <GraphBench.hpp>
+#include <GraphTriangles.hpp>
+#include <thread>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @details Every kernel counts the triangles on 1, 2, 4, ... threads up to twice the hardware threads, and then once more with
+ * the triangles of every vertex on one thread. Every count is checked against the first one, and the clustering coefficients are
+ * reported at the end.
+ */
+int trianglesBench(const std::vector<std::string>& args)
+{
+	typedef graphTriangles<> triangles;
+	benchInput in;
+	if (false == readInput(args, in))
+	{
+		cerr << "Usage: triangles (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	stopWatch watch;
+	triangles t(in.csr);
+	printf("Vertices %zu Edges %zu Wedges %llu Hardware threads %u SIMD %s Setup(ms) %.2f\n", t.numVertices(), t.numEdges(),
+			t.wedges(), hardware, triangles::simdAvailable() ? "SSE2" : "none", watch.elapsedMs());
+	printf("%-12s %-8s %-8s %12s %12s %14s %8s\n", "Kernel", "Threads", "Local", "Time(ms)", "Speedup", "Triangles", "Check");
+	const char* names[] = {"merge", "galloping", "simd", "adaptive"};
+	triangles::countType expected = 0;
+	triangles::countMap local;
+	double first = 0;
+	for (size_t k = 0; k < 4; k++)
+		for (size_t p = 1; p <= 2 * hardware + 1; p = (p == 2 * hardware) ? p + 1 : p * 2)
+		{
+			bool perVertex = (p > 2 * hardware);
+			triangles::kernel kind = triangles::kernel(k);
+			triangles::countType found = 0;
+			watch.restart();
+			if (true == perVertex) local = t.local(kind, 1, &found);
+			else found = t.count(kind, p);
+			double time = watch.elapsedMs();
+			if (0 == k && 1 == p)
+			{
+				first = time;
+				expected = found;
+			}
+			printf("%-12s %-8zu %-8s %12.2f %11.2fx %14llu %8s\n", names[k], perVertex ? 1 : p, perVertex ? "yes" : "no", time,
+					first / time, found, (found == expected) ? "ok" : "MISMATCH");
+		}
+	printf("Global clustering %.6f Average clustering %.6f\n", t.globalClustering(expected), t.averageClustering(local));
+	return 0;
+}
+}
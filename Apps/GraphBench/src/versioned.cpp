@@ -0,0 +1,110 @@
+/**
+ *  @file GraphBench/src/versioned.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the benchmark of the query throughput of #versionedGraph readers while batches are ingested.
+ */
+#include <GraphBench.hpp>
+#include <GraphVersioned.hpp>
+#include <thread>
+#include <random>
+#include <cstdio>
+
+namespace GraphBench
+{
+/**
+ * @brief Function to run breadth first searches on pinned snapshots until told to stop
+ * @param	g		The graph to be queried
+ * @param	seed	Seed of the sources of the searches
+ * @param	stop	Flag to stop the queries
+ * @param	queries	Number of queries completed
+ */
+static void queryLoop(versionedGraph& g, unsigned int seed, const std::atomic<bool>& stop, std::atomic<size_t>& queries)
+{
+	versionedGraph::reader r(g);
+	std::mt19937 rng(seed);
+	std::vector<csrGraph::vertexId> source(1);
+	size_t done = 0;
+	while (false == stop.load())
+	{
+		const versionedGraph::snapshot& s = r.pin();
+		source[0] = csrGraph::vertexId(rng() % s.numVertices());
+		breadthFirstKernel(s, source);
+		r.unpin();
+		done++;
+	}
+	queries += done;
+}
+
+/**
+ * @brief Function to run the readers for a while, with or without a writer
+ * @return Queries per second
+ */
+static double runPhase(versionedGraph& g, size_t noOfReaders, double ms, bool ingest, size_t batchSize, size_t& batches)
+{
+	std::atomic<bool> stop(false);
+	std::atomic<size_t> queries(0);
+	std::vector<std::thread> readers;
+	for (size_t i = 0; i < noOfReaders; i++) readers.push_back(std::thread(queryLoop, std::ref(g), unsigned(i + 1), std::cref(stop), std::ref(queries)));
+	stopWatch watch;
+	std::mt19937 rng(2015);
+	batches = 0;
+	while (watch.elapsedMs() < ms)
+	{
+		if (false == ingest)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			continue;
+		}
+		const versionedGraph::snapshot& s = g.current();
+		std::vector<versionedGraph::edgeUpdate> batch;
+		for (size_t i = 0; i < batchSize; i++)
+		{
+			csrGraph::vertexId v = csrGraph::vertexId(rng() % s.numVertices());
+			if (0 == (i & 1) || 0 == s.degree(v)) batch.push_back(versionedGraph::edgeUpdate(v, csrGraph::vertexId(rng() % s.numVertices())));
+			else batch.push_back(versionedGraph::edgeUpdate(v, *s.neighborBegin(v), false));
+		}
+		g.applyBatch(batch);
+		batches++;
+	}
+	double elapsed = watch.elapsedMs();
+	stop.store(true);
+	for (size_t i = 0; i < readers.size(); i++) readers[i].join();
+	return 1000.0 * queries.load() / elapsed;
+}
+
+/**
+ * @details The same readers first query the graph alone and then while a writer applies batches of random insertions and
+ * deletions as fast as it can. The last version is then checked against its arc count.
+ */
+int versionedBench(const std::vector<std::string>& args)
+{
+	benchInput in;
+	if (false == readInput(args, in) || 0 == in.csr.numVertices())
+	{
+		cerr << "Usage: versioned (file | grid side | random n m)" << endl;
+		return 1;
+	}
+	const double phaseMs = 1000;
+	const size_t batchSize = 1000;
+	size_t noOfReaders = std::max(1u, std::min(4u, std::thread::hardware_concurrency() - 1));
+	stopWatch watch;
+	versionedGraph g(in.csr);
+	printf("Vertices %zu Slots %zu Build(ms) %.2f Readers %zu Cores %u\n", in.csr.numVertices(), in.csr.numSlots(), watch.elapsedMs(),
+			noOfReaders, std::thread::hardware_concurrency());
+	size_t batches = 0;
+	double alone = runPhase(g, noOfReaders, phaseMs, false, batchSize, batches);
+	double during = runPhase(g, noOfReaders, phaseMs, true, batchSize, batches);
+	printf("%-22s %12s %12s\n", "Phase", "Queries/s", "Batches/s");
+	printf("%-22s %12.1f %12s\n", "readers only", alone, "-");
+	printf("%-22s %12.1f %12.1f\n", "readers + ingest", during, 1000.0 * batches / phaseMs);
+	printf("Throughput ratio %.2f Versions %llu Retired %zu Reclaimed %zu\n", during / alone,
+			(unsigned long long)g.current().version(), g.retiredVersions(), g.reclaimedVersions());
+	const versionedGraph::snapshot& last = g.current();
+	size_t slots = 0;
+	for (csrGraph::vertexId v = 0; v < last.numVertices(); v++) slots += last.degree(v);
+	printf("Check %s\n", (slots == last.numSlots()) ? "ok" : "MISMATCH");
+	return 0;
+}
+}
@@ -7,6 +7,7 @@
  *  are in a namespace called GraphRead.
  */
 #include <graph.hpp>
+#include <GraphSearch.hpp>
 #include <iostream>
 #include <string>
 #include <fstream>
@@ -76,6 +77,7 @@ struct edge
  * A graph is first created for noOfNodes. Then nodes are inserted into the graph using a node descriptor and the edges are inserted into
  * nodes list using the addEdge method.
  * In the end the graph and noOfNodes are decompiled.@n
+ * When built with "make STATS=1" a breadth first traversal of the graph is run and its edge visits are printed on stderr.@n
  *
  * @b Testing @b Command @n
  * make test @n
@@ -107,5 +109,10 @@ int main(int argc , char* argv[])
 	cout << noOfNodes <<endl << g;
 	g.setDecompileFlavor(graphTraits::Nodes);
 	cout << noOfNodes <<endl << g;
+#ifdef ALGOPP_STATS
+	opStatsSnapshot before = defaultStatsPolicy::snapshot();
+	graphSearch<Graph>::breadthFirstOrder(g);
+	cerr << "Breadth first traversal" << endl << defaultStatsPolicy::snapshot() - before;
+#endif
 	return 0;
 }
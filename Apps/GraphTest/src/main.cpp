@@ -7,6 +7,10 @@
  *  are in a namespace called GraphTest. The test tries to instantiate graphs of various types and test basic operations
  */
 #include <graph.hpp>
+#include <GraphCSR.hpp>
+#include <GraphReorder.hpp>
+#include <GraphCompressed.hpp>
+#include <GraphVersioned.hpp>
 #include <iostream>
 #include <string>
 
@@ -74,6 +78,11 @@ struct edge
  * 1--10-->2 @n
  * 2--(-10)-->1 @n
  * 1 2 10 -10 @n
+ * The last scenarios read the edge weights into a #propertyMap, flatten the graph into a #csrGraph and its transpose, and
+ * reorder the vertices of a path so that its neighbors get consecutive ids. The path is finally compressed into a
+ * #compressedGraph with both encodings, and a CSR with wide gaps checks the longer deltas. At last edges and vertices are removed
+ * from a list stored bidirectional graph and a vector stored directed graph, which are then compacted. The path is also loaded
+ * into a #versionedGraph, where a pinned reader must keep seeing its version while batches are applied.
  *
  */
 int main() {
@@ -210,6 +219,190 @@ int main() {
 		a.setDecompileFlavor(graphTraits::Nodes);
 		cout << "No of vertices: "<< a.size()  << endl << a <<endl;
 	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Edge property map and CSR, directed and bidirectional   */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph < GraphTest::node*, GraphTest::edge*, graphTraits::directed> map;
+		GraphTest::node thirdNode(3);
+		GraphTest::edge secondEdge(-5), thirdEdge(7);
+		map a;
+		map::vertexDescriptor v = a.addVertex(&firstNode);
+		map::vertexDescriptor v2 = a.addVertex(&secondNode);
+		map::vertexDescriptor v3 = a.addVertex(&thirdNode);
+		a.addEdge(v,v2,&Edge);
+		a.addEdge(v2,v3,&secondEdge);
+		a.addEdge(v,v3,&thirdEdge);
+		propertyMap<int> weights = graphProperties<map>::edgeProperty(a,&GraphTest::edge::m_weight);
+		propertyMap<size_t> ids = graphProperties<map>::vertexProperty(a,&GraphTest::node::m_id);
+		csrGraph csr(a);
+		propertyMap<int> slotWeights = csr.slotProperty(weights);
+		csrGraph reverse = csr.transpose();
+		propertyMap<int> reverseWeights = reverse.slotProperty(weights);
+		int total = 0;
+		const int* w = weights.data();
+		for (size_t i = 0; i < weights.size(); i++) total += w[i];
+		cout << "No of vertices: " << a.size() << " No of edges: " << a.numEdges() << " Total weight: " << total << endl;
+		for (csrGraph::vertexId u = 0; u < csr.numVertices(); u++)
+		{
+			cout << "Out: " << ids[u];
+			for (size_t slot = csr.offsets[u]; slot < csr.offsets[u+1]; slot++)
+				cout << " " << slotWeights[slot] << "->" << ids[csr.targets[slot]];
+			cout << endl << "In : " << ids[u];
+			for (size_t slot = reverse.offsets[u]; slot < reverse.offsets[u+1]; slot++)
+				cout << " " << reverseWeights[slot] << "<-" << ids[reverse.targets[slot]];
+			cout << endl;
+		}
+		typedef graph < GraphTest::node, GraphTest::edge, graphTraits::bidirectional> bimap;
+		bimap b;
+		bimap::vertexDescriptor b1 = b.addVertex(firstNode);
+		bimap::vertexDescriptor b2 = b.addVertex(secondNode);
+		bimap::vertexDescriptor b3 = b.addVertex(thirdNode);
+		b.addEdge(b1,b2,Edge);
+		b.addEdge(b2,b3,secondEdge);
+		csrGraph bicsr(b);
+		propertyMap<int> biWeights = bicsr.slotProperty(graphProperties<bimap>::edgeProperty(b,&GraphTest::edge::m_weight));
+		cout << "No of vertices: " << bicsr.numVertices() << " No of edges: " << b.numEdges() << " No of slots: " << bicsr.numSlots() << endl;
+		for (csrGraph::vertexId u = 0; u < bicsr.numVertices(); u++)
+		{
+			cout << "Adj: " << u;
+			for (size_t slot = bicsr.offsets[u]; slot < bicsr.offsets[u+1]; slot++)
+				cout << " " << biWeights[slot] << "->" << bicsr.targets[slot];
+			cout << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Vertex reordering of a path with scattered ids          */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph < GraphTest::node*, GraphTest::edge*, graphTraits::bidirectional> map;
+		size_t pathIds[] = {3, 5, 1, 4, 2};
+		std::vector<GraphTest::node> nodes;
+		for (size_t i = 1; i <= 5; i++) nodes.push_back(GraphTest::node(i));
+		map a;
+		std::vector<map::vertexDescriptor> v;
+		for (size_t i = 0; i < 5; i++) v.push_back(a.addVertex(&nodes[i]));
+		for (size_t i = 0; i + 1 < 5; i++) a.addEdge(v[pathIds[i]-1],v[pathIds[i+1]-1],&Edge);
+		csrGraph csr(a);
+		const char* names[] = {"RCM   ", "Degree", "BFS   ", "DFS   ", "Gorder"};
+		vertexPermutation p[] = {graphReorder::reverseCuthillMcKee(csr), graphReorder::degreeSort(csr),
+				graphReorder::breadthFirstOrder(csr), graphReorder::depthFirstOrder(csr), graphReorder::gorder(csr,2)};
+		for (size_t o = 0; o < 5; o++)
+		{
+			csrGraph relabeled = graphReorder::apply(csr,p[o]);
+			cout << names[o] << ":";
+			for (size_t i = 0; i < p[o].size(); i++) cout << " " << p[o].oldIndex[i] + 1;
+			cout << " |";
+			for (csrGraph::vertexId u = 0; u < relabeled.numVertices(); u++)
+				for (const csrGraph::vertexId* w = relabeled.neighborBegin(u); w != relabeled.neighborEnd(u); w++)
+					if (*w > u) cout << " " << u << "-" << *w;
+			cout << endl;
+		}
+		graphReorder::relabel(a,p[0]);
+		a.setDecompileFlavor(graphTraits::Nodes);
+		cout << "No of vertices: "<< a.size()  << endl << a <<endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Compressed adjacency, varint and stream-vbyte           */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		csrGraph wide;
+		csrGraph::vertexId wideTargets[] = {70000, 5, 3, 0, 300, 20000000, 1, 2, 4, 6, 70000, 2};
+		size_t wideOffsets[] = {0, 0, 1, 6, 6, 6, 6, 12};
+		wide.targets.assign(wideTargets, wideTargets + 12);
+		wide.offsets.assign(wideOffsets, wideOffsets + 8);
+		const char* names[] = {"varint      ", "stream-vbyte"};
+		compressedGraph::encodingType encodings[] = {compressedGraph::varint, compressedGraph::streamVByte};
+		std::vector<csrGraph::vertexId> row;
+		for (size_t e = 0; e < 2; e++)
+		{
+			compressedGraph c(wide, encodings[e]);
+			cout << names[e] << ": " << c.adjacencyBytes() << " bytes |";
+			for (csrGraph::vertexId u = 0; u < c.numVertices(); u++)
+			{
+				cout << " " << u << ":";
+				for (compressedGraph::neighborIterator w = c.neighborBegin(u); w != c.neighborEnd(u); ++w) cout << " " << *w;
+				c.decode(u, row);
+				if (false == std::equal(row.begin(), row.end(), c.neighborBegin(u))) cout << " decode mismatch";
+			}
+			cout << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Edge and vertex removal and compaction                  */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph < GraphTest::node*, GraphTest::edge*, graphTraits::bidirectional> map;
+		std::vector<GraphTest::node> nodes;
+		for (size_t i = 1; i <= 4; i++) nodes.push_back(GraphTest::node(i));
+		GraphTest::edge weights[] = {GraphTest::edge(10), GraphTest::edge(-5), GraphTest::edge(7), GraphTest::edge(3), GraphTest::edge(1)};
+		size_t ends[][2] = {{1,2}, {2,3}, {3,4}, {1,4}, {2,2}};
+		map a;
+		std::vector<map::vertexDescriptor> v;
+		for (size_t i = 0; i < 4; i++) v.push_back(a.addVertex(&nodes[i]));
+		for (size_t i = 0; i < 5; i++) a.addEdge(v[ends[i][0]-1],v[ends[i][1]-1],&weights[i]);
+		a.removeEdge(v[0],a.out_edges(v[0]).first);
+		a.removeVertex(v[1]);
+		cout << "Live vertices: " << a.numLiveVertices() << " of " << a.size() << " No of edges: " << a.numEdges() << endl;
+		a.setDecompileFlavor(graphTraits::AllEdges);
+		cout << a;
+		propertyMap<int> weightMap = graphProperties<map>::edgeProperty(a,&GraphTest::edge::m_weight);
+		graphCompaction c = a.compact();
+		weightMap.remap(c.edgeMap);
+		cout << "Compacted vertices: " << a.size() << " No of edges: " << a.numEdges() << " Vertex 3 index: " << v[2]->index << endl;
+		csrGraph csr(a);
+		for (csrGraph::vertexId u = 0; u < csr.numVertices(); u++)
+			for (size_t slot = csr.offsets[u]; slot < csr.offsets[u+1]; slot++)
+				cout << "Slot: " << u << " " << weightMap[csr.edgeIndex[slot]] << "->" << csr.targets[slot] << endl;
+		a.clear();
+		cout << "Cleared vertices: " << a.size() << " No of edges: " << a.numEdges() << endl;
+
+		typedef graph < GraphTest::node, GraphTest::edge, graphTraits::directed, graphTraits::vectorStorage, graphTraits::vectorStorage> vmap;
+		vmap b;
+		std::vector<vmap::vertexDescriptor> w;
+		for (size_t i = 0; i < 4; i++) b.addVertex(nodes[i]);
+		for (vmap::vertexDescriptor u = b.vertices().first; u != b.vertices().second; u++) w.push_back(u);
+		for (size_t i = 0; i < 5; i++) b.addEdge(w[ends[i][1]-1],w[ends[i][0]-1],weights[i]);
+		b.removeVertex(w[0]);
+		b.compact();
+		b.setDecompileFlavor(graphTraits::AllEdges);
+		cout << "Live vertices: " << b.numLiveVertices() << " No of edges: " << b.numEdges() << endl << b;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Versioned graph with a pinned reader                    */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		csrGraph path;
+		csrGraph::vertexId pathTargets[] = {1, 0, 2, 1, 3, 2, 4, 3};
+		size_t pathOffsets[] = {0, 1, 3, 5, 7, 8};
+		path.targets.assign(pathTargets, pathTargets + 8);
+		path.offsets.assign(pathOffsets, pathOffsets + 6);
+		versionedGraph g(path, 1, 2);
+		versionedGraph::reader r(g);
+		const versionedGraph::snapshot& pinned = r.pin();
+		std::vector<versionedGraph::edgeUpdate> batch;
+		batch.push_back(versionedGraph::edgeUpdate(0, 4));
+		batch.push_back(versionedGraph::edgeUpdate(1, 2, false));
+		batch.push_back(versionedGraph::edgeUpdate(1, 3, false));
+		batch.push_back(versionedGraph::edgeUpdate(5, 0));
+		cout << "Applied: " << g.applyBatch(batch) << " of " << batch.size() << endl;
+		const versionedGraph::snapshot* versions[] = {&pinned, &g.current()};
+		for (size_t i = 0; i < 2; i++)
+		{
+			cout << "Version " << versions[i]->version() << ": " << versions[i]->numVertices() << " vertices " << versions[i]->numSlots() << " arcs |";
+			for (csrGraph::vertexId u = 0; u < versions[i]->numVertices(); u++)
+			{
+				cout << " " << u << ":";
+				for (const csrGraph::vertexId* w = versions[i]->neighborBegin(u); w != versions[i]->neighborEnd(u); w++) cout << " " << *w;
+			}
+			cout << endl;
+		}
+		cout << "Shared blocks: " << g.current().sharedBlocks(pinned) << " Retired: " << g.retiredVersions() << " Reclaimed: " << g.reclaimedVersions() << endl;
+		r.unpin();
+		batch.assign(1, versionedGraph::edgeUpdate(4, 0));
+		g.applyBatch(batch);
+		cout << "After unpin Retired: " << g.retiredVersions() << " Reclaimed: " << g.reclaimedVersions() << endl;
+	}
 
 	return 0;
 }
@@ -4,10 +4,18 @@
  *  Created on: 01-Aug-2015
  *  @author: Karan Talreja
  *  @details This file contains a sample testing scenario for the heap data structure. All the data structures present in the file
- *  are in a namespace called HeapTest. The test tries to add nodes into heap and run some fundamental operations on them.
+ *  are in a namespace called HeapTest. The test tries to add nodes into heap and run some fundamental operations on them. The meldable
+ *  heaps are compared with a std::multiset over random inserts, extracts, decreaseKeys and melds. The multiqueue is filled and drained
+ *  by several threads.
  */
 #include <heap.hpp>
+#include <PairingHeap.hpp>
+#include <FibonacciHeap.hpp>
+#include <MultiQueue.hpp>
+#include <IndexedHeap.hpp>
 #include <type_traits>
+#include <set>
+#include <thread>
 
 /**
  * @brief HeapTest to wrap the object model specific to this testing suite.
@@ -39,6 +47,175 @@ public:
 	 */
 	heapNode(int n) {weight = n;}
 };
+
+/**
+ * @brief Node of the meldable heap checks, keyed by key and told apart by id
+ */
+struct keyedNode
+{
+	int key;	///< Member to hold the key used by the heap
+	size_t id;	///< Member to hold the identity of the node
+	///@brief Member function to get the key required by heap.
+	static int getKey(keyedNode& a) {return a.key;}
+};
+
+///@brief Linear congruential generator, so that the random scenarios give the same output everywhere
+struct lcg
+{
+	unsigned long long m_state;	///< Member to hold the state of the generator
+	///@brief Single argument constructor
+	explicit lcg(unsigned long long seed) : m_state(seed){}
+	///@brief Member function to get a number in 0..n-1
+	size_t operator() (size_t n)
+	{
+		m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+		return size_t(m_state >> 33) % n;
+	}
+};
+
+/**
+ * @brief Function to run random operations on two meldable min heaps next to a std::multiset per heap
+ * @tparam	heapType	#pairingHeap or #fibonacciHeap of #keyedNode
+ * @param	seed		Seed of the operations
+ * @param	noOfOperations	Number of operations to run
+ * @return Number of extracts which did not give the smallest key of the reference
+ */
+template <class heapType>
+size_t meldableCheck(unsigned long long seed, size_t noOfOperations)
+{
+	heapType heaps[2];
+	std::multiset<std::pair<int,size_t> > reference[2];
+	std::vector<typename heapType::handle> handles;
+	std::vector<int> owner;	// Heap holding every id, -1 once extracted
+	lcg rng(seed);
+	size_t mismatches = 0;
+	for (size_t i = 0; i < noOfOperations; i++)
+	{
+		size_t op = rng(10), h = rng(2);
+		if (op < 4)
+		{
+			keyedNode n = {int(rng(1000)), handles.size()};
+			handles.push_back(heaps[h].insert(n));
+			owner.push_back(int(h));
+			reference[h].insert(std::make_pair(n.key, n.id));
+		}
+		else if (op < 7 && false == heaps[h].empty())
+		{
+			keyedNode n = heaps[h].extractTop();
+			mismatches += (n.key != reference[h].begin()->first);
+			reference[h].erase(std::make_pair(n.key, n.id));
+			owner[n.id] = -1;
+		}
+		else if (op < 9 && false == handles.empty())
+		{
+			size_t id = rng(handles.size());
+			if (-1 == owner[id]) continue;
+			keyedNode n = heapType::value(handles[id]);
+			reference[owner[id]].erase(std::make_pair(n.key, n.id));
+			n.key -= int(rng(300));
+			heaps[owner[id]].decreaseKey(handles[id], n);
+			reference[owner[id]].insert(std::make_pair(n.key, n.id));
+		}
+		else if (9 == op)
+		{
+			heaps[h].meld(heaps[1-h]);
+			reference[h].insert(reference[1-h].begin(), reference[1-h].end());
+			reference[1-h].clear();
+			for (size_t id = 0; id < owner.size(); id++) if (int(1-h) == owner[id]) owner[id] = int(h);
+		}
+	}
+	for (size_t h = 0; h < 2; h++)
+	{
+		mismatches += (heaps[h].getSize() != reference[h].size());
+		while (false == heaps[h].empty())
+		{
+			keyedNode n = heaps[h].extractTop();
+			mismatches += (n.key != reference[h].begin()->first);
+			reference[h].erase(std::make_pair(n.key, n.id));
+		}
+	}
+	return mismatches;
+}
+
+/**
+ * @brief Function to run random operations on an #indexedHeap next to a plain array of keys
+ * @tparam	traits		#basic_heap_min_traits or #basic_heap_max_traits of int
+ * @param	seed		Seed of the operations
+ * @param	noOfOperations	Number of operations to run
+ * @return Number of operations whose result differs from the one of the array, which is searched from end to end
+ */
+template <class traits>
+size_t indexedCheck(unsigned long long seed, size_t noOfOperations)
+{
+	const size_t n = 200;
+	indexedHeap<int,traits> h(n);
+	std::vector<int> keys(n);
+	std::vector<bool> present(n, false);
+	lcg rng(seed);
+	size_t mismatches = 0;
+	for (size_t i = 0; i < noOfOperations; i++)
+	{
+		size_t op = rng(10), id = rng(n);
+		int key = int(rng(1000));
+		if (op < 3)
+		{
+			mismatches += (h.insert(id, key) == present[id]);
+			if (false == present[id]) keys[id] = key;
+			present[id] = true;
+		}
+		else if (op < 6)
+		{
+			mismatches += (h.changeKey(id, key) != present[id]);
+			if (true == present[id]) keys[id] = key;
+		}
+		else if (op < 7)
+		{
+			mismatches += (h.remove(id) != present[id]);
+			present[id] = false;
+		}
+		else if (false == h.empty())
+		{
+			int best = h.topKey();
+			for (size_t j = 0; j < n; j++) if (true == present[j] && true == traits::lt(keys[j], best)) mismatches++;
+			size_t top = h.extractTop();
+			mismatches += (false == present[top] || keys[top] != best);
+			present[top] = false;
+		}
+		size_t size = 0;
+		for (size_t j = 0; j < n; j++) size += present[j];
+		mismatches += (size != h.getSize()) + (h.contains(id) != present[id]);
+	}
+	return mismatches;
+}
+
+///@brief Function run by the threads of the multiqueue check, inserting keys first..first+count-1 and then extracting count keys
+void multiQueueWorker(multiQueue<int>* q, int first, int count, long long* extractedSum)
+{
+	for (int i = 0; i < count; i++) q->insert(first + i);
+	*extractedSum = 0;
+	int key;
+	for (int i = 0; i < count; i++)
+		if (true == q->tryExtractTop(key)) *extractedSum += key;
+}
+
+/**
+ * @brief Function to run a scripted scenario on a meldable min heap of ints
+ * @tparam	heapType	#pairingHeap or #fibonacciHeap of int
+ */
+template <class heapType>
+void meldableScenario()
+{
+	heapType a, b;
+	typename heapType::handle h = a.insert(40);
+	for (int i = 1; i <= 5; i++) a.insert(10 * i + 5);
+	for (int i = 1; i <= 5; i++) b.insert(10 * i + 2);
+	cout << "Top: " << a.extractTop() << " " << b.top() << endl;
+	cout << "Decrease 40 to 1: " << a.decreaseKey(h, 1) << " to 50: " << a.decreaseKey(h, 50) << " Top: " << a.top() << endl;
+	a.meld(b);
+	cout << "Melded sizes: " << a.getSize() << " " << b.getSize() << endl;
+	while (false == a.empty()) cout << a.extractTop() << " ";
+	cout << endl;
+}
 }
 
 using namespace HeapTest;
@@ -92,5 +269,73 @@ int main()
 	aNf.decompile();
 	aNf.insert(*new heapNode(1));
 	aNf.decompile();
+
+	/**
+	 * The following snippet checks that a node with only a left child is sifted down as well
+	 * Sample Output:
+	 * 1 3 5
+	 */
+	heap<int,basic_heap_min_traits<int> > b;
+	b.insert(1);
+	b.insert(3);
+	b.insert(5);
+	for (int i = 0; i < 3; i++) cout << b.extractTop() << " ";
+	cout << endl;
+
+	/**
+	 * The following snippet runs the same script on the meldable heaps, which give the same output
+	 * Sample Output:
+	 * Top: 15 12
+	 * Decrease 40 to 1: 1 to 50: 0 Top: 1
+	 * Melded sizes: 10 0
+	 * 1 12 22 25 32 35 42 45 52 55
+	 */
+	meldableScenario<pairingHeap<int> >();
+	meldableScenario<fibonacciHeap<int> >();
+	cout << "Pairing heap random mismatches: " << meldableCheck<pairingHeap<keyedNode> >(2015, 20000) << endl;
+	cout << "Fibonacci heap random mismatches: " << meldableCheck<fibonacciHeap<keyedNode> >(2015, 20000) << endl;
+
+	/**
+	 * The following snippet changes keys of an indexed heap in both directions and removes from its middle, then checks random
+	 * operations against an array for a min and a max heap
+	 * Sample Output:
+	 * Indexed: 4 1 2 0 3
+	 * Indexed random mismatches: 0 0
+	 */
+	indexedHeap<int> indexed(6);
+	for (size_t id = 0; id < 6; id++) indexed.insert(id, int(10 * id));
+	indexed.changeKey(4, -5);
+	indexed.changeKey(0, 25);
+	indexed.remove(5);
+	cout << "Indexed:";
+	while (false == indexed.empty()) cout << " " << indexed.extractTop();
+	cout << endl;
+	cout << "Indexed random mismatches: " << indexedCheck<basic_heap_min_traits<int> >(2015, 20000) << " "
+			<< indexedCheck<basic_heap_max_traits<int> >(2015, 20000) << endl;
+
+	/**
+	 * The following snippet drains a multiqueue of two internal heaps on one thread, which always compares both tops and so is exact,
+	 * and then fills and drains one from four threads
+	 * Sample Output:
+	 * Multiqueue exact order: 1
+	 * Multiqueue threads: 40000 left 0 sum ok 1
+	 */
+	multiQueue<int> exact(1, 2);
+	for (int i = 0; i < 1000; i++) exact.insert((i * 7919) % 1000);
+	bool inOrder = true;
+	for (int i = 0, key = 0; i < 1000; i++) inOrder = inOrder && exact.tryExtractTop(key) && key == i;
+	cout << "Multiqueue exact order: " << inOrder << endl;
+	multiQueue<int> shared(4, 2);
+	std::vector<std::thread> workers;
+	long long sums[4];
+	for (int t = 0; t < 4; t++) workers.push_back(std::thread(multiQueueWorker, &shared, 10000 * t, 10000, &sums[t]));
+	for (int t = 0; t < 4; t++) workers[t].join();
+	long long total = 0;
+	for (int key; shared.tryExtractTop(key); ) total += key;
+	for (int t = 0; t < 4; t++) total += sums[t];
+	cout << "Multiqueue threads: " << 4 * 10000 << " left " << shared.getSize() << " sum ok " << (total == 40000LL * 39999 / 2) << endl;
+#ifdef ALGOPP_STATS
+	cerr << defaultStatsPolicy::snapshot();
+#endif
 	return 0;
 }
@@ -0,0 +1,575 @@
+/**
+ *  @file NetworkFlow/src/main.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the testing scenarios for the flow, cut and matching algorithms. All the data structures present in
+ *  the file are in a namespace called NetworkFlow.
+ */
+#include <graph.hpp>
+#include <GraphCSR.hpp>
+#include <GraphFlow.hpp>
+#include <GraphMinCut.hpp>
+#include <GraphMatching.hpp>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief NetworkFlow to wrap the object model specific to this testing suite.
+ */
+namespace NetworkFlow
+{
+/**
+ * @brief Vertex OM for the graph
+ * @details This class has a single member to signify the ID of the graph vertex
+ */
+struct node
+{
+	size_t m_id;	///< Member to store the ID of the graph node
+
+	///@brief Default constructor for initializing class members
+	node():m_id(0){};
+
+	///@brief Single argument constructor to initialize class member m_id
+	node(size_t id):m_id(id){};
+};
+
+/**
+ * @brief Edge OM for the graph
+ * @details This class has a capacity member to signify how much can go through the edge.
+ */
+struct edge
+{
+	long long m_capacity;		///< Capacity of the edge.
+
+	///@brief Default constructor for initializing class members
+	edge():m_capacity(0){};
+
+	///@brief Single argument constructor to initialize class members
+	edge(long long capacity):m_capacity(capacity){};
+};
+
+///@brief Linear congruential generator, so that the random scenarios give the same output everywhere
+struct lcg
+{
+	unsigned long long m_state;	///< Member to hold the state of the generator
+	///@brief Single argument constructor
+	explicit lcg(unsigned long long seed) : m_state(seed){}
+	///@brief Member function to get a number in 0..n-1
+	size_t operator() (size_t n)
+	{
+		m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+		return size_t(m_state >> 33) % n;
+	}
+};
+
+typedef graph<node*, edge*, graphTraits::directed> directedGraph;	///< Directed graph of the scenarios
+typedef graph<node*, edge*, graphTraits::bidirectional> undirectedGraph;	///< Undirected graph of the scenarios
+typedef graphMaxFlow<long long> maxFlow;	///< Maximum flow over the capacities of #edge
+typedef graphMinCut<long long> minCut;	///< Global minimum cut over the capacities of #edge
+typedef bipartiteMatching<> matching;	///< Maximum matching of jobs to machines
+typedef bipartiteAssignment<long long> assignment;	///< Minimum cost assignment of jobs to machines, the capacities of #edge read as costs
+
+///@brief Function to get the value of a maximum flow by shortest augmenting paths, as the reference
+long long edmondsKarp(const csrGraph& g, const propertyMap<long long>& c, csrGraph::vertexId s, csrGraph::vertexId t)
+{
+	size_t n = g.numVertices();
+	std::vector<std::vector<long long> > residual(n, std::vector<long long>(n, 0));
+	for (csrGraph::vertexId u = 0; u < n; u++)
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			if (g.targets[slot] != u) residual[u][g.targets[slot]] += c[slot];
+	long long retVal = 0;
+	for (;;)
+	{
+		std::vector<size_t> parent(n, n), queue(1, s);
+		parent[s] = s;
+		for (size_t head = 0; head < queue.size() && n == parent[t]; head++)
+			for (size_t v = 0; v < n; v++)
+				if (n == parent[v] && residual[queue[head]][v] > 0)
+				{
+					parent[v] = queue[head];
+					queue.push_back(v);
+				}
+		if (n == parent[t] || s == t) return retVal;
+		long long pushed = -1;
+		for (size_t v = t; v != s; v = parent[v])
+			if (pushed < 0 || residual[parent[v]][v] < pushed) pushed = residual[parent[v]][v];
+		for (size_t v = t; v != s; v = parent[v])
+		{
+			residual[parent[v]][v] -= pushed;
+			residual[v][parent[v]] += pushed;
+		}
+		retVal += pushed;
+	}
+}
+
+/**
+ * @brief Function to count the ways in which the last run of f is not a maximum flow of the given value
+ * @details The flow of every slot must be within its capacity, every vertex but s and t must keep what comes in, t must receive
+ * the value, and the capacities of the cut edges must add up to the value.
+ */
+size_t violations(const maxFlow& f, const csrGraph& g, const propertyMap<long long>& c, csrGraph::vertexId s, csrGraph::vertexId t, long long value)
+{
+	std::vector<long long> balance(g.numVertices(), 0);
+	size_t retVal = 0;
+	for (csrGraph::vertexId u = 0; u < g.numVertices(); u++)
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+		{
+			retVal += (f.flow(slot) < 0 || f.flow(slot) > c[slot]);
+			balance[u] -= f.flow(slot);
+			balance[g.targets[slot]] += f.flow(slot);
+		}
+	for (size_t v = 0; v < balance.size(); v++) retVal += (v != s && v != t && 0 != balance[v]);
+	retVal += (s != t && balance[t] != value);
+	std::vector<size_t> cut = f.cutSlots(s);
+	long long capacity = 0;
+	for (size_t i = 0; i < cut.size(); i++) capacity += c[cut[i]];
+	return retVal + (capacity != value);
+}
+
+///@brief Function to build a random directed graph with n vertices and m edges of capacities up to maxCapacity
+csrGraph buildRandom(size_t n, size_t m, size_t maxCapacity, unsigned long long seed, propertyMap<long long>& c)
+{
+	lcg rng(seed);
+	directedGraph g;
+	std::vector<directedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[rng(n)], new edge(1 + (long long)rng(maxCapacity)));
+	csrGraph retVal(g);
+	c = retVal.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &edge::m_capacity));
+	return retVal;
+}
+
+///@brief Function to get the weight of the slots of g leaving the given side, once for every undirected edge
+long long cutValue(const csrGraph& g, const propertyMap<long long>& w, const std::vector<csrGraph::vertexId>& side)
+{
+	std::vector<bool> in(g.numVertices(), false);
+	for (size_t i = 0; i < side.size(); i++) in[side[i]] = true;
+	long long retVal = 0;
+	for (csrGraph::vertexId u = 0; u < g.numVertices(); u++)
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			if (true == in[u] && false == in[g.targets[slot]]) retVal += w[slot];
+	return retVal;
+}
+
+///@brief Function to get the value of a global minimum cut by trying all the sides without vertex 0, as the reference
+long long bruteMinCut(const csrGraph& g, const propertyMap<long long>& w)
+{
+	size_t n = g.numVertices();
+	long long retVal = -1;
+	for (size_t mask = 1; mask + 1 < (size_t(1) << n); mask += 2)
+	{
+		std::vector<csrGraph::vertexId> side;
+		for (size_t v = 0; v < n; v++) if (0 == ((mask >> v) & 1)) side.push_back(csrGraph::vertexId(v));
+		long long value = cutValue(g, w, side);
+		if (retVal < 0 || value < retVal) retVal = value;
+	}
+	return (retVal < 0) ? 0 : retVal;
+}
+
+/**
+ * @brief Function to count the ways in which a cut is not a minimum one
+ * @details The side must be a proper non empty set without vertex 0, the edges leaving it must weigh the value, and the value
+ * must be the expected one.
+ */
+size_t cutViolations(const csrGraph& g, const propertyMap<long long>& w, const std::vector<csrGraph::vertexId>& side, long long value, long long expected)
+{
+	size_t retVal = (side.empty() || side.size() >= g.numVertices() || 0 == side[0]);
+	return retVal + (cutValue(g, w, side) != value) + (value != expected);
+}
+
+/**
+ * @brief Function to build a random undirected graph with n vertices and m edges of weights up to maxWeight
+ * @details With bridges, the edges are drawn within the two halves of the vertices, which are then joined by that many edges of
+ * weight 1.
+ */
+csrGraph buildRandomUndirected(size_t n, size_t m, size_t maxWeight, unsigned long long seed, propertyMap<long long>& w, size_t bridges = 0)
+{
+	lcg rng(seed);
+	undirectedGraph g;
+	std::vector<undirectedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < m; i++)
+	{
+		size_t half = (0 == bridges) ? 0 : (i % 2) * (n / 2), range = (0 == bridges) ? n : n / 2;
+		g.addEdge(v[half + rng(range)], v[half + rng(range)], new edge(1 + (long long)rng(maxWeight)));
+	}
+	for (size_t i = 0; i < bridges; i++) g.addEdge(v[rng(n / 2)], v[n / 2 + rng(n / 2)], new edge(1));
+	csrGraph retVal(g);
+	w = retVal.slotProperty(graphProperties<undirectedGraph>::edgeProperty(g, &edge::m_capacity));
+	return retVal;
+}
+
+///@brief Edge of a bipartite scenario as (job, machine, cost)
+typedef std::pair<std::pair<size_t,size_t>,long long> jobEdge;
+
+///@brief Function to build the directed graph of the given edges over n vertices, with its costs in slot order
+csrGraph buildBipartite(size_t n, const std::vector<jobEdge>& edges, propertyMap<long long>& cost)
+{
+	directedGraph g;
+	std::vector<directedGraph::vertexDescriptor> v;
+	for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < edges.size(); i++) g.addEdge(v[edges[i].first.first], v[edges[i].first.second], new edge(edges[i].second));
+	csrGraph retVal(g);
+	cost = retVal.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &edge::m_capacity));
+	return retVal;
+}
+
+///@brief Function to draw m random edges from the jobs 0..jobs-1 to the machines jobs..jobs+machines-1 with costs up to maxCost
+std::vector<jobEdge> randomJobs(size_t jobs, size_t machines, size_t m, size_t maxCost, lcg& rng)
+{
+	std::vector<jobEdge> retVal;
+	for (size_t i = 0; i < m; i++) retVal.push_back(jobEdge(std::make_pair(rng(jobs), jobs + rng(machines)), (long long)rng(maxCost + 1)));
+	return retVal;
+}
+
+///@brief Function to change the cost of count edges, drop count edges and add count new ones, as a small change to the jobs
+void perturbJobs(std::vector<jobEdge>& edges, size_t jobs, size_t machines, size_t count, size_t maxCost, lcg& rng)
+{
+	for (size_t i = 0; i < count && false == edges.empty(); i++)
+	{
+		edges[rng(edges.size())].second = (long long)rng(maxCost + 1);
+		edges.erase(edges.begin() + rng(edges.size()));
+		edges.push_back(jobEdge(std::make_pair(rng(jobs), jobs + rng(machines)), (long long)rng(maxCost + 1)));
+	}
+}
+
+///@brief Function to get the size of a maximum matching by single augmenting paths, as the reference
+size_t kuhnMatching(const csrGraph& g)
+{
+	std::vector<size_t> mate(g.numVertices(), size_t(-1));
+	size_t retVal = 0;
+	for (csrGraph::vertexId root = 0; root < g.numVertices(); root++)
+	{
+		std::vector<size_t> parent(g.numVertices(), size_t(-1)), stack(1, root);
+		size_t end = size_t(-1);
+		while (false == stack.empty() && size_t(-1) == end)
+		{
+			size_t u = stack.back();
+			stack.pop_back();
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1] && size_t(-1) == end; slot++)
+			{
+				size_t v = g.targets[slot];
+				if (size_t(-1) != parent[v]) continue;
+				parent[v] = u;
+				if (size_t(-1) == mate[v]) end = v;
+				else stack.push_back(mate[v]);
+			}
+		}
+		for (size_t v = end; size_t(-1) != v;)
+		{
+			size_t u = parent[v], next = mate[u];
+			mate[u] = v;
+			mate[v] = u;
+			v = next;
+		}
+		retVal += (size_t(-1) != end);
+	}
+	return retVal;
+}
+
+///@brief Function to get the size and least cost of a maximum matching by dynamic programming over the sets of used machines
+std::pair<size_t,long long> assignmentReference(const csrGraph& g, const propertyMap<long long>& cost, size_t jobs)
+{
+	size_t machines = g.numVertices() - jobs;
+	std::vector<std::pair<size_t,long long> > best(size_t(1) << machines, std::make_pair(0, 0));
+	std::vector<bool> reached(best.size(), false);
+	reached[0] = true;
+	for (size_t u = 0; u < jobs; u++)
+		for (size_t mask = best.size(); mask-- > 0;)
+			if (true == reached[mask])
+				for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				{
+					size_t bit = size_t(1) << (g.targets[slot] - jobs);
+					if (0 != (mask & bit)) continue;
+					std::pair<size_t,long long> candidate(best[mask].first + 1, best[mask].second + cost[slot]);
+					std::pair<size_t,long long>& other = best[mask | bit];
+					if (false == reached[mask | bit] || candidate.first > other.first || (candidate.first == other.first && candidate.second < other.second))
+						other = candidate;
+					reached[mask | bit] = true;
+				}
+	std::pair<size_t,long long> retVal(0, 0);
+	for (size_t mask = 0; mask < best.size(); mask++)
+		if (true == reached[mask] && (best[mask].first > retVal.first || (best[mask].first == retVal.first && best[mask].second < retVal.second)))
+			retVal = best[mask];
+	return retVal;
+}
+
+/**
+ * @brief Function to count the ways in which an assignment is not a valid one of the given size and cost
+ * @details The partners must agree both ways and be joined by an edge, and the cheapest edges of the pairs must add up to the cost.
+ */
+size_t assignmentViolations(const assignment& a, const csrGraph& g, const propertyMap<long long>& cost, std::pair<size_t,long long> expected)
+{
+	size_t retVal = 0, pairs = 0;
+	long long total = 0;
+	for (csrGraph::vertexId u = 0; u < g.numVertices(); u++)
+	{
+		csrGraph::vertexId v = a.mate(u);
+		if (assignment::none() == v) continue;
+		retVal += (a.mate(v) != u);
+		if (g.offsets[u] == g.offsets[u+1]) continue;
+		bool found = false;
+		long long least = 0;
+		for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			if (g.targets[slot] == v && (false == found || cost[slot] < least))
+			{
+				least = cost[slot];
+				found = true;
+			}
+		retVal += (false == found);
+		total += least;
+		pairs++;
+	}
+	return retVal + (pairs != expected.first) + (total != expected.second) + (a.cost() != total) + (a.size() != pairs);
+}
+}
+
+/**
+ * @brief Main function to run the network flow test scenarios
+ * @details The maximum flow of a scripted graph with a loop and an unreachable vertex is found by Dinic and by push-relabel with its
+ * minimum cut. Then both run on random graphs, sparse and dense, with small and large capacities, where their values must agree
+ * with shortest augmenting paths and their flows must be valid with a cut of the same capacity. The global minimum cut of the
+ * weighted graph of the Stoer-Wagner paper and of a disconnected one is found by all three methods, which then run on small random
+ * graphs against trying all the cuts and on larger ones against each other. Jobs are matched to machines by Hopcroft-Karp and
+ * assigned at least cost by the Hungarian method on a scripted graph and on random ones against references, before and after
+ * small changes from which both pick up their last solution, and on a large one where the searches this saves are counted.
+ */
+int main()
+{
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Maximum flow: Dinic and push-relabel                     */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		NetworkFlow::directedGraph g;
+		std::vector<NetworkFlow::directedGraph::vertexDescriptor> v;
+		const int edges[][3] = {{0,1,16}, {0,2,13}, {1,2,10}, {2,1,4}, {1,3,12}, {3,2,9}, {2,4,14}, {4,3,7}, {3,5,20}, {4,5,4}, {4,4,50}, {6,5,8}};
+		for (size_t i = 0; i < 7; i++) v.push_back(g.addVertex(new NetworkFlow::node(i)));
+		for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++)
+			g.addEdge(v[edges[i][0]], v[edges[i][1]], new NetworkFlow::edge(edges[i][2]));
+		propertyMap<long long> c = graphProperties<NetworkFlow::directedGraph>::edgeProperty(g, &NetworkFlow::edge::m_capacity);
+		NetworkFlow::maxFlow f(g, c);
+		csrGraph csr(g);
+		propertyMap<long long> slotCapacity = csr.slotProperty(c);
+		cout << "Arcs: " << f.numArcs() << endl;
+		for (size_t method = 0; method < 2; method++)
+		{
+			long long value = (0 == method) ? f.dinic(0, 5) : f.pushRelabel(0, 5);
+			cout << ((0 == method) ? "Dinic: " : "Push-relabel: ") << value << " violations "
+				<< NetworkFlow::violations(f, csr, slotCapacity, 0, 5, value) << endl << "Flows:";
+			for (size_t slot = 0; slot < csr.numSlots(); slot++) cout << " " << f.flow(slot);
+			cout << endl << "Source side:";
+			std::vector<csrGraph::vertexId> side = f.minCut(0);
+			for (size_t i = 0; i < side.size(); i++) cout << " " << side[i];
+			cout << endl << "Cut edges:";
+			std::vector<size_t> cut = f.cutSlots(0);
+			for (size_t i = 0; i < cut.size(); i++)
+			{
+				csrGraph::vertexId tail = csrGraph::vertexId(std::upper_bound(csr.offsets.begin(), csr.offsets.end(), cut[i]) - csr.offsets.begin() - 1);
+				cout << " " << tail << "->" << csr.targets[cut[i]] << "(" << slotCapacity[cut[i]] << ")";
+			}
+			cout << endl;
+		}
+		cout << "Same vertex: " << f.dinic(3, 3) << " " << f.pushRelabel(3, 3) << endl;
+		cout << "Unreachable: " << f.dinic(5, 0) << " " << f.pushRelabel(5, 0) << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Maximum flow on random graphs                            */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		const size_t sizes[][3] = {{200, 800, 10}, {200, 800, 1000000}, {60, 2000, 1}, {60, 2000, 100}, {300, 600, 50}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			propertyMap<long long> c;
+			csrGraph g = NetworkFlow::buildRandom(sizes[r][0], sizes[r][1], sizes[r][2], 2044 + r, c);
+			NetworkFlow::maxFlow f(g, c);
+			NetworkFlow::lcg rng(r);
+			size_t wrong = 0;
+			long long total = 0;
+			for (size_t q = 0; q < 10; q++)
+			{
+				csrGraph::vertexId s = csrGraph::vertexId(rng(sizes[r][0])), t = csrGraph::vertexId(rng(sizes[r][0]));
+				long long expected = NetworkFlow::edmondsKarp(g, c, s, t);
+				total += expected;
+				long long value = f.dinic(s, t);
+				wrong += (value != expected) + NetworkFlow::violations(f, g, c, s, t, expected);
+				value = f.pushRelabel(s, t);
+				wrong += (value != expected) + NetworkFlow::violations(f, g, c, s, t, expected);
+			}
+			cout << "Random " << sizes[r][0] << " " << sizes[r][1] << " capacities up to " << sizes[r][2] << ": total flow " << total
+				<< ", mismatches " << wrong << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Global minimum cut                                       */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		const char* names[] = {"Stoer-Wagner: ", "Nagamochi-Ibaraki: ", "Karger-Stein: "};
+		const int edges[][3] = {{0,1,2}, {0,4,3}, {1,2,3}, {1,4,2}, {1,5,2}, {2,3,4}, {2,6,2}, {3,6,2}, {3,7,2}, {4,5,3}, {5,6,1}, {6,7,3}, {5,5,9}, {7,6,1}};
+		for (size_t scenario = 0; scenario < 2; scenario++)
+		{
+			NetworkFlow::undirectedGraph g;
+			std::vector<NetworkFlow::undirectedGraph::vertexDescriptor> v;
+			for (size_t i = 0; i < 8; i++) v.push_back(g.addVertex(new NetworkFlow::node(i)));
+			for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++)
+				if (0 == scenario || (edges[i][0] < 4) == (edges[i][1] < 4))
+					g.addEdge(v[edges[i][0]], v[edges[i][1]], new NetworkFlow::edge(edges[i][2]));
+			NetworkFlow::minCut c(g, graphProperties<NetworkFlow::undirectedGraph>::edgeProperty(g, &NetworkFlow::edge::m_capacity));
+			cout << ((0 == scenario) ? "Paper graph" : "Disconnected graph") << ", merged edges: " << c.numEdges() << endl;
+			for (size_t method = 0; method < 3; method++)
+			{
+				std::vector<csrGraph::vertexId> side;
+				long long value = (0 == method) ? c.stoerWagner(&side) : (1 == method) ? c.nagamochiIbaraki(&side) : c.kargerStein(0, 2, 7, &side);
+				cout << names[method] << value << ", side:";
+				for (size_t i = 0; i < side.size(); i++) cout << " " << side[i];
+				cout << endl;
+			}
+		}
+		NetworkFlow::undirectedGraph single;
+		single.addVertex(new NetworkFlow::node(0));
+		NetworkFlow::minCut one(single, propertyMap<long long>());
+		std::vector<csrGraph::vertexId> side(1, 0);
+		cout << "Single vertex: " << one.stoerWagner(&side) << " " << one.nagamochiIbaraki() << " " << one.kargerStein() << ", side size "
+			<< side.size() << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Global minimum cut on random graphs                      */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		const size_t sizes[][3] = {{8, 12, 5}, {10, 30, 1}, {12, 20, 100}, {14, 60, 10}, {14, 14, 3}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			size_t wrong = 0;
+			long long total = 0;
+			for (size_t q = 0; q < 20; q++)
+			{
+				propertyMap<long long> w;
+				csrGraph g = NetworkFlow::buildRandomUndirected(sizes[r][0], sizes[r][1], sizes[r][2], 4500 + 100 * r + q, w);
+				NetworkFlow::minCut c(g, w);
+				long long expected = NetworkFlow::bruteMinCut(g, w);
+				total += expected;
+				std::vector<csrGraph::vertexId> side;
+				long long value = c.stoerWagner(&side);
+				wrong += NetworkFlow::cutViolations(g, w, side, value, expected);
+				value = c.nagamochiIbaraki(&side);
+				wrong += NetworkFlow::cutViolations(g, w, side, value, expected);
+				value = c.kargerStein(0, 1 + q % 3, q, &side);
+				wrong += NetworkFlow::cutViolations(g, w, side, value, expected);
+			}
+			cout << "Random " << sizes[r][0] << " " << sizes[r][1] << " weights up to " << sizes[r][2] << ": total cut " << total
+				<< ", mismatches " << wrong << endl;
+		}
+		const size_t large[][4] = {{300, 1500, 10, 0}, {500, 1200, 1, 0}, {200, 4000, 1000, 0}, {300, 3000, 10, 3}};
+		for (size_t r = 0; r < sizeof(large) / sizeof(large[0]); r++)
+		{
+			propertyMap<long long> w;
+			csrGraph g = NetworkFlow::buildRandomUndirected(large[r][0], large[r][1], large[r][2], 4600 + r, w, large[r][3]);
+			NetworkFlow::minCut c(g, w);
+			std::vector<csrGraph::vertexId> side;
+			long long expected = c.stoerWagner(&side);
+			size_t wrong = NetworkFlow::cutViolations(g, w, side, expected, expected);
+			long long value = c.nagamochiIbaraki(&side);
+			wrong += NetworkFlow::cutViolations(g, w, side, value, expected);
+			value = c.kargerStein(2, 2, r, &side);
+			wrong += NetworkFlow::cutViolations(g, w, side, value, expected);
+			cout << "Random " << large[r][0] << " " << large[r][1] << " weights up to " << large[r][2] << " bridges " << large[r][3] << ": cut " << expected
+				<< ", side size " << side.size() << ", mismatches " << wrong << endl;
+		}
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Bipartite matching and assignment                        */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		// Jobs 0..3 and machines 4..7, machine 7 with no job and job 3 with a parallel edge
+		std::vector<NetworkFlow::jobEdge> edges;
+		const int list[][3] = {{0,4,4}, {0,5,1}, {1,4,2}, {1,5,3}, {2,5,5}, {2,6,2}, {3,5,1}, {3,5,7}};
+		for (size_t i = 0; i < sizeof(list) / sizeof(list[0]); i++)
+			edges.push_back(NetworkFlow::jobEdge(std::make_pair(list[i][0], list[i][1]), list[i][2]));
+		propertyMap<long long> cost;
+		csrGraph g = NetworkFlow::buildBipartite(8, edges, cost);
+		NetworkFlow::matching m(g);
+		NetworkFlow::assignment a(g, cost);
+		cout << "Matching: " << m.maximumMatching() << " bipartite " << m.isBipartite() << ", pairs:";
+		for (csrGraph::vertexId u = 0; u < 4; u++) cout << " " << u << "-" << (int)m.mate(u);
+		cout << endl << "Assignment: cost " << a.solve() << " size " << a.size() << ", pairs:";
+		for (csrGraph::vertexId u = 0; u < 4; u++) cout << " " << u << "-" << (int)a.mate(u);
+		cout << endl;
+		edges[1].second = 9;
+		edges.push_back(NetworkFlow::jobEdge(std::make_pair(3, 7), 0));
+		g = NetworkFlow::buildBipartite(8, edges, cost);
+		m.update(g);
+		a.update(g, cost);
+		cout << "Changed matching: " << m.maximumMatching() << ", pairs:";
+		for (csrGraph::vertexId u = 0; u < 4; u++) cout << " " << u << "-" << (int)m.mate(u);
+		cout << endl << "Changed assignment: cost " << a.solve() << " size " << a.size() << " searches " << a.lastSearches() << ", pairs:";
+		for (csrGraph::vertexId u = 0; u < 4; u++) cout << " " << u << "-" << (int)a.mate(u);
+		cout << endl;
+		edges.push_back(NetworkFlow::jobEdge(std::make_pair(6, 1), 0));
+		g = NetworkFlow::buildBipartite(8, edges, cost);
+		m.update(g);
+		cout << "Edge into a job: bipartite " << m.isBipartite() << endl;
+	}
+	{
+		const size_t sizes[][4] = {{5, 6, 10, 9}, {7, 5, 14, 100}, {8, 8, 30, 3}, {6, 9, 8, 50}};
+		for (size_t r = 0; r < sizeof(sizes) / sizeof(sizes[0]); r++)
+		{
+			NetworkFlow::lcg rng(4700 + r);
+			size_t wrong = 0, pairs = 0, jobs = sizes[r][0], n = jobs + sizes[r][1];
+			long long total = 0;
+			for (size_t q = 0; q < 20; q++)
+			{
+				std::vector<NetworkFlow::jobEdge> edges = NetworkFlow::randomJobs(jobs, sizes[r][1], sizes[r][2], sizes[r][3], rng);
+				propertyMap<long long> cost;
+				csrGraph g = NetworkFlow::buildBipartite(n, edges, cost);
+				NetworkFlow::matching m(g);
+				NetworkFlow::assignment a(g, cost);
+				for (size_t round = 0; round < 3; round++)
+				{
+					std::pair<size_t,long long> expected = NetworkFlow::assignmentReference(g, cost, jobs);
+					pairs += expected.first;
+					total += expected.second;
+					wrong += (m.maximumMatching() != NetworkFlow::kuhnMatching(g)) + (m.size() != expected.first);
+					a.solve();
+					wrong += NetworkFlow::assignmentViolations(a, g, cost, expected);
+					NetworkFlow::perturbJobs(edges, jobs, sizes[r][1], 2, sizes[r][3], rng);
+					g = NetworkFlow::buildBipartite(n, edges, cost);
+					m.update(g);
+					a.update(g, cost);
+				}
+			}
+			cout << "Random " << jobs << " jobs " << sizes[r][1] << " machines " << sizes[r][2] << " edges costs up to " << sizes[r][3]
+				<< ": pairs " << pairs << " total cost " << total << ", mismatches " << wrong << endl;
+		}
+	}
+	{
+		NetworkFlow::lcg rng(4800);
+		size_t jobs = 2000, machines = 2000;
+		std::vector<NetworkFlow::jobEdge> edges = NetworkFlow::randomJobs(jobs, machines, 12000, 1000, rng);
+		propertyMap<long long> cost;
+		csrGraph g = NetworkFlow::buildBipartite(jobs + machines, edges, cost);
+		NetworkFlow::matching m(g);
+		NetworkFlow::assignment a(g, cost);
+		size_t size = m.maximumMatching();
+		long long value = a.solve();
+		cout << "Large: matching " << size << " in " << m.lastPhases() << " phases, assignment cost " << value << " size " << a.size()
+			<< " with " << a.lastSearches() << " searches" << endl;
+		for (size_t round = 0; round < 3; round++)
+		{
+			NetworkFlow::perturbJobs(edges, jobs, machines, 5, 1000, rng);
+			g = NetworkFlow::buildBipartite(jobs + machines, edges, cost);
+			m.update(g);
+			a.update(g, cost);
+			size = m.maximumMatching();
+			value = a.solve();
+			NetworkFlow::assignment fresh(g, cost);
+			long long expected = fresh.solve();
+			cout << "After 5 changes: matching " << size << " in " << m.lastPhases() << " phases, assignment cost " << value << " with "
+				<< a.lastSearches() << " searches, from scratch " << expected << " with " << fresh.lastSearches() << " searches, mismatches "
+				<< (value != expected) + (a.size() != fresh.size()) + (size != a.size()) << endl;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,572 @@
+/**
+ *  @file ShortestPath/src/main.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the testing scenarios for the shortest path algorithms. All the data structures present in the file
+ *  are in a namespace called ShortestPath.
+ */
+#include <graph.hpp>
+#include <GraphCSR.hpp>
+#include <GraphShortestPath.hpp>
+#include <GraphPointToPoint.hpp>
+#include <GraphContraction.hpp>
+#include <GraphAllPairs.hpp>
+#include <GraphLabeling.hpp>
+#include <iostream>
+#include <vector>
+#include <sstream>
+
+using namespace std;
+
+/**
+ * @brief ShortestPath to wrap the object model specific to this testing suite.
+ */
+namespace ShortestPath
+{
+/**
+ * @brief Vertex OM for the graph
+ * @details This class has a single member to signify the ID of the graph vertex
+ */
+struct node
+{
+	size_t m_id;	///< Member to store the ID of the graph node
+
+	///@brief Default constructor for initializing class members
+	node():m_id(0){};
+
+	///@brief Single argument constructor to initialize class member m_id
+	node(size_t id):m_id(id){};
+};
+
+/**
+ * @brief Edge OM for the graph
+ * @details This class has a weight member to signify the length of the edge.
+ */
+struct edge
+{
+	int m_weight;		///< Weight of the edge.
+
+	///@brief Default constructor for initializing class members
+	edge():m_weight(0){};
+
+	///@brief Single argument constructor to initialize class members
+	edge(int weight):m_weight(weight){};
+};
+
+///@brief Linear congruential generator, so that the random scenarios give the same output everywhere
+struct lcg
+{
+	unsigned long long m_state;	///< Member to hold the state of the generator
+	///@brief Single argument constructor
+	explicit lcg(unsigned long long seed) : m_state(seed){}
+	///@brief Member function to get a number in 0..n-1
+	size_t operator() (size_t n)
+	{
+		m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+		return size_t(m_state >> 33) % n;
+	}
+};
+
+typedef graphShortestPath<int> shortestPath;	///< Shortest paths over the int weights of #edge
+typedef graphPointToPoint<int> pointToPoint;	///< Point to point queries over the int weights of #edge
+typedef contractionHierarchy<int> hierarchy;	///< Contraction Hierarchy over the int weights of #edge
+typedef graphAllPairs<int> allPairs;	///< All pairs shortest paths over the int weights of #edge
+typedef hubLabeling<int> labeling;	///< Pruned landmark labeling over the int weights of #edge
+
+///@brief Function to count the pairs on which two distance matrices differ
+template <class matrixType>
+size_t mismatches(const matrixType& a, const matrixType& b)
+{
+	size_t retVal = (a.size() != b.size());
+	for (size_t u = 0; u < a.size() && u < b.size(); u++)
+		for (size_t v = 0; v < a.size(); v++) retVal += (a(u, v) != b(u, v));
+	return retVal;
+}
+
+///@brief Manhattan distance to the target on a grid whose vertex v is at row v / side and column v % side, all weights at least 1
+struct manhattan
+{
+	size_t side;	///< Member to hold the side of the grid
+	size_t t;	///< Member to hold the target
+	///@brief Member function to get the lower bound of the distance from v to the target
+	long long operator() (size_t v) const
+	{
+		long long rows = (long long)(v / side) - (long long)(t / side), columns = (long long)(v % side) - (long long)(t % side);
+		return ((rows < 0) ? -rows : rows) + ((columns < 0) ? -columns : columns);
+	}
+};
+
+///@brief Function to print the distances, with - for the unreachable vertices
+void print(const char* name, const shortestPath::distanceMap& dist)
+{
+	cout << name << ":";
+	for (size_t v = 0; v < dist.size(); v++)
+	{
+		if (shortestPath::unreachable() == dist[v]) cout << " -";
+		else cout << " " << dist[v];
+	}
+	cout << endl;
+}
+
+///@brief Function to count the vertices on which two distance maps differ
+size_t mismatches(const shortestPath::distanceMap& a, const shortestPath::distanceMap& b)
+{
+	size_t retVal = (a.size() != b.size());
+	for (size_t v = 0; v < a.size() && v < b.size(); v++) retVal += (a[v] != b[v]);
+	return retVal;
+}
+
+/**
+ * @brief Function to count the pairs on which the labels disagree with Dijkstra from every step-th vertex to all the vertices
+ * @details Reachability is checked on all the labels, distances unless they were built for reachability only.
+ */
+size_t mismatches(const labeling& l, const csrGraph& g, const propertyMap<int>& w, size_t step = 1)
+{
+	size_t retVal = (l.numVertices() != g.numVertices());
+	for (csrGraph::vertexId s = 0; s < g.numVertices() && s < l.numVertices(); s += csrGraph::vertexId(step))
+	{
+		shortestPath::distanceMap dist = shortestPath::dijkstra(g, w, s);
+		for (csrGraph::vertexId t = 0; t < g.numVertices(); t++)
+		{
+			bool reached = (shortestPath::unreachable() != dist[t]);
+			retVal += (reached != l.reachable(s, t));
+			if (labeling::distances == l.getKind())
+				retVal += (reached ? (long long)l.distance(s, t) != dist[t] : labeling::unreachable() != l.distance(s, t));
+		}
+	}
+	return retVal;
+}
+
+/**
+ * @brief Function to build a graph of the given kind on a small scripted set of edges
+ * @details Vertex 5 is only reachable against the direction of its edge, vertex 6 not at all.
+ */
+template <class graphClass>
+void buildScripted(graphClass& g, std::vector<typename graphClass::vertexDescriptor>& v)
+{
+	const int edges[][3] = {{0,1,7}, {0,2,9}, {0,3,14}, {1,2,10}, {1,4,15}, {2,4,11}, {2,3,2}, {3,4,9}, {5,4,6}};
+	for (size_t i = 0; i < 7; i++) v.push_back(g.addVertex(new node(i)));
+	for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) g.addEdge(v[edges[i][0]], v[edges[i][1]], new edge(edges[i][2]));
+}
+}
+
+/**
+ * @brief Main function to run the shortest path test scenarios
+ * @details The scripted graph is searched as a directed and as a bidirectional #graph with Dijkstra and delta-stepping. Then
+ * delta-stepping runs on a random graph with several numbers of threads and bucket widths, and must agree with Dijkstra everywhere.
+ * Last the point to point queries answer the scripted graph, random pairs on the random graph, which must agree with Dijkstra,
+ * and one query on a grid, where the settled vertices show how much each method prunes. The Contraction Hierarchy is then checked
+ * the same way before and after a save and load, and damaged saves must fail to load. The pruned landmark labels must answer
+ * every pair on the scripted graph, the grid and a random graph with skewed degrees like Dijkstra, weighted and unweighted, for
+ * distances and for reachability only, directed and bidirectional, also after a save and load. Last the all pairs algorithms run
+ * on graphs with negative weights, with and without a negative cycle.
+ */
+int main()
+{
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Dijkstra and delta-stepping, directed and bidirectional  */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		ShortestPath::buildScripted(g, v);
+		propertyMap<int> w = graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		ShortestPath::shortestPath::distanceMap dist = ShortestPath::shortestPath::dijkstra(g, w, v[0]);
+		ShortestPath::print("Directed dijkstra", dist);
+		ShortestPath::print("Directed delta-stepping", ShortestPath::shortestPath::deltaStepping(g, w, v[0], 3, 5));
+
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::bidirectional> bidirectionalGraph;
+		bidirectionalGraph b;
+		std::vector<bidirectionalGraph::vertexDescriptor> bv;
+		ShortestPath::buildScripted(b, bv);
+		propertyMap<int> bw = graphProperties<bidirectionalGraph>::edgeProperty(b, &ShortestPath::edge::m_weight);
+		ShortestPath::print("Bidirectional dijkstra", ShortestPath::shortestPath::dijkstra(b, bw, bv[0]));
+		ShortestPath::print("Bidirectional delta-stepping", ShortestPath::shortestPath::deltaStepping(b, bw, bv[0], 2));
+		csrGraph csr(b);
+		cout << "Suggested delta: " << ShortestPath::shortestPath::suggestDelta(csr, csr.slotProperty(bw)) << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Delta-stepping against Dijkstra on a random graph       */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		const size_t n = 3000, m = 12000;
+		ShortestPath::lcg rng(2015);
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+		for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[rng(n)], new ShortestPath::edge(int(rng(100))));
+		csrGraph csr(g);
+		propertyMap<int> w = csr.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight));
+		csrGraph::vertexId source = 0;
+		for (csrGraph::vertexId u = 0; u < n; u++) if (csr.degree(u) > csr.degree(source)) source = u;
+		ShortestPath::shortestPath::distanceMap expected = ShortestPath::shortestPath::dijkstra(csr, w, source);
+		size_t reached = 0;
+		for (size_t i = 0; i < n; i++) reached += (ShortestPath::shortestPath::unreachable() != expected[i]);
+		cout << "Reached: " << reached << " of " << n << endl;
+		const int deltas[] = {0, 1, 7, 1000};
+		for (size_t t = 1; t <= 4; t *= 2)
+		{
+			cout << "Threads " << t << " mismatches:";
+			for (size_t d = 0; d < sizeof(deltas) / sizeof(deltas[0]); d++)
+				cout << " " << ShortestPath::mismatches(expected, ShortestPath::shortestPath::deltaStepping(csr, w, source, t, deltas[d]));
+			cout << endl;
+		}
+		// Weights far above the number of vertices, so a width of 1 caps the cycle of buckets
+		propertyMap<int> wide(w);
+		for (size_t slot = 0; slot < csr.numSlots(); slot++) wide[slot] = w[slot] * 100003 + 1;
+		expected = ShortestPath::shortestPath::dijkstra(csr, wide, source);
+		cout << "Wide weights, width 1, threads 1 and 4 mismatches: "
+			<< ShortestPath::mismatches(expected, ShortestPath::shortestPath::deltaStepping(csr, wide, source, 1, 1)) << " "
+			<< ShortestPath::mismatches(expected, ShortestPath::shortestPath::deltaStepping(csr, wide, source, 4, 1)) << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Point to point: bidirectional, A* and ALT                */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		ShortestPath::buildScripted(g, v);
+		propertyMap<int> w = graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		ShortestPath::pointToPoint p(g, w);
+		p.selectLandmarks(2);
+		const char* names[] = {"Scripted dijkstra", "Scripted bidirectional", "Scripted alt"};
+		for (size_t method = 0; method < 3; method++)
+		{
+			cout << names[method] << ":";
+			for (size_t t = 0; t < v.size(); t++)
+			{
+				long long d = (0 == method) ? p.dijkstra(0, t) : (1 == method) ? p.bidirectional(0, t) : p.alt(0, t);
+				if (ShortestPath::pointToPoint::unreachable() == d) cout << " -";
+				else cout << " " << d;
+			}
+			cout << endl;
+		}
+	}
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		const size_t n = 3000, m = 12000, noOfQueries = 300;
+		ShortestPath::lcg rng(2015);
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+		for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[rng(n)], new ShortestPath::edge(int(rng(100))));
+		csrGraph csr(g);
+		propertyMap<int> w = csr.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight));
+		ShortestPath::pointToPoint p(csr, w);
+		std::vector<csrGraph::vertexId> sources, targets;
+		std::vector<long long> expected;
+		for (size_t q = 0; q < noOfQueries; q++)
+		{
+			sources.push_back(csrGraph::vertexId(rng(n)));
+			targets.push_back(csrGraph::vertexId(rng(n)));
+			expected.push_back(ShortestPath::shortestPath::dijkstra(csr, w, sources[q])[targets[q]]);
+		}
+		cout << "Random mismatches (dijkstra, bidirectional, alt none, alt farthest, alt avoid):";
+		for (size_t method = 0; method < 5; method++)
+		{
+			if (method >= 2) p.selectLandmarks((2 == method) ? 0 : 4, (3 == method) ? ShortestPath::pointToPoint::farthest : ShortestPath::pointToPoint::avoid);
+			size_t wrong = 0;
+			for (size_t q = 0; q < noOfQueries; q++)
+			{
+				long long d = (0 == method) ? p.dijkstra(sources[q], targets[q]) : (1 == method) ? p.bidirectional(sources[q], targets[q]) : p.alt(sources[q], targets[q]);
+				wrong += (expected[q] != d);
+			}
+			cout << " " << wrong;
+		}
+		cout << endl;
+		cout << "Landmarks:";
+		for (size_t l = 0; l < p.landmarks().size(); l++) cout << " " << p.landmarks()[l];
+		cout << endl;
+	}
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::bidirectional> bidirectionalGraph;
+		const size_t side = 40;
+		ShortestPath::lcg rng(7);
+		bidirectionalGraph g;
+		std::vector<bidirectionalGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < side * side; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+		for (size_t r = 0; r < side; r++)
+			for (size_t c = 0; c < side; c++)
+			{
+				if (c + 1 < side) g.addEdge(v[r * side + c], v[r * side + c + 1], new ShortestPath::edge(int(1 + rng(9))));
+				if (r + 1 < side) g.addEdge(v[r * side + c], v[(r + 1) * side + c], new ShortestPath::edge(int(1 + rng(9))));
+			}
+		propertyMap<int> w = graphProperties<bidirectionalGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		ShortestPath::pointToPoint p(g, w);
+		const size_t s = side / 4 * side + 2, t = (side - 3) * side + side - side / 4;
+		ShortestPath::manhattan h = {side, t};
+		cout << "Grid dijkstra: " << p.dijkstra(s, t) << " settled " << p.lastSettled() << endl;
+		cout << "Grid bidirectional: " << p.bidirectional(s, t) << " settled " << p.lastSettled() << endl;
+		cout << "Grid A* manhattan: " << p.aStar(s, t, h) << " settled " << p.lastSettled() << endl;
+		p.selectLandmarks(8, ShortestPath::pointToPoint::farthest);
+		cout << "Grid alt farthest: " << p.alt(s, t) << " settled " << p.lastSettled() << endl;
+		p.selectLandmarks(8, ShortestPath::pointToPoint::avoid);
+		cout << "Grid alt avoid: " << p.alt(s, t) << " settled " << p.lastSettled() << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Contraction Hierarchies                                 */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		ShortestPath::buildScripted(g, v);
+		propertyMap<int> w = graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		ShortestPath::hierarchy ch(g, w);
+		cout << "Scripted shortcuts " << ch.numShortcuts() << ", ranks:";
+		for (size_t i = 0; i < v.size(); i++) cout << " " << ch.rank(csrGraph::vertexId(i));
+		cout << endl;
+		for (size_t s = 0; s < v.size(); s += 5)
+		{
+			cout << "Scripted from " << s << ":";
+			for (size_t t = 0; t < v.size(); t++)
+			{
+				long long d = ch.distance(csrGraph::vertexId(s), csrGraph::vertexId(t));
+				if (ShortestPath::hierarchy::unreachable() == d) cout << " -";
+				else cout << " " << d;
+			}
+			cout << endl;
+		}
+	}
+	{
+		const size_t side = 40, noOfQueries = 300;
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		ShortestPath::lcg rng(11);
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < side * side; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+		// A grid with one way streets, a few of them missing, and random long jumps
+		for (size_t r = 0; r < side; r++)
+			for (size_t c = 0; c < side; c++)
+			{
+				size_t u = r * side + c;
+				if (c + 1 < side && 0 != rng(10)) g.addEdge(v[(r % 2) ? u + 1 : u], v[(r % 2) ? u : u + 1], new ShortestPath::edge(int(1 + rng(9))));
+				if (r + 1 < side && 0 != rng(10)) g.addEdge(v[u], v[u + side], new ShortestPath::edge(int(1 + rng(9))));
+				if (r > 0 && 0 == rng(3)) g.addEdge(v[u], v[u - side], new ShortestPath::edge(int(1 + rng(9))));
+				if (0 == rng(50)) g.addEdge(v[u], v[rng(side * side)], new ShortestPath::edge(int(20 + rng(80))));
+			}
+		csrGraph csr(g);
+		propertyMap<int> w = csr.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight));
+		ShortestPath::hierarchy ch(csr, w);
+		cout << "Grid vertices " << ch.numVertices() << " arcs " << csr.numSlots() << " shortcuts " << ch.numShortcuts() << endl;
+		std::vector<csrGraph::vertexId> sources, targets;
+		std::vector<long long> expected;
+		size_t reached = 0;
+		for (size_t q = 0; q < noOfQueries; q++)
+		{
+			sources.push_back(csrGraph::vertexId(rng(side * side)));
+			targets.push_back(csrGraph::vertexId(rng(side * side)));
+			expected.push_back(ShortestPath::shortestPath::dijkstra(csr, w, sources[q])[targets[q]]);
+			reached += (ShortestPath::shortestPath::unreachable() != expected[q]);
+		}
+		size_t wrong = 0;
+		for (size_t q = 0; q < noOfQueries; q++) wrong += (expected[q] != ch.distance(sources[q], targets[q]));
+		cout << "Grid queries " << noOfQueries << " reachable " << reached << " mismatches " << wrong << endl;
+		std::stringstream saved;
+		cout << "Save: " << ch.save(saved) << endl;
+		std::string bytes = saved.str();
+		ShortestPath::hierarchy loaded;
+		cout << "Load: " << loaded.load(saved) << " vertices " << loaded.numVertices() << " shortcuts " << loaded.numShortcuts() << endl;
+		wrong = 0;
+		for (size_t q = 0; q < noOfQueries; q++) wrong += (expected[q] != loaded.distance(sources[q], targets[q]));
+		cout << "Loaded mismatches " << wrong << endl;
+		std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+		cout << "Load truncated: " << loaded.load(truncated) << " vertices " << loaded.numVertices() << endl;
+		std::string damaged = bytes;
+		damaged[0] = 'X';
+		std::stringstream badMagic(damaged);
+		cout << "Load bad magic: " << loaded.load(badMagic) << endl;
+		damaged = bytes;
+		// The first target of the upward arcs follows the header, the ranks and the upward offsets, each array after its length
+		size_t firstTarget = 4 * 8 + 8 + 4 * side * side + 8 + 8 * (side * side + 1) + 8;
+		damaged[firstTarget + 3] = char(0x7f);
+		std::stringstream badTarget(damaged);
+		cout << "Load bad target: " << loaded.load(badTarget) << endl;
+		damaged = bytes;
+		// The length of the ranks follows the header, set to the most ranks a hierarchy may have
+		for (size_t i = 0; i < 4; i++) damaged[4 * 8 + i] = char(0xff);
+		std::stringstream badLength(damaged);
+		cout << "Load bad length: " << loaded.load(badLength) << endl;
+		std::stringstream empty;
+		cout << "Save failed load: " << loaded.save(empty);
+		cout << " load it: " << loaded.load(empty);
+		cout << " vertices " << loaded.numVertices() << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Pruned landmark labeling                                */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::bidirectional> bidirectionalGraph;
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		ShortestPath::buildScripted(g, v);
+		csrGraph csr(g);
+		propertyMap<int> w = graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		ShortestPath::labeling weighted(g, w), unweighted(g), reach(g, ShortestPath::labeling::reachability);
+		for (size_t s = 0; s < v.size(); s += 5)
+		{
+			cout << "Scripted from " << s << ":";
+			for (size_t t = 0; t < v.size(); t++)
+			{
+				unsigned int d = weighted.distance(csrGraph::vertexId(s), csrGraph::vertexId(t));
+				if (ShortestPath::labeling::unreachable() == d) cout << " -";
+				else cout << " " << d;
+			}
+			cout << endl;
+		}
+		cout << "Scripted entries: weighted " << weighted.numEntries() << " unweighted " << unweighted.numEntries() << " reachability "
+			<< reach.numEntries() << " symmetric " << weighted.isSymmetric() << ", mismatches " << ShortestPath::mismatches(weighted, csr,
+			csr.slotProperty(w)) << " " << ShortestPath::mismatches(unweighted, csr, propertyMap<int>(csr.numSlots(), 1)) << " "
+			<< ShortestPath::mismatches(reach, csr, propertyMap<int>(csr.numSlots(), 1)) << endl;
+		bidirectionalGraph b;
+		std::vector<bidirectionalGraph::vertexDescriptor> bv;
+		ShortestPath::buildScripted(b, bv);
+		csrGraph bcsr(b);
+		propertyMap<int> bw = graphProperties<bidirectionalGraph>::edgeProperty(b, &ShortestPath::edge::m_weight);
+		ShortestPath::labeling both(b, bw);
+		cout << "Bidirectional entries " << both.numEntries() << " symmetric " << both.isSymmetric() << " mismatches "
+			<< ShortestPath::mismatches(both, bcsr, bcsr.slotProperty(bw)) << endl;
+	}
+	{
+		const size_t side = 40;
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		ShortestPath::lcg rng(11);
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < side * side; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+		// The grid of the Contraction Hierarchy, with one way streets, a few of them missing, and random long jumps
+		for (size_t r = 0; r < side; r++)
+			for (size_t c = 0; c < side; c++)
+			{
+				size_t u = r * side + c;
+				if (c + 1 < side && 0 != rng(10)) g.addEdge(v[(r % 2) ? u + 1 : u], v[(r % 2) ? u : u + 1], new ShortestPath::edge(int(1 + rng(9))));
+				if (r + 1 < side && 0 != rng(10)) g.addEdge(v[u], v[u + side], new ShortestPath::edge(int(1 + rng(9))));
+				if (r > 0 && 0 == rng(3)) g.addEdge(v[u], v[u - side], new ShortestPath::edge(int(1 + rng(9))));
+				if (0 == rng(50)) g.addEdge(v[u], v[rng(side * side)], new ShortestPath::edge(int(20 + rng(80))));
+			}
+		csrGraph csr(g);
+		propertyMap<int> w = csr.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight));
+		propertyMap<int> unit(csr.numSlots(), 1);
+		ShortestPath::labeling weighted(csr, w), unweighted(csr), reach(csr, ShortestPath::labeling::reachability);
+		const ShortestPath::labeling* kinds[] = {&weighted, &unweighted, &reach};
+		const char* names[] = {"weighted", "unweighted", "reachability"};
+		for (size_t k = 0; k < 3; k++)
+			cout << "Grid " << names[k] << ": entries " << kinds[k]->numEntries() << " average label " << kinds[k]->averageLabel()
+				<< " bytes " << kinds[k]->indexBytes() << " mismatches " << ShortestPath::mismatches(*kinds[k], csr, (0 == k) ? w : unit, 3) << endl;
+		std::stringstream saved;
+		cout << "Save: " << weighted.save(saved) << endl;
+		std::string bytes = saved.str();
+		ShortestPath::labeling loaded;
+		cout << "Load: " << loaded.load(saved) << " vertices " << loaded.numVertices() << " entries " << loaded.numEntries() << " mismatches "
+			<< ShortestPath::mismatches(loaded, csr, w, 7) << " build time " << loaded.buildSeconds() << endl;
+		std::stringstream reachSaved;
+		reach.save(reachSaved);
+		cout << "Load reachability: " << loaded.load(reachSaved) << " bytes " << reachSaved.str().size() << " mismatches "
+			<< ShortestPath::mismatches(loaded, csr, unit, 7) << endl;
+		std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+		cout << "Load truncated: " << loaded.load(truncated) << " vertices " << loaded.numVertices() << endl;
+		std::string damaged = bytes;
+		damaged[0] = 'X';
+		std::stringstream badMagic(damaged);
+		cout << "Load bad magic: " << loaded.load(badMagic) << endl;
+		damaged = bytes;
+		// The first hub of the out labels follows the header and the out offsets, each array after its length
+		size_t firstHub = 4 * 8 + 8 + 8 * (side * side + 1) + 8;
+		damaged[firstHub + 3] = char(0x7f);
+		std::stringstream badHub(damaged);
+		cout << "Load bad hub: " << loaded.load(badHub) << endl;
+	}
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::bidirectional> bidirectionalGraph;
+		const size_t n = 2000, m = 5000;
+		ShortestPath::lcg rng(50);
+		bidirectionalGraph g;
+		std::vector<bidirectionalGraph::vertexDescriptor> v;
+		for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+		// Every other edge goes to one of 20 hubs, so that the degrees are skewed
+		for (size_t i = 0; i < m; i++) g.addEdge(v[rng(n)], v[(0 == i % 2) ? rng(20) : rng(n)], new ShortestPath::edge(int(1 + rng(20))));
+		csrGraph csr(g);
+		propertyMap<int> w = csr.slotProperty(graphProperties<bidirectionalGraph>::edgeProperty(g, &ShortestPath::edge::m_weight));
+		ShortestPath::labeling weighted(g, graphProperties<bidirectionalGraph>::edgeProperty(g, &ShortestPath::edge::m_weight)), unweighted(g);
+		cout << "Skewed weighted: symmetric " << weighted.isSymmetric() << " average label " << weighted.averageLabel() << " mismatches "
+			<< ShortestPath::mismatches(weighted, csr, w, 5) << endl;
+		cout << "Skewed unweighted: symmetric " << unweighted.isSymmetric() << " average label " << unweighted.averageLabel() << " mismatches "
+			<< ShortestPath::mismatches(unweighted, csr, propertyMap<int>(csr.numSlots(), 1), 5) << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*All pairs: Floyd-Warshall and Johnson                   */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		directedGraph g;
+		std::vector<directedGraph::vertexDescriptor> v;
+		ShortestPath::buildScripted(g, v);
+		g.addEdge(v[4], v[1], new ShortestPath::edge(-12));
+		g.addEdge(v[6], v[5], new ShortestPath::edge(-3));
+		propertyMap<int> w = graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		ShortestPath::allPairs::distanceMatrix fw, johnson;
+		cout << "Floyd-Warshall: " << ShortestPath::allPairs::floydWarshall(g, w, fw) << " Johnson: "
+				<< ShortestPath::allPairs::johnson(g, w, johnson, 2) << " mismatches " << ShortestPath::mismatches(fw, johnson) << endl;
+		for (size_t u = 0; u < fw.size(); u++)
+		{
+			cout << "From " << u << ":";
+			for (size_t t = 0; t < fw.size(); t++)
+			{
+				if (ShortestPath::allPairs::unreachable() == fw(u, t)) cout << " -";
+				else cout << " " << fw(u, t);
+			}
+			cout << endl;
+		}
+		g.addEdge(v[4], v[2], new ShortestPath::edge(-12));
+		w = graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight);
+		cout << "Negative cycle: Floyd-Warshall " << ShortestPath::allPairs::floydWarshall(g, w, fw) << " size " << fw.size()
+				<< " Johnson " << ShortestPath::allPairs::johnson(g, w, johnson) << " size " << johnson.size() << endl;
+	}
+	{
+		// Weights base + p(u) - p(v) for a random potential p are often negative but add up along every cycle to the base weights
+		typedef graph<ShortestPath::node*, ShortestPath::edge*, graphTraits::directed> directedGraph;
+		const size_t n = 200;
+		ShortestPath::lcg rng(23);
+		std::vector<int> potential(n);
+		for (size_t i = 0; i < n; i++) potential[i] = int(rng(200));
+		for (size_t m = 600; m <= 18000; m *= 30)
+		{
+			directedGraph g;
+			std::vector<directedGraph::vertexDescriptor> v;
+			for (size_t i = 0; i < n; i++) v.push_back(g.addVertex(new ShortestPath::node(i)));
+			for (size_t i = 0; i < m; i++)
+			{
+				size_t a = rng(n), b = rng(n);
+				g.addEdge(v[a], v[b], new ShortestPath::edge(int(rng(50)) + potential[a] - potential[b]));
+			}
+			csrGraph csr(g);
+			propertyMap<int> w = csr.slotProperty(graphProperties<directedGraph>::edgeProperty(g, &ShortestPath::edge::m_weight));
+			ShortestPath::allPairs::distanceMatrix fw, fwThreads, johnson, johnsonThreads, chosen;
+			ShortestPath::allPairs::floydWarshall(csr, w, fw);
+			ShortestPath::allPairs::floydWarshall(csr, w, fwThreads, 3);
+			ShortestPath::allPairs::johnson(csr, w, johnson);
+			ShortestPath::allPairs::johnson(csr, w, johnsonThreads, 4);
+			ShortestPath::allPairs::allPairs(csr, w, chosen, 2);
+			graphAllPairs<int,int>::distanceMatrix narrow;
+			graphAllPairs<int,int>::floydWarshall(csr, w, narrow);
+			size_t narrowWrong = 0, reached = 0;
+			for (size_t a = 0; a < n; a++)
+				for (size_t b = 0; b < n; b++)
+				{
+					bool connected = (ShortestPath::allPairs::unreachable() != fw(a, b));
+					reached += connected;
+					narrowWrong += connected ? (fw(a, b) != narrow(a, b)) : (graphAllPairs<int,int>::unreachable() != narrow(a, b));
+				}
+			// Which algorithm allPairs picks depends on whether the AVX2 kernel is compiled in, so only its result is printed
+			cout << "Random m=" << m << " reached " << reached << " mismatches: threads " << ShortestPath::mismatches(fw, fwThreads) << " johnson " << ShortestPath::mismatches(fw, johnson)
+					<< " " << ShortestPath::mismatches(fw, johnsonThreads) << " chosen " << ShortestPath::mismatches(fw, chosen)
+					<< " int " << narrowWrong << endl;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,241 @@
+/**
+ *  @file UnionFindTest/src/main.cpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the testing scenarios for the dense union-find variants. All the helpers present in the file are in
+ *  a namespace called UnionFindTest.
+ */
+#include <RollbackUnionFind.hpp>
+#include <DynamicConnectivity.hpp>
+#include <PersistentUnionFind.hpp>
+#include <WeightedUnionFind.hpp>
+#include <iostream>
+#include <vector>
+#include <set>
+
+using namespace std;
+
+/**
+ * @brief UnionFindTest to wrap the helpers specific to this testing suite.
+ */
+namespace UnionFindTest
+{
+///@brief Linear congruential generator, so that the random scenarios give the same output everywhere
+struct lcg
+{
+	unsigned long long m_state;	///< Member to hold the state of the generator
+	///@brief Single argument constructor
+	explicit lcg(unsigned long long seed) : m_state(seed){}
+	///@brief Member function to get a number in 0..n-1
+	size_t operator() (size_t n)
+	{
+		m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+		return size_t(m_state >> 33) % n;
+	}
+};
+
+///@brief Function to check by a search over the alive edges whether u and v are connected
+bool connected(size_t n, const multiset<pair<size_t,size_t> >& edges, size_t u, size_t v)
+{
+	vector<vector<size_t> > adj(n);
+	for (multiset<pair<size_t,size_t> >::const_iterator e = edges.begin(); e != edges.end(); e++)
+	{
+		adj[e->first].push_back(e->second);
+		adj[e->second].push_back(e->first);
+	}
+	vector<bool> seen(n, false);
+	vector<size_t> stack(1, u);
+	seen[u] = true;
+	while (false == stack.empty())
+	{
+		size_t x = stack.back();
+		stack.pop_back();
+		for (size_t i = 0; i < adj[x].size(); i++)
+			if (false == seen[adj[x][i]])
+			{
+				seen[adj[x][i]] = true;
+				stack.push_back(adj[x][i]);
+			}
+	}
+	return seen[v];
+}
+}
+
+/**
+ * @brief Main function to run the union-find test scenarios
+ * @details The rollback union-find is checked for undoing unions back to checkpoints. The offline dynamic connectivity solver is
+ * run on a small scripted scenario and then compared with a search over the alive edges on a random one. The persistent union-find
+ * is queried about past times and compared with a replay of its unions batch by batch. The weighted union-find is fed constraints
+ * drawn from hidden potentials, some of them corrupted.
+ */
+int main()
+{
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Rollback union-find                                     */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		rollbackUnionFind<> uf(6);
+		uf.unite(0, 1);
+		uf.unite(2, 3);
+		size_t checkpoint = uf.checkpoint();
+		cout << "Components: " << uf.components() << endl;
+		cout << "Unite 1-3: " << uf.unite(1, 3) << " Unite 0-2: " << uf.unite(0, 2) << " Unite 4-5: " << uf.unite(4, 5) << endl;
+		cout << "Components: " << uf.components() << " 0~3: " << uf.connected(0, 3) << " 4~5: " << uf.connected(4, 5) << endl;
+		uf.rollback();
+		cout << "Undo last, components: " << uf.components() << " 0~3: " << uf.connected(0, 3) << " 4~5: " << uf.connected(4, 5) << endl;
+		uf.rollback(checkpoint);
+		cout << "Back to checkpoint, components: " << uf.components() << " 0~1: " << uf.connected(0, 1) << " 0~3: " << uf.connected(0, 3) << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Offline dynamic connectivity                            */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		offlineDynamicConnectivity<> dc(4);
+		dc.addEdge(0, 1);
+		dc.addEdge(1, 2);
+		dc.query(0, 2);
+		dc.removeEdge(1, 0);
+		dc.query(0, 2);
+		dc.addEdge(2, 3);
+		dc.addEdge(3, 0);
+		dc.query(0, 1);
+		dc.addEdge(3, 0);
+		dc.removeEdge(0, 3);
+		dc.query(0, 1);
+		dc.removeEdge(3, 0);
+		dc.query(0, 1);
+		cout << "Remove missing edge: " << dc.removeEdge(1, 3) << endl;
+		vector<bool> answers = dc.solve();
+		cout << "Answers:";
+		for (size_t i = 0; i < answers.size(); i++) cout << " " << answers[i];
+		cout << endl;
+
+		const size_t n = 12, noOfOperations = 400;
+		UnionFindTest::lcg rng(2015);
+		offlineDynamicConnectivity<> random(n);
+		multiset<pair<size_t,size_t> > edges;
+		vector<bool> expected;
+		for (size_t i = 0; i < noOfOperations; i++)
+		{
+			size_t op = rng(3), u = rng(n), v = rng(n);
+			pair<size_t,size_t> e(min(u, v), max(u, v));
+			if (0 == op)
+			{
+				random.addEdge(u, v);
+				edges.insert(e);
+			}
+			else if (1 == op && edges.end() != edges.find(e))
+			{
+				random.removeEdge(v, u);
+				edges.erase(edges.find(e));
+			}
+			else if (1 == op && false == edges.empty())
+			{
+				multiset<pair<size_t,size_t> >::iterator any = edges.begin();
+				random.removeEdge(any->first, any->second);
+				edges.erase(any);
+			}
+			else
+			{
+				random.query(u, v);
+				expected.push_back(UnionFindTest::connected(n, edges, u, v));
+			}
+		}
+		size_t matched = 0, connectedCount = 0;
+		answers = random.solve();
+		for (size_t i = 0; i < answers.size(); i++)
+		{
+			matched += (answers[i] == expected[i]);
+			connectedCount += answers[i];
+		}
+		cout << "Random: " << matched << " of " << answers.size() << " answers match, " << connectedCount << " connected" << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Persistent union-find                                   */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		persistentUnionFind<> uf(5);
+		uf.unite(0, 1, 1);
+		uf.unite(2, 3, 1);
+		uf.unite(1, 3, 2);
+		uf.unite(0, 2, 3);
+		uf.unite(3, 4, 5);
+		for (size_t t = 0; t <= 5; t++)
+			cout << "Time " << t << " components: " << uf.components(t) << " 0~3: " << uf.connected(0, 3, t) << " 0~4: " << uf.connected(0, 4, t) << endl;
+		cout << "Connected since 0~1: " << uf.connectedSince(0, 1) << " 0~3: " << uf.connectedSince(0, 3) << " 2~4: " << uf.connectedSince(2, 4) << endl;
+
+		// Replay the same unions batch by batch in a plain union-find and compare every pair after every batch
+		const size_t n = 40, noOfBatches = 25;
+		UnionFindTest::lcg rng(2016);
+		persistentUnionFind<> history(n);
+		rollbackUnionFind<> replay(n);
+		vector<vector<bool> > expected;
+		for (size_t t = 1; t <= noOfBatches; t++)
+		{
+			for (size_t i = 0; i < 2; i++)
+			{
+				size_t u = rng(n), v = rng(n);
+				history.unite(u, v, t);
+				replay.unite(u, v);
+			}
+			vector<bool> batch(n * n);
+			for (size_t u = 0; u < n; u++)
+				for (size_t v = 0; v < n; v++) batch[u * n + v] = replay.connected(u, v);
+			expected.push_back(batch);
+		}
+		size_t mismatches = 0, sinceMismatches = 0;
+		for (size_t t = 1; t <= noOfBatches; t++)
+			for (size_t u = 0; u < n; u++)
+				for (size_t v = 0; v < n; v++)
+				{
+					mismatches += (history.connected(u, v, t) != expected[t-1][u * n + v]);
+					size_t since = history.connectedSince(u, v);
+					sinceMismatches += (expected[t-1][u * n + v] != (since <= t));
+				}
+		cout << "Random: " << mismatches << " mismatches, " << sinceMismatches << " first-connected mismatches, " << history.components(noOfBatches) << " components left" << endl;
+	}
+	cout << "/**********************************************************/" << endl;
+	cout << "/*Weighted union-find                                     */" << endl;
+	cout << "/**********************************************************/" << endl;
+	{
+		weightedUnionFind<> uf(4);
+		long long d = 0;
+		cout << "Unite 0-1 by 3: " << uf.unite(0, 1, 3) << " Unite 1-2 by -5: " << uf.unite(1, 2, -5) << endl;
+		long long back = 0;
+		bool known = uf.diff(0, 2, d), knownBack = uf.diff(2, 0, back);
+		cout << "Diff 0-2: " << known << " " << d << " Diff 2-0: " << knownBack << " " << back << " Diff 0-3: " << uf.diff(0, 3, d) << endl;
+		cout << "Unite 2-0 by 2: " << uf.unite(2, 0, 2) << " Unite 2-0 by 3: " << uf.unite(2, 0, 3) << " Components: " << uf.components() << endl;
+
+		// Constraints between random pairs taken from hidden potentials, every fifth one off by one once the pair is connected
+		const size_t n = 200, noOfConstraints = 600;
+		UnionFindTest::lcg rng(2017);
+		vector<long long> potential(n);
+		for (size_t i = 0; i < n; i++) potential[i] = (long long)rng(1000) - 500;
+		weightedUnionFind<> random(n);
+		size_t outcomes[3] = {0, 0, 0}, expectedConflicts = 0;
+		for (size_t i = 0; i < noOfConstraints; i++)
+		{
+			size_t u = rng(n), v = rng(n);
+			long long w = potential[u] - potential[v];
+			if (0 == i % 5 && u != v && random.connected(u, v))
+			{
+				w++;
+				expectedConflicts++;
+			}
+			outcomes[random.unite(u, v, w)]++;
+		}
+		size_t wrongDiffs = 0, determined = 0;
+		for (size_t u = 0; u < n; u++)
+			for (size_t v = 0; v < n; v++)
+				if (random.diff(u, v, d))
+				{
+					determined++;
+					wrongDiffs += (d != potential[u] - potential[v]);
+				}
+		cout << "Random: " << outcomes[weightedUnionFind<>::merged] << " merged, " << outcomes[weightedUnionFind<>::consistent] << " consistent, "
+				<< outcomes[weightedUnionFind<>::conflict] << " conflicts of " << expectedConflicts << " corrupted, " << wrongDiffs << " wrong of "
+				<< determined << " determined differences" << endl;
+	}
+	return 0;
+}
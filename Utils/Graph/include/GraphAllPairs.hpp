@@ -0,0 +1,461 @@
+/**
+ * @file GraphAllPairs.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the all pairs shortest paths: a cache blocked Floyd-Warshall on a dense matrix, Johnson's algorithm
+ *  and the choice between them by density.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHALLPAIRS_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHALLPAIRS_HPP_
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphShortestPath.hpp"
+#include "GraphThreads.hpp"
+#include "OpStats.hpp"
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief [General Template]: inner loops of Floyd-Warshall, row[j] = min(row[j], dik + krow[j]) for j in 0..count-1
+ * @tparam	distanceType	Type of the distances
+ * @details The loops have no branches so that the compiler can vectorize them. Specializations for int and long long use AVX2
+ * directly when it is enabled.
+ */
+template <typename distanceType>
+struct allPairsKernel
+{
+	///@brief Function to relax a row of the matrix through the vertex k, whose row is krow and distance from the row's vertex dik
+	static void relax(distanceType* row, const distanceType* krow, distanceType dik, size_t count)
+	{
+		for (size_t j = 0; j < count; j++) row[j] = std::min(row[j], distanceType(dik + krow[j]));
+	}
+
+	///@brief Function to relax a row through four vertices at once, valid when none of them changes the rows or distances of the others
+	static void relaxFour(distanceType* row, const distanceType* const krow[4], const distanceType dik[4], size_t count)
+	{
+		for (size_t j = 0; j < count; j++)
+		{
+			distanceType a = std::min(distanceType(dik[0] + krow[0][j]), distanceType(dik[1] + krow[1][j]));
+			distanceType b = std::min(distanceType(dik[2] + krow[2][j]), distanceType(dik[3] + krow[3][j]));
+			row[j] = std::min(row[j], std::min(a, b));
+		}
+	}
+};
+
+#ifdef __AVX2__
+/**
+ * @brief [Specialization]: #allPairsKernel for 32 bit distances, eight per instruction
+ */
+template <>
+struct allPairsKernel<int>
+{
+	///@copydoc allPairsKernel::relax
+	static void relax(int* row, const int* krow, int dik, size_t count)
+	{
+		__m256i ik = _mm256_set1_epi32(dik);
+		size_t j = 0;
+		for (; j + 8 <= count; j += 8)
+		{
+			__m256i through = _mm256_add_epi32(ik, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(krow + j)));
+			__m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j), _mm256_min_epi32(current, through));
+		}
+		for (; j < count; j++) row[j] = std::min(row[j], dik + krow[j]);
+	}
+
+	///@copydoc allPairsKernel::relaxFour
+	static void relaxFour(int* row, const int* const krow[4], const int dik[4], size_t count)
+	{
+		__m256i ik[4];
+		for (size_t k = 0; k < 4; k++) ik[k] = _mm256_set1_epi32(dik[k]);
+		size_t j = 0;
+		for (; j + 8 <= count; j += 8)
+		{
+			__m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+			for (size_t k = 0; k < 4; k++)
+				best = _mm256_min_epi32(best, _mm256_add_epi32(ik[k], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(krow[k] + j))));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j), best);
+		}
+		for (; j < count; j++)
+			for (size_t k = 0; k < 4; k++) row[j] = std::min(row[j], dik[k] + krow[k][j]);
+	}
+};
+
+/**
+ * @brief [Specialization]: #allPairsKernel for 64 bit distances, four per instruction
+ * @details AVX2 has no 64 bit minimum, so it is made of a comparison and a blend.
+ */
+template <>
+struct allPairsKernel<long long>
+{
+	///@copydoc allPairsKernel::relax
+	static void relax(long long* row, const long long* krow, long long dik, size_t count)
+	{
+		__m256i ik = _mm256_set1_epi64x(dik);
+		size_t j = 0;
+		for (; j + 4 <= count; j += 4)
+		{
+			__m256i through = _mm256_add_epi64(ik, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(krow + j)));
+			__m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+			__m256i better = _mm256_cmpgt_epi64(current, through);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j), _mm256_blendv_epi8(current, through, better));
+		}
+		for (; j < count; j++) row[j] = std::min(row[j], dik + krow[j]);
+	}
+
+	///@copydoc allPairsKernel::relaxFour
+	static void relaxFour(long long* row, const long long* const krow[4], const long long dik[4], size_t count)
+	{
+		__m256i ik[4];
+		for (size_t k = 0; k < 4; k++) ik[k] = _mm256_set1_epi64x(dik[k]);
+		size_t j = 0;
+		for (; j + 4 <= count; j += 4)
+		{
+			__m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+			for (size_t k = 0; k < 4; k++)
+			{
+				__m256i through = _mm256_add_epi64(ik[k], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(krow[k] + j)));
+				best = _mm256_blendv_epi8(best, through, _mm256_cmpgt_epi64(best, through));
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j), best);
+		}
+		for (; j < count; j++)
+			for (size_t k = 0; k < 4; k++) row[j] = std::min(row[j], dik[k] + krow[k][j]);
+	}
+};
+#endif
+
+/**
+ * @brief All pairs shortest paths over a graph whose weights may be negative
+ * @tparam	weightType		Type of the edge weights
+ * @tparam	distanceType	Signed type of the path lengths. The longest shortest path must stay below an eighth of its maximum,
+ * which leaves room for the internal infinity of Floyd-Warshall.
+ * @tparam	stats			Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details Every algorithm first runs Bellman-Ford from a virtual source joined to all the vertices by zero arcs, which gives
+ * the potentials h with w(u,v) + h(u) - h(v) >= 0, or finds a negative cycle, in which case it returns false and the matrix is
+ * left empty.
+ *
+ * #floydWarshall works on the dense matrix in blocks of #blockSize square. For every diagonal block, that block is closed
+ * first, then the blocks of its row and column, then all the others, which only read the row and the column. Each step of a
+ * block walks rows which stay in cache and runs #allPairsKernel along them. The blocks of the last two steps are shared
+ * among the threads. #johnson reweights the arcs by the potentials and runs a Dijkstra per source, the sources being shared
+ * among the threads. #allPairs picks Floyd-Warshall for dense graphs and Johnson for sparse ones, see #preferFloydWarshall.
+ */
+template <typename weightType = int, typename distanceType = long long, class stats = defaultStatsPolicy>
+class graphAllPairs
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+	///@brief Member function to get the distance of the pairs which are not connected
+	static distanceType unreachable() {return std::numeric_limits<distanceType>::max();}
+
+	///@brief Member function to get the side of the blocks of Floyd-Warshall, 64 rows of 64 long long fill 32 KB
+	static size_t blockSize() {return 64;}
+
+	/**
+	 * @brief Dense matrix of the distances between all pairs of vertices
+	 */
+	class distanceMatrix
+	{
+		size_t m_size;	///< Member to hold the number of vertices
+		std::vector<distanceType> m_values;	///< Member to hold the distances row by row
+		friend class graphAllPairs;
+	public:
+		///@brief Default constructor, creates an empty matrix
+		distanceMatrix() : m_size(0){}
+		///@brief Member function to get the number of vertices
+		size_t size() const {return m_size;}
+		///@brief Member function to get the distance from u to v, #unreachable when there is no path
+		distanceType operator() (size_t u, size_t v) const {return m_values[u * m_size + v];}
+		///@brief Member function to get the distances from u to all the vertices
+		const distanceType* row(size_t u) const {return &m_values[u * m_size];}
+	};
+
+private:
+	///@brief Member function to get the infinity used inside Floyd-Warshall, which can be added to any distance without overflow
+	static distanceType infinity() {return std::numeric_limits<distanceType>::max() / 4;}
+
+	///@brief Member function to get the distances at or above which Floyd-Warshall treats a pair as not connected
+	static distanceType farAway() {return infinity() / 2;}
+
+	///@brief Items shared by the threads of #parallelFor
+	template <class functionType>
+	struct sharedItems
+	{
+		const functionType* f;	///< Member to hold the function run on every item
+		std::atomic<size_t> next;	///< Member to hold the next item to take
+		size_t count;	///< Member to hold the number of items
+	};
+
+	///@brief Member function to run a function on the items 0..count-1 shared among the given number of threads
+	template <class functionType>
+	static void parallelFor(size_t count, size_t noOfThreads, const functionType& f)
+	{
+		sharedItems<functionType> s;
+		s.f = &f;
+		s.next = 0;
+		s.count = count;
+		forkJoin(std::max<size_t>(1, std::min(noOfThreads, count)), worker<functionType>, &s);
+	}
+
+	///@brief Member function run by every thread of #parallelFor, taking items until none is left
+	template <class functionType>
+	static void worker(sharedItems<functionType>* s, size_t)
+	{
+		for (size_t i = s->next.fetch_add(1); i < s->count; i = s->next.fetch_add(1)) (*s->f)(i);
+	}
+
+	///@brief Function object closing one block of the matrix through the vertices of one diagonal block
+	struct blockUpdate
+	{
+		distanceType* d;	///< Member to hold the matrix
+		size_t n;	///< Member to hold the number of vertices
+		size_t kb;	///< Member to hold the diagonal block
+		const std::vector<std::pair<size_t,size_t> >* blocks;	///< Member to hold the blocks to update, by row and column
+
+		///@brief Member function to update the i-th block of the list
+		void operator() (size_t i) const {update((*blocks)[i].first, (*blocks)[i].second);}
+
+		/**
+		 * @brief Member function to update the block at block row ib and block column jb
+		 * @details A block off the row and the column of the diagonal block only reads blocks which do not change, so its rows are
+		 * taken one at a time and relaxed through four vertices per pass. The distances to vertices out of reach are raised to
+		 * #infinity there, so that the sums stay out of reach whatever is added to them.
+		 */
+		void update(size_t ib, size_t jb) const
+		{
+			size_t b = blockSize();
+			size_t k0 = kb * b, k1 = std::min(n, (kb + 1) * b), i1 = std::min(n, (ib + 1) * b), j0 = jb * b, j1 = std::min(n, (jb + 1) * b);
+			if (ib != kb && jb != kb)
+			{
+				for (size_t i = ib * b; i < i1; i++)
+				{
+					size_t k = k0;
+					for (; k + 4 <= k1; k += 4)
+					{
+						const distanceType* krow[4];
+						distanceType dik[4];
+						for (size_t q = 0; q < 4; q++)
+						{
+							krow[q] = d + (k + q) * n + j0;
+							dik[q] = (d[i * n + k + q] >= farAway()) ? infinity() : d[i * n + k + q];
+						}
+						allPairsKernel<distanceType>::relaxFour(d + i * n + j0, krow, dik, j1 - j0);
+					}
+					for (; k < k1; k++)
+						if (d[i * n + k] < farAway()) allPairsKernel<distanceType>::relax(d + i * n + j0, d + k * n + j0, d[i * n + k], j1 - j0);
+				}
+				return;
+			}
+			for (size_t k = k0; k < k1; k++)
+				for (size_t i = ib * b; i < i1; i++)
+				{
+					distanceType dik = d[i * n + k];
+					if (dik >= farAway()) continue;
+					allPairsKernel<distanceType>::relax(d + i * n + j0, d + k * n + j0, dik, j1 - j0);
+				}
+		}
+	};
+
+	///@brief Function object running the Dijkstra of one source for #johnson, without stats as it runs on several threads
+	struct johnsonSource
+	{
+		const csrGraph* g;	///< Member to hold the graph
+		const propertyMap<distanceType>* w;	///< Member to hold the reweighted arcs
+		const std::vector<distanceType>* h;	///< Member to hold the potentials
+		distanceType* d;	///< Member to hold the matrix
+
+		///@brief Member function to fill the row of source s
+		void operator() (size_t s) const
+		{
+			typedef graphShortestPath<distanceType,distanceType,noStats> shortestPath;
+			typename shortestPath::distanceMap dist = shortestPath::dijkstra(*g, *w, vertexId(s));
+			size_t n = g->numVertices();
+			for (size_t v = 0; v < n; v++)
+				d[s * n + v] = (shortestPath::unreachable() == dist[v]) ? unreachable() : dist[v] - (*h)[s] + (*h)[v];
+		}
+	};
+
+public:
+	/**
+	 * @brief Member function to compute the potentials with Bellman-Ford from a virtual source joined to every vertex
+	 * @param	g	The graph
+	 * @param	w	The weights in slot order
+	 * @param	h	Output, the distance of every vertex from the virtual source, zero or negative
+	 * @return false if the graph has a negative cycle
+	 */
+	static bool potentials(const csrGraph& g, const propertyMap<weightType>& w, std::vector<distanceType>& h)
+	{
+		size_t n = g.numVertices();
+		h.assign(n, 0);
+		for (size_t round = 0; round <= n; round++)
+		{
+			bool changed = false;
+			stats::edgeVisit(g.numSlots());
+			for (vertexId u = 0; u < n; u++)
+				for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				{
+					distanceType through = h[u] + w[slot];
+					if (through >= h[g.targets[slot]]) continue;
+					h[g.targets[slot]] = through;
+					changed = true;
+				}
+			if (false == changed) return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Member function to tell whether Floyd-Warshall is expected to beat Johnson
+	 * @details Floyd-Warshall costs about n^2 kernel steps per source whatever the graph, Johnson a Dijkstra per source, about m
+	 * arc relaxations and n log n heap steps. The costs are in tenths of a nanosecond as measured by the apsp mode of GraphBench,
+	 * with the kernel step about three times cheaper when the AVX2 kernel is compiled in.
+	 * @param	n		Number of vertices
+	 * @param	slots	Number of arcs
+	 */
+	static bool preferFloydWarshall(size_t n, size_t slots)
+	{
+#ifdef __AVX2__
+		const size_t kernelStep = 5;
+#else
+		const size_t kernelStep = 16;
+#endif
+		size_t logN = 1;
+		while ((size_t(1) << logN) < n) logN++;
+		return kernelStep * n * n <= 47 * slots + 200 * n * logN;
+	}
+
+	/**
+	 * @brief Member function to compute the distances between all pairs with the blocked Floyd-Warshall
+	 * @param	g			The graph
+	 * @param	w			The weights in slot order
+	 * @param	d			Output, the distance matrix
+	 * @param	noOfThreads	Number of threads sharing the blocks
+	 * @return false if the graph has a negative cycle
+	 */
+	static bool floydWarshall(const csrGraph& g, const propertyMap<weightType>& w, distanceMatrix& d, size_t noOfThreads = 1)
+	{
+		d = distanceMatrix();
+		std::vector<distanceType> h;
+		if (false == potentials(g, w, h)) return false;
+		size_t n = g.numVertices();
+		d.m_size = n;
+		d.m_values.assign(n * n, infinity());
+		for (vertexId u = 0; u < n; u++)
+		{
+			d.m_values[u * n + u] = 0;
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				distanceType& uv = d.m_values[u * n + g.targets[slot]];
+				uv = std::min(uv, distanceType(w[slot]));
+			}
+		}
+		if (0 == n) return true;
+		size_t nb = (n + blockSize() - 1) / blockSize();
+		std::vector<std::pair<size_t,size_t> > cross, rest;
+		for (size_t kb = 0; kb < nb; kb++)
+		{
+			blockUpdate step = {&d.m_values[0], n, kb, &cross};
+			step.update(kb, kb);
+			cross.clear();
+			rest.clear();
+			for (size_t b = 0; b < nb; b++)
+			{
+				if (b == kb) continue;
+				cross.push_back(std::make_pair(kb, b));
+				cross.push_back(std::make_pair(b, kb));
+				for (size_t c = 0; c < nb; c++) if (c != kb) rest.push_back(std::make_pair(b, c));
+			}
+			parallelFor(cross.size(), noOfThreads, step);
+			step.blocks = &rest;
+			parallelFor(rest.size(), noOfThreads, step);
+		}
+		for (size_t i = 0; i < n * n; i++) if (d.m_values[i] >= farAway()) d.m_values[i] = unreachable();
+		return true;
+	}
+
+	/**
+	 * @brief Member function to compute the distances between all pairs with Johnson's algorithm
+	 * @param	g			The graph
+	 * @param	w			The weights in slot order
+	 * @param	d			Output, the distance matrix
+	 * @param	noOfThreads	Number of threads sharing the sources
+	 * @return false if the graph has a negative cycle
+	 */
+	static bool johnson(const csrGraph& g, const propertyMap<weightType>& w, distanceMatrix& d, size_t noOfThreads = 1)
+	{
+		d = distanceMatrix();
+		std::vector<distanceType> h;
+		if (false == potentials(g, w, h)) return false;
+		size_t n = g.numVertices();
+		propertyMap<distanceType> reweighted(g.numSlots());
+		for (vertexId u = 0; u < n; u++)
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++) reweighted[slot] = w[slot] + h[u] - h[g.targets[slot]];
+		d.m_size = n;
+		d.m_values.resize(n * n);
+		if (0 == n) return true;
+		johnsonSource source = {&g, &reweighted, &h, &d.m_values[0]};
+		parallelFor(n, noOfThreads, source);
+		// Every search looked at the arcs of every vertex it reached once, counted here on the calling thread
+		if (true == stats::enabled)
+			for (size_t i = 0; i < n * n; i++) if (unreachable() != d.m_values[i]) stats::edgeVisit(g.degree(vertexId(i % n)));
+		return true;
+	}
+
+	/**
+	 * @brief Member function to compute the distances between all pairs with the algorithm suiting the density of the graph
+	 * @copydetails floydWarshall
+	 */
+	static bool allPairs(const csrGraph& g, const propertyMap<weightType>& w, distanceMatrix& d, size_t noOfThreads = 1)
+	{
+		if (true == preferFloydWarshall(g.numVertices(), g.numSlots())) return floydWarshall(g, w, d, noOfThreads);
+		return johnson(g, w, d, noOfThreads);
+	}
+
+	/**
+	 * @brief [Overload]: #allPairs on a #graph
+	 * @param	g			The graph, whose vertex indices index the matrix
+	 * @param	w			The weights keyed by #edge::index
+	 * @param	d			Output, the distance matrix
+	 * @param	noOfThreads	Number of threads
+	 * @return false if the graph has a negative cycle
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	static bool allPairs(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w,
+			distanceMatrix& d, size_t noOfThreads = 1)
+	{
+		csrGraph csr(g);
+		return allPairs(csr, csr.slotProperty(w), d, noOfThreads);
+	}
+
+	///@brief [Overload]: #floydWarshall on a #graph, see #allPairs
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	static bool floydWarshall(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w,
+			distanceMatrix& d, size_t noOfThreads = 1)
+	{
+		csrGraph csr(g);
+		return floydWarshall(csr, csr.slotProperty(w), d, noOfThreads);
+	}
+
+	///@brief [Overload]: #johnson on a #graph, see #allPairs
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	static bool johnson(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w,
+			distanceMatrix& d, size_t noOfThreads = 1)
+	{
+		csrGraph csr(g);
+		return johnson(csr, csr.slotProperty(w), d, noOfThreads);
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHALLPAIRS_HPP_ */
@@ -0,0 +1,315 @@
+/**
+ * @file GraphBetweenness.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the betweenness centrality of Brandes, exact over all the sources or estimated from a sample of them,
+ *  with the sources shared among threads.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHBETWEENNESS_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHBETWEENNESS_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <atomic>
+#include <cmath>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphThreads.hpp"
+#include "IndexedHeap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Betweenness centrality of the vertices of a graph, unweighted or with positive weights
+ * @tparam	weightType		Type of the edge weights, which must be positive
+ * @tparam	distanceType	Type of the path lengths, wide enough for the longest path
+ * @tparam	stats			Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The betweenness of v is the sum over the ordered pairs of other vertices s, t of the share of the shortest paths from s
+ * to t that pass through v. The pairs are ordered, so on a #graphTraits::bidirectional #graph, which holds both directions of
+ * every edge, every unordered pair counts twice and the values are twice the usual undirected ones.
+ *
+ * Brandes' algorithm runs one search per source s: a breadth first search, or Dijkstra with an #indexedHeap on the weighted graph,
+ * counts the shortest paths sigma to every vertex and records the order in which the vertices were settled. Going through that
+ * order backwards, the dependency of s on v is the sum over the out arcs v->w on a shortest path of sigma(v) / sigma(w) times one
+ * plus the dependency of w. The arcs on shortest paths are recognized from the distances, dist(w) = dist(v) + length, so there are
+ * no predecessor lists: everything lives in flat arrays of distances, path counts, dependencies and the settle order, and only the
+ * vertices a search reached are reset after it.
+ *
+ * Threads take the sources in chunks from an atomic counter, every one with its own arrays and its own accumulator of the
+ * dependencies, which are added up once all the sources are done. The sums are in double, so results on different numbers of
+ * threads can differ in the last bits.
+ *
+ * #approximate runs the searches from a uniform sample of k sources without replacement and scales the sum by n / k. The
+ * dependency of one source on v is between 0 and n - 2, so by Hoeffding's inequality, which holds for sampling without
+ * replacement, and the union bound over the vertices, every estimate is within (n - 1) n sqrt(ln(2n / failure) / 2k) of the exact
+ * value, with probability at least 1 - failure. #errorBound gives this bound and #samplesFor the sample size for a target.
+ */
+template <typename weightType = int, typename distanceType = long long, class stats = defaultStatsPolicy>
+class graphBetweenness
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<double> centralityMap;	///< Betweenness of every vertex
+
+	///@brief Member function to get the distance of the vertices which are not reachable
+	static distanceType unreachable() {return std::numeric_limits<distanceType>::max();}
+
+private:
+	csrGraph m_graph;	///< Member to hold the out arcs
+	std::vector<weightType> m_weights;	///< Member to hold the weight of every slot, empty for an unweighted graph
+	size_t m_searches;	///< Member to hold the number of searches of the last computation
+
+	/**
+	 * @brief Arrays of the searches of one thread
+	 */
+	struct searchState
+	{
+		std::vector<distanceType> dist;	///< Member to hold the distance of every vertex from the source
+		std::vector<double> sigma;	///< Member to hold the number of shortest paths to every vertex
+		std::vector<double> delta;	///< Member to hold the dependency of the source on every vertex
+		std::vector<vertexId> order;	///< Member to hold the reached vertices in the order they were settled
+		indexedHeap<distanceType,basic_heap_min_traits<distanceType>,noStats> heap;	///< Member to hold the queue of Dijkstra
+		std::vector<double> centrality;	///< Member to hold the sum of the dependencies of the sources of this thread
+		size_t visited;	///< Member to hold the arcs the searches of this thread visited, reported once the threads are joined
+
+		///@brief Constructor for n vertices
+		explicit searchState(size_t n) : dist(n, unreachable()),sigma(n, 0),delta(n, 0),heap(n),centrality(n, 0),visited(0){}
+	};
+
+	/**
+	 * @brief State shared by the threads
+	 */
+	struct sharedSources
+	{
+		const graphBetweenness* b;	///< Member to hold the graph
+		const std::vector<vertexId>* sources;	///< Member to hold the sources to search from
+		std::atomic<size_t> next;	///< Member to hold the position of the next chunk of sources
+		std::vector<searchState*> states;	///< Member to hold the arrays of every thread
+	};
+
+	///@brief Member function to get the length of a slot
+	distanceType length(size_t slot) const {return m_weights.empty() ? distanceType(1) : distanceType(m_weights[slot]);}
+
+	///@brief Member function to settle the vertices reachable from s, counting their shortest paths, by breadth first search
+	void breadthFirst(searchState& st, vertexId s) const
+	{
+		st.dist[s] = 0;
+		st.sigma[s] = 1;
+		st.order.push_back(s);
+		for (size_t head = 0; head < st.order.size(); head++)
+		{
+			vertexId v = st.order[head];
+			distanceType next = st.dist[v] + 1;
+			st.visited += m_graph.degree(v);
+			for (size_t slot = m_graph.offsets[v]; slot < m_graph.offsets[v+1]; slot++)
+			{
+				vertexId w = m_graph.targets[slot];
+				if (unreachable() == st.dist[w])
+				{
+					st.dist[w] = next;
+					st.order.push_back(w);
+				}
+				if (next == st.dist[w]) st.sigma[w] += st.sigma[v];
+			}
+		}
+	}
+
+	///@brief Member function to settle the vertices reachable from s, counting their shortest paths, by Dijkstra
+	void dijkstra(searchState& st, vertexId s) const
+	{
+		st.dist[s] = 0;
+		st.sigma[s] = 1;
+		st.heap.insert(s, 0);
+		while (false == st.heap.empty())
+		{
+			vertexId v = vertexId(st.heap.extractTop());
+			st.order.push_back(v);
+			st.visited += m_graph.degree(v);
+			for (size_t slot = m_graph.offsets[v]; slot < m_graph.offsets[v+1]; slot++)
+			{
+				vertexId w = m_graph.targets[slot];
+				distanceType next = st.dist[v] + distanceType(m_weights[slot]);
+				if (next < st.dist[w])
+				{
+					st.dist[w] = next;
+					st.sigma[w] = st.sigma[v];
+					st.heap.push(w, next);
+				}
+				else if (next == st.dist[w]) st.sigma[w] += st.sigma[v];
+			}
+		}
+	}
+
+	///@brief Member function to add the dependencies of source s to the accumulator of a thread and reset its arrays
+	void accumulate(searchState& st, vertexId s) const
+	{
+		if (true == m_weights.empty()) breadthFirst(st, s);
+		else dijkstra(st, s);
+		for (size_t i = st.order.size(); i-- > 0;)
+		{
+			vertexId v = st.order[i];
+			double share = 0;
+			for (size_t slot = m_graph.offsets[v]; slot < m_graph.offsets[v+1]; slot++)
+			{
+				vertexId w = m_graph.targets[slot];
+				if (unreachable() != st.dist[w] && st.dist[w] == st.dist[v] + length(slot)) share += (1 + st.delta[w]) / st.sigma[w];
+			}
+			st.delta[v] = st.sigma[v] * share;
+			if (v != s) st.centrality[v] += st.delta[v];
+		}
+		for (size_t i = 0; i < st.order.size(); i++)
+		{
+			vertexId v = st.order[i];
+			st.dist[v] = unreachable();
+			st.sigma[v] = 0;
+			st.delta[v] = 0;
+		}
+		st.order.clear();
+	}
+
+	///@brief Function run by every thread, searching from the sources of the chunks it takes
+	static void searchRange(sharedSources* s, size_t thread)
+	{
+		const std::vector<vertexId>& sources = *s->sources;
+		searchState& st = *s->states[thread];
+		const size_t chunk = 4;
+		for (size_t begin = s->next.fetch_add(chunk); begin < sources.size(); begin = s->next.fetch_add(chunk))
+			for (size_t i = begin; i < std::min(begin + chunk, sources.size()); i++) s->b->accumulate(st, sources[i]);
+	}
+
+	///@brief Member function to sum the dependencies of the given sources on every vertex, times scale
+	centralityMap run(const std::vector<vertexId>& sources, size_t noOfThreads, double scale)
+	{
+		size_t n = numVertices();
+		noOfThreads = std::max<size_t>(1, std::min(noOfThreads, sources.size()));
+		sharedSources s;
+		s.b = this;
+		s.sources = &sources;
+		s.next = 0;
+		for (size_t t = 0; t < noOfThreads; t++) s.states.push_back(new searchState(n));
+		forkJoin(noOfThreads, searchRange, &s);
+		centralityMap retVal(n, 0);
+		for (size_t t = 0; t < noOfThreads; t++)
+		{
+			for (size_t v = 0; v < n; v++) retVal[v] += s.states[t]->centrality[v];
+			stats::edgeVisit(s.states[t]->visited);
+			delete s.states[t];
+		}
+		for (size_t v = 0; v < n; v++) retVal[v] *= scale;
+		m_searches = sources.size();
+		return retVal;
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the betweenness of an unweighted #csrGraph
+	 * @param	g	The graph
+	 */
+	explicit graphBetweenness(const csrGraph& g) : m_graph(g),m_searches(0){}
+
+	/**
+	 * @brief Constructor to set up the betweenness of a weighted #csrGraph
+	 * @param	g	The graph
+	 * @param	w	The weights in slot order, e.g. from #csrGraph::slotProperty, all positive
+	 */
+	graphBetweenness(const csrGraph& g, const propertyMap<weightType>& w) : m_graph(g),m_weights(w.data(), w.data() + w.size()),m_searches(0){}
+
+	/**
+	 * @brief Constructor to set up the betweenness of an unweighted #graph
+	 * @param	g	The graph, whose vertex indices are the ids of the centrality map
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	explicit graphBetweenness(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g) : m_graph(g),m_searches(0){}
+
+	/**
+	 * @brief Constructor to set up the betweenness of a weighted #graph
+	 * @param	g	The graph, whose vertex indices are the ids of the centrality map
+	 * @param	w	The weights keyed by #edge::index, all positive
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	graphBetweenness(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w)
+		: m_graph(g),m_searches(0)
+	{
+		propertyMap<weightType> slots = m_graph.slotProperty(w);
+		m_weights.assign(slots.data(), slots.data() + slots.size());
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_graph.numVertices();}
+
+	///@brief Member function to get whether the paths are weighted
+	bool isWeighted() const {return false == m_weights.empty();}
+
+	///@brief Member function to get the number of searches of the last computation
+	size_t lastSearches() const {return m_searches;}
+
+	/**
+	 * @brief Member function to get the exact betweenness, with a search from every vertex
+	 * @param	noOfThreads	Number of threads sharing the sources
+	 */
+	centralityMap exact(size_t noOfThreads = 1)
+	{
+		std::vector<vertexId> sources(numVertices());
+		for (size_t v = 0; v < sources.size(); v++) sources[v] = vertexId(v);
+		return run(sources, noOfThreads, 1.0);
+	}
+
+	/**
+	 * @brief Member function to estimate the betweenness from a sample of sources
+	 * @param	samples		Number of sources, all the vertices when it is not below their number, which gives the exact values
+	 * @param	noOfThreads	Number of threads sharing the sources
+	 * @param	seed		Seed of the sample, the same seed giving the same sources
+	 * @param	failure		Chance that some estimate is off by more than the bound
+	 * @param	bound		Set to the #errorBound of the estimates if not NULL, 0 when they are exact
+	 */
+	centralityMap approximate(size_t samples, size_t noOfThreads = 1, unsigned long long seed = 1, double failure = 0.05, double* bound = NULL)
+	{
+		size_t n = numVertices();
+		if (samples >= n)
+		{
+			if (NULL != bound) *bound = 0;
+			return exact(noOfThreads);
+		}
+		std::vector<vertexId> sources(n);
+		for (size_t v = 0; v < n; v++) sources[v] = vertexId(v);
+		// The first samples places of a partial Fisher-Yates shuffle
+		std::mt19937_64 random(seed);
+		for (size_t i = 0; i < samples; i++) std::swap(sources[i], sources[i + size_t(random() % (n - i))]);
+		sources.resize(samples);
+		std::sort(sources.begin(), sources.end());
+		if (NULL != bound) *bound = errorBound(n, samples, failure);
+		return run(sources, noOfThreads, (0 == samples) ? 0.0 : double(n) / double(samples));
+	}
+
+	/**
+	 * @brief Function to get the most an estimate of #approximate is off by, except with the given chance
+	 * @param	n			Number of vertices
+	 * @param	samples		Number of sources sampled
+	 * @param	failure		Chance that some estimate is off by more
+	 */
+	static double errorBound(size_t n, size_t samples, double failure)
+	{
+		if (n < 3) return 0;
+		if (0 == samples) return double(n) * double(n - 1);
+		return double(n) * double(n - 1) * std::sqrt(std::log(2 * double(n) / failure) / (2 * double(samples)));
+	}
+
+	/**
+	 * @brief Function to get the number of sources for #approximate to be within epsilon n (n - 1) of every exact value
+	 * @param	n			Number of vertices
+	 * @param	epsilon		Error as a share of n (n - 1), the number of ordered pairs
+	 * @param	failure		Chance that some estimate is off by more
+	 */
+	static size_t samplesFor(size_t n, double epsilon, double failure)
+	{
+		if (n < 3) return 0;
+		return size_t(std::ceil(std::log(2 * double(n) / failure) / (2 * epsilon * epsilon)));
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHBETWEENNESS_HPP_ */
@@ -0,0 +1,70 @@
+/**
+ * @file GraphBinary.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the reading and writing of plain arrays shared by the binary save and load of the graph
+ *  structures.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHBINARY_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHBINARY_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdint.h>
+
+/**
+ * @brief Plain arrays in binary streams, each preceded by its length as a uint64_t
+ * @details The values are written as raw bytes in the byte order of the machine, so the readers check the sizes of the types in
+ * their own headers. Reading never trusts a length: beyond the limit the caller gives, the array grows by blocks as they arrive,
+ * so a damaged length fails at the end of the stream instead of allocating all of it first.
+ */
+class binaryArrays
+{
+public:
+	///@brief Number of values read at a time
+	static size_t blockSize() {return size_t(1) << 20;}
+
+	///@brief Function to write size plain values, preceded by their number, data being only read when size is not 0
+	template <typename valueType>
+	static void write(std::ostream& os, const valueType* data, uint64_t size)
+	{
+		os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+		if (0 != size) os.write(reinterpret_cast<const char*>(data), std::streamsize(size * sizeof(valueType)));
+	}
+
+	///@brief Function to write an array of plain values, preceded by its length
+	template <typename valueType>
+	static void write(std::ostream& os, const std::vector<valueType>& data)
+	{
+		write(os, data.empty() ? (const valueType*)NULL : &data[0], data.size());
+	}
+
+	/**
+	 * @brief Function to read an array written by #write
+	 * @param	is		The stream
+	 * @param	data	The array, replaced by the one read
+	 * @param	limit	Largest length to accept
+	 * @return false on a short read or a length over the limit
+	 */
+	template <typename valueType>
+	static bool read(std::istream& is, std::vector<valueType>& data, uint64_t limit)
+	{
+		uint64_t size = 0;
+		if (false == bool(is.read(reinterpret_cast<char*>(&size), sizeof(size))) || size > limit) return false;
+		data.clear();
+		for (size_t done = 0; done < size;)
+		{
+			size_t block = std::min<size_t>(size_t(size) - done, blockSize());
+			data.resize(done + block);
+			if (false == bool(is.read(reinterpret_cast<char*>(&data[done]), std::streamsize(block * sizeof(valueType))))) return false;
+			done += block;
+		}
+		return true;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHBINARY_HPP_ */
@@ -0,0 +1,120 @@
+/**
+ * @file GraphCSR.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the compressed sparse row (CSR) form of #graph, which is the flat read-only layout used by the
+ *  graph algorithms.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHCSR_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHCSR_HPP_
+
+#include <vector>
+#include <stdint.h>
+#include "graph.hpp"
+#include "GraphProperty.hpp"
+
+/**
+ * @brief Compressed sparse row adjacency of a #graph
+ * @details The out adjacency of vertex v is targets[offsets[v] .. offsets[v+1]). Vertices are identified by #base_vertex::index.
+ * Every position of targets is called a slot. edgeIndex maps a slot back to the #edge::index of the edge it came from, so any
+ * #propertyMap of the edges can be gathered into slot order with #slotProperty and then read sequentially along with targets.
+ * For a #graphTraits::bidirectional graph every edge gives two slots, one in each direction, sharing the same edge index.
+ * A #csrGraph is called symmetric when it holds both directions of every edge, as the one of a bidirectional graph does. The
+ * algorithms which read the graph as undirected take a symmetric one, and see every edge from both of its endpoints.
+ */
+class csrGraph
+{
+public:
+	typedef uint32_t vertexId;	///< Type of the dense vertex index stored in the adjacency
+	typedef const vertexId* neighborIterator;	///< Iterator over the adjacent vertices of a vertex
+	std::vector<size_t> offsets;	///< Member to hold the first slot of every vertex, with one extra entry holding the number of slots
+	std::vector<vertexId> targets;	///< Member to hold the adjacent vertex of every slot
+	std::vector<size_t> edgeIndex;	///< Member to hold the #edge::index of every slot
+
+	///@brief Default constructor, creates an empty graph
+	csrGraph() : offsets(1,0){}
+
+	/**
+	 * @brief Constructor to build the CSR from the out edges of a #graph
+	 * @param	g	The graph to be flattened. Its vertex indices must be dense, as given out by #base_graph::addVertex.
+	 */
+	template <class graphClass>
+	explicit csrGraph(graphClass& g) : offsets(1,0)
+	{
+		typedef typename graphClass::vertexDescriptor vertexDescriptor;
+		typedef typename graphClass::edgeDescriptor edgeDescriptor;
+		offsets.assign(g.size() + 1, 0);
+		for (vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++)
+			for (edgeDescriptor e = g.out_edges(v).first; e != g.out_edges(v).second; e++) offsets[v->index + 1]++;
+		for (size_t i = 0; i < g.size(); i++) offsets[i+1] += offsets[i];
+		targets.resize(offsets.back());
+		edgeIndex.resize(offsets.back());
+		for (vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++)
+		{
+			size_t slot = offsets[v->index];
+			for (edgeDescriptor e = g.out_edges(v).first; e != g.out_edges(v).second; e++, slot++)
+			{
+				targets[slot] = vertexId(e->sink->index);
+				edgeIndex[slot] = e->index;
+			}
+		}
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return offsets.size() - 1;}
+
+	///@brief Member function to get the number of slots, i.e. directed arcs
+	size_t numSlots() const {return targets.size();}
+
+	///@brief Member function to get the out degree of vertex v
+	size_t degree(vertexId v) const {return offsets[v+1] - offsets[v];}
+
+	///@brief Member function to provide the pointer to the first adjacent vertex of v
+	const vertexId* neighborBegin(vertexId v) const {return targets.empty() ? NULL : &targets[0] + offsets[v];}
+
+	///@brief Member function to provide the pointer past the last adjacent vertex of v
+	const vertexId* neighborEnd(vertexId v) const {return targets.empty() ? NULL : &targets[0] + offsets[v+1];}
+
+	/**
+	 * @brief Member function to gather a property of the edges into slot order
+	 * @param	edgeMap	Map keyed by #edge::index, e.g. from #graphProperties::edgeProperty
+	 * @return Map keyed by slot
+	 */
+	template <typename valueType>
+	propertyMap<valueType> slotProperty(const propertyMap<valueType>& edgeMap) const
+	{
+		propertyMap<valueType> retVal(numSlots());
+		for (size_t slot = 0; slot < numSlots(); slot++) retVal[slot] = edgeMap[edgeIndex[slot]];
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to get the reverse graph
+	 * @details Slot s of the result holding arc v->u comes from the arc u->v of this graph and keeps its edge index, so the edge
+	 * properties can be gathered with #slotProperty on the transpose as well. For a #graphTraits::directed graph this is the in
+	 * adjacency.
+	 * @return The transposed CSR
+	 */
+	csrGraph transpose() const
+	{
+		csrGraph retVal;
+		retVal.offsets.assign(numVertices() + 1, 0);
+		for (size_t slot = 0; slot < numSlots(); slot++) retVal.offsets[targets[slot] + 1]++;
+		for (size_t i = 0; i < numVertices(); i++) retVal.offsets[i+1] += retVal.offsets[i];
+		retVal.targets.resize(numSlots());
+		retVal.edgeIndex.resize(numSlots());
+		std::vector<size_t> next(retVal.offsets.begin(), retVal.offsets.end() - 1);
+		for (vertexId v = 0; v < numVertices(); v++)
+			for (size_t slot = offsets[v]; slot < offsets[v+1]; slot++)
+			{
+				size_t to = next[targets[slot]]++;
+				retVal.targets[to] = v;
+				retVal.edgeIndex[to] = edgeIndex[slot];
+			}
+		return retVal;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHCSR_HPP_ */
@@ -0,0 +1,637 @@
+/**
+ * @file GraphCommunities.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the community detection of undirected weighted graphs by modularity, Louvain and its Leiden
+ *  refinement, with parallel local moving and aggregation into a coarser #csrGraph at every level.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHCOMMUNITIES_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHCOMMUNITIES_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphThreads.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Communities of an undirected weighted graph by modularity
+ * @tparam	weightType	Type of the edge weights, a fundamental type. The weights must not be negative.
+ * @tparam	stats		Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The graph is read as undirected, from a #graphTraits::bidirectional #graph or a symmetric #csrGraph.
+ * Modularity with resolution g is the weight inside the communities less g times what a random graph of the same
+ * degrees would put there, both over the total weight. #detect returns a hierarchy of ever coarser partitions with the modularity
+ * of each.
+ *
+ * Every level starts with local moving: every vertex looks at the communities of its neighbors, through a sparse accumulator per
+ * thread, and picks the one where it adds the most modularity. The vertices are colored greedily so that no two neighbors share a
+ * color and the colors are moved one after another. The vertices of a color are shared among threads in chunks and decide on the
+ * same snapshot, which is exact for the weights to the communities since none of their neighbors moves meanwhile, and the moves
+ * which still gain with the strengths of the communities then are applied in order, so the result does not depend on the number
+ * of threads. The rounds stop when one adds less than the tolerance.
+ *
+ * Louvain then turns every community into a vertex of a coarser graph, with the weights between the communities summed, the
+ * weight inside a community kept as a loop, and starts the next level from singletons. The communities of local moving may be
+ * badly connected, even split in parts, and Leiden fixes that with a refinement before the aggregation: inside every community
+ * each vertex that is well connected to the rest of it, and still alone, joins the well connected sub community of its neighbors
+ * where it adds the most modularity, the greedy limit of the randomized choice of the paper, with the communities refined in
+ * parallel. The coarser graph is then built from the sub communities, which start the next level in the community they were
+ * refined from, so the communities found so far are kept while their parts can still move apart.
+ *
+ * Both stop when a level merges nothing. The coarser graphs are built in two parallel passes over the communities, one to count
+ * their distinct neighbors and one to fill them in, straight into the flat arrays of a #csrGraph.
+ */
+template <typename weightType = double, class stats = defaultStatsPolicy>
+class graphCommunities
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<vertexId> communityMap;	///< Community of every vertex, numbered from 0 in the order of their first vertex
+
+	///@brief Method of #detect
+	enum method
+	{
+		louvain,	///< Local moving and aggregation of the communities
+		leiden		///< Local moving, refinement and aggregation of the refined communities
+	};
+
+	/**
+	 * @brief Level of the hierarchy of #detect
+	 */
+	struct level
+	{
+		communityMap membership;	///< Member to hold the community of every vertex of the graph
+		size_t communities;	///< Member to hold the number of communities
+		double modularity;	///< Member to hold the modularity of the partition
+	};
+	typedef std::vector<level> hierarchy;	///< Partitions from the finest to the coarsest
+
+private:
+	/**
+	 * @brief Graph of a level, the original one or the communities of the previous level
+	 */
+	struct levelGraph
+	{
+		csrGraph g;	///< Member to hold the adjacency, without loops
+		std::vector<weightType> weight;	///< Member to hold the weight of every slot
+		std::vector<weightType> loop;	///< Member to hold the weight of the loops of every vertex, both directions counted
+		std::vector<weightType> strength;	///< Member to hold the weighted degree of every vertex, loops included
+	};
+
+	/**
+	 * @brief Sparse accumulator of weights keyed by community, one per thread
+	 */
+	struct accumulator
+	{
+		std::vector<weightType> weight;	///< Member to hold the weight gathered for every community, 0 when untouched
+		std::vector<bool> seen;	///< Member to hold whether every community has been touched
+		std::vector<vertexId> touched;	///< Member to hold the communities with a weight gathered
+
+		///@brief Member function to make room for the given number of communities
+		void reserve(size_t n)
+		{
+			weight.assign(n, 0);
+			seen.assign(n, false);
+		}
+
+		///@brief Member function to add w to community c
+		void add(vertexId c, weightType w)
+		{
+			if (false == seen[c])
+			{
+				seen[c] = true;
+				touched.push_back(c);
+			}
+			weight[c] += w;
+		}
+
+		///@brief Member function to forget everything gathered
+		void clear()
+		{
+			for (size_t i = 0; i < touched.size(); i++)
+			{
+				weight[touched[i]] = 0;
+				seen[touched[i]] = false;
+			}
+			touched.clear();
+		}
+	};
+
+	levelGraph m_graph;	///< Member to hold the graph
+	double m_total;	///< Member to hold the total weight, every edge counted in both directions
+
+	/**
+	 * @brief State shared by the threads of a parallel phase
+	 */
+	struct phaseState
+	{
+		const levelGraph* g;	///< Member to hold the graph of the level
+		double scale;	///< Member to hold the resolution over the total weight
+		std::atomic<size_t> next;	///< Member to hold the first item of the next chunk
+		std::vector<accumulator>* local;	///< Member to hold the accumulator of every thread
+		const std::vector<vertexId>* community;	///< Member to hold the community of every vertex
+		const std::vector<weightType>* totals;	///< Member to hold the strength of every community, for local moving
+		const std::vector<vertexId>* order;	///< Member to hold the vertices of local moving grouped by color
+		std::vector<char>* active;	///< Member to hold whether every vertex may move, having a neighbor which moved since it looked
+		size_t first;	///< Member to hold the position in order of the first vertex of the color being moved
+		size_t last;	///< Member to hold the position in order past the last vertex of the color being moved
+		std::vector<vertexId>* target;	///< Member to hold the community every vertex moves to in local moving
+		std::vector<std::pair<double,double> >* links;	///< Member to hold the weights of every vertex to its target and to its community
+		const std::vector<size_t>* groupOffsets;	///< Member to hold the first member of every group, for refinement and aggregation
+		const std::vector<vertexId>* members;	///< Member to hold the vertices of the groups one after another
+		std::vector<vertexId>* refined;	///< Member to hold the sub community of every vertex in refinement
+		std::vector<size_t>* counts;	///< Member to hold the distinct neighbors of every group in aggregation
+		levelGraph* coarse;	///< Member to hold the coarser graph, filled in by the second pass of aggregation
+		std::vector<size_t> visited;	///< Member to hold the edges every thread visited, reported once the threads are joined
+	};
+
+	///@brief Function to run work on the given threads, the calling one included, and report the edges they visited
+	static void runThreads(size_t noOfThreads, void (*work)(phaseState*, size_t), phaseState* s)
+	{
+		s->next = 0;
+		s->visited.assign(noOfThreads, 0);
+		forkJoin(noOfThreads, work, s);
+		for (size_t t = 0; t < noOfThreads; t++) stats::edgeVisit(s->visited[t]);
+	}
+
+	///@brief Function run by every thread of a round of local moving, picking the best allowed move of every vertex of its chunks
+	static void moveRange(phaseState* s, size_t thread)
+	{
+		const levelGraph& lg = *s->g;
+		const std::vector<vertexId>& community = *s->community;
+		const std::vector<weightType>& totals = *s->totals;
+		accumulator& acc = (*s->local)[thread];
+		const size_t chunk = 256, end = s->last;
+		size_t visited = 0;
+		for (size_t begin = s->first + s->next.fetch_add(chunk); begin < end; begin = s->first + s->next.fetch_add(chunk))
+			for (size_t i = begin; i < std::min(begin + chunk, end); i++)
+			{
+				vertexId v = (*s->order)[i], current = community[v];
+				(*s->target)[v] = current;
+				if (0 == (*s->active)[v]) continue;
+				(*s->active)[v] = 0;
+				visited += lg.g.degree(v);
+				for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++) acc.add(community[lg.g.targets[slot]], lg.weight[slot]);
+				double k = double(lg.strength[v]);
+				double stay = double(acc.weight[current]) - s->scale * k * (double(totals[current]) - k);
+				double best = stay;
+				vertexId target = current;
+				for (size_t j = 0; j < acc.touched.size(); j++)
+				{
+					vertexId c = acc.touched[j];
+					if (c == current) continue;
+					double gain = double(acc.weight[c]) - s->scale * k * double(totals[c]);
+					if (gain > best || (gain == best && target != current && c < target))
+					{
+						best = gain;
+						target = c;
+					}
+				}
+				(*s->target)[v] = target;
+				(*s->links)[v] = std::make_pair(double(acc.weight[target]), double(acc.weight[current]));
+				acc.clear();
+			}
+		s->visited[thread] = visited;
+	}
+
+	/**
+	 * @brief Function run by every thread of the refinement, refining every community of its chunks
+	 * @details The members are visited in increasing order. A member which is still alone and whose edges to the rest of the
+	 * community weigh at least the resolution times its strength times the strength of the rest over the total joins the sub
+	 * community of its neighbors which is as well connected and where it adds the most modularity, if any adds some.
+	 */
+	static void refineRange(phaseState* s, size_t thread)
+	{
+		const levelGraph& lg = *s->g;
+		const std::vector<vertexId>& community = *s->community;
+		const std::vector<size_t>& offsets = *s->groupOffsets;
+		const std::vector<vertexId>& members = *s->members;
+		std::vector<vertexId>& refined = *s->refined;
+		accumulator& acc = (*s->local)[thread];
+		std::vector<double> outside, strength;
+		std::vector<size_t> size;
+		const size_t chunk = 64, groups = offsets.size() - 1;
+		size_t visited = 0;
+		for (size_t begin = s->next.fetch_add(chunk); begin < groups; begin = s->next.fetch_add(chunk))
+			for (size_t c = begin; c < std::min(begin + chunk, groups); c++)
+			{
+				size_t first = offsets[c], count = offsets[c+1] - first;
+				// Sub communities are kept by the position of their founder among the members
+				outside.assign(count, 0);
+				strength.assign(count, 0);
+				size.assign(count, 1);
+				double whole = 0;
+				for (size_t i = 0; i < count; i++)
+				{
+					vertexId v = members[first + i];
+					refined[v] = vertexId(i);
+					strength[i] = double(lg.strength[v]);
+					whole += strength[i];
+					visited += lg.g.degree(v);
+					for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+						if (community[lg.g.targets[slot]] == c) outside[i] += double(lg.weight[slot]);
+				}
+				for (size_t i = 0; i < count; i++)
+				{
+					vertexId v = members[first + i];
+					double k = double(lg.strength[v]), own = outside[i];
+					if (1 != size[i] || refined[v] != i || own < s->scale * k * (whole - k)) continue;
+					for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+						if (community[lg.g.targets[slot]] == c) acc.add(refined[lg.g.targets[slot]], lg.weight[slot]);
+					double best = 0;
+					vertexId target = vertexId(i);
+					for (size_t j = 0; j < acc.touched.size(); j++)
+					{
+						vertexId t = acc.touched[j];
+						if (t == i || outside[t] < s->scale * strength[t] * (whole - strength[t])) continue;
+						double gain = double(acc.weight[t]) - s->scale * k * strength[t];
+						if (gain > best || (gain == best && target != i && t < target))
+						{
+							best = gain;
+							target = t;
+						}
+					}
+					if (target != i)
+					{
+						double between = double(acc.weight[target]);
+						outside[target] += own - 2 * between;
+						strength[target] += k;
+						size[target] += 1;
+						size[i] = 0;
+						refined[v] = target;
+					}
+					acc.clear();
+				}
+				// Founders' positions become vertex ids, unique across the communities
+				for (size_t i = 0; i < count; i++) refined[members[first + i]] = members[first + refined[members[first + i]]];
+			}
+		s->visited[thread] = visited;
+	}
+
+	///@brief Function run by every thread of the passes of aggregation, counting or filling the neighbors of every group of its chunks
+	static void aggregateRange(phaseState* s, size_t thread)
+	{
+		const levelGraph& lg = *s->g;
+		const std::vector<vertexId>& community = *s->community;
+		const std::vector<size_t>& offsets = *s->groupOffsets;
+		const std::vector<vertexId>& members = *s->members;
+		accumulator& acc = (*s->local)[thread];
+		const size_t chunk = 64, groups = offsets.size() - 1;
+		size_t visited = 0;
+		for (size_t begin = s->next.fetch_add(chunk); begin < groups; begin = s->next.fetch_add(chunk))
+			for (size_t c = begin; c < std::min(begin + chunk, groups); c++)
+			{
+				weightType loop = 0, strength = 0;
+				for (size_t i = offsets[c]; i < offsets[c+1]; i++)
+				{
+					vertexId v = members[i];
+					loop += lg.loop[v];
+					strength += lg.strength[v];
+					visited += lg.g.degree(v);
+					for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+					{
+						vertexId d = community[lg.g.targets[slot]];
+						if (d == c) loop += lg.weight[slot];
+						else acc.add(d, lg.weight[slot]);
+					}
+				}
+				if (NULL == s->coarse) (*s->counts)[c] = acc.touched.size();
+				else
+				{
+					levelGraph& coarse = *s->coarse;
+					size_t slot = coarse.g.offsets[c];
+					for (size_t i = 0; i < acc.touched.size(); i++, slot++)
+					{
+						coarse.g.targets[slot] = acc.touched[i];
+						coarse.g.edgeIndex[slot] = slot;
+						coarse.weight[slot] = acc.weight[acc.touched[i]];
+					}
+					coarse.loop[c] = loop;
+					coarse.strength[c] = strength;
+				}
+				acc.clear();
+			}
+		s->visited[thread] = visited;
+	}
+
+	///@brief Function to list the vertices of every group 0..groups-1 one after another, in increasing order within a group
+	static void group(const std::vector<vertexId>& of, size_t groups, std::vector<size_t>& offsets, std::vector<vertexId>& members)
+	{
+		offsets.assign(groups + 1, 0);
+		for (size_t v = 0; v < of.size(); v++) offsets[of[v] + 1]++;
+		for (size_t c = 0; c < groups; c++) offsets[c+1] += offsets[c];
+		members.resize(of.size());
+		std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+		for (size_t v = 0; v < of.size(); v++) members[next[of[v]]++] = vertexId(v);
+	}
+
+	///@brief Function to number the distinct values of ids from 0 in the order they first appear, returning how many there are
+	static size_t renumber(std::vector<vertexId>& ids, std::vector<vertexId>& scratch)
+	{
+		scratch.assign(ids.size(), vertexId(-1));
+		size_t retVal = 0;
+		for (size_t v = 0; v < ids.size(); v++)
+		{
+			if (vertexId(-1) == scratch[ids[v]]) scratch[ids[v]] = vertexId(retVal++);
+			ids[v] = scratch[ids[v]];
+		}
+		return retVal;
+	}
+
+	///@brief Function to get the modularity of a partition of a level graph with the given resolution
+	static double modularity(const levelGraph& lg, const std::vector<vertexId>& community, double total, double resolution)
+	{
+		if (0 == total) return 0;
+		std::vector<double> inside(lg.g.numVertices(), 0), totals(lg.g.numVertices(), 0);
+		for (vertexId v = 0; v < lg.g.numVertices(); v++)
+		{
+			inside[community[v]] += double(lg.loop[v]);
+			totals[community[v]] += double(lg.strength[v]);
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+				if (community[lg.g.targets[slot]] == community[v]) inside[community[v]] += double(lg.weight[slot]);
+		}
+		double retVal = 0;
+		for (size_t c = 0; c < inside.size(); c++) retVal += inside[c] / total - resolution * (totals[c] / total) * (totals[c] / total);
+		return retVal;
+	}
+
+	/**
+	 * @brief Function to color a level graph greedily so that no two adjacent vertices share a color
+	 * @param	lg		The level graph
+	 * @param	offsets	Set to the first position in order of every color, and the number of vertices at the end
+	 * @param	order	Set to the vertices grouped by color, in increasing order within a color
+	 */
+	static void color(const levelGraph& lg, std::vector<size_t>& offsets, std::vector<vertexId>& order)
+	{
+		size_t n = lg.g.numVertices(), colors = 0;
+		std::vector<vertexId> of(n);
+		std::vector<size_t> used;
+		for (vertexId v = 0; v < n; v++)
+		{
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+				if (lg.g.targets[slot] < v) used[of[lg.g.targets[slot]]] = v;
+			vertexId c = 0;
+			while (c < colors && v == used[c]) c++;
+			if (c == colors)
+			{
+				used.push_back(size_t(-1));
+				colors++;
+			}
+			of[v] = c;
+		}
+		group(of, colors, offsets, order);
+	}
+
+	/**
+	 * @brief Function to run local moving on a level graph
+	 * @details The colors are moved one after another. The vertices of a color pick their moves in parallel, which is exact
+	 * since none of their neighbors moves meanwhile, and then the moves which still gain with the strengths of the communities
+	 * left by the ones before them are applied in order.
+	 * @param	lg			The level graph
+	 * @param	community	The starting community of every vertex, ids below the number of vertices, set to the result
+	 * @param	local		The accumulator of every thread, for as many communities as vertices
+	 * @param	scale		The resolution over the total weight
+	 * @param	noOfThreads	Number of threads
+	 * @param	tolerance	Least modularity a round must add to go on
+	 * @param	total		The total weight, every edge counted in both directions
+	 * @return The number of moves
+	 */
+	static size_t localMoving(const levelGraph& lg, std::vector<vertexId>& community, std::vector<accumulator>& local, double scale, size_t noOfThreads,
+		double tolerance, double total)
+	{
+		size_t n = lg.g.numVertices(), retVal = 0;
+		std::vector<weightType> totals(n, 0);
+		for (size_t v = 0; v < n; v++) totals[community[v]] += lg.strength[v];
+		std::vector<vertexId> target(n), order;
+		std::vector<std::pair<double,double> > links(n);
+		std::vector<size_t> colors;
+		std::vector<char> active(n, 1);
+		color(lg, colors, order);
+		phaseState s;
+		s.g = &lg;
+		s.scale = scale;
+		s.local = &local;
+		s.active = &active;
+		s.community = &community;
+		s.totals = &totals;
+		s.target = &target;
+		s.links = &links;
+		s.order = &order;
+		for (size_t round = 0; round < maxRounds(); round++)
+		{
+			double added = 0;
+			for (size_t c = 0; c + 1 < colors.size(); c++)
+			{
+				s.first = colors[c];
+				s.last = colors[c+1];
+				// Colors too small to share are moved by the calling thread alone
+				runThreads((s.last - s.first < 1024) ? 1 : noOfThreads, moveRange, &s);
+				for (size_t i = s.first; i < s.last; i++)
+				{
+					vertexId v = order[i];
+					if (target[v] == community[v]) continue;
+					double k = double(lg.strength[v]);
+					double gain = links[v].first - s.scale * k * double(totals[target[v]]) - links[v].second + s.scale * k * (double(totals[community[v]]) - k);
+					if (gain <= 0) continue;
+					totals[community[v]] -= lg.strength[v];
+					totals[target[v]] += lg.strength[v];
+					community[v] = target[v];
+					for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++) active[lg.g.targets[slot]] = 1;
+					added += gain;
+					retVal++;
+				}
+			}
+			// Gains are in units of half the total weight of modularity
+			if (2 * added / total < tolerance) break;
+		}
+		return retVal;
+	}
+
+	///@brief Function to get the most rounds of local moving per level
+	static size_t maxRounds() {return 100;}
+
+	///@brief Member function to build the graph of a symmetric #csrGraph
+	template <typename valueType>
+	void init(const csrGraph& g, const propertyMap<valueType>& w)
+	{
+		size_t n = g.numVertices();
+		m_graph.g.offsets.assign(n + 1, 0);
+		m_graph.loop.assign(n, 0);
+		m_graph.strength.assign(n, 0);
+		for (vertexId u = 0; u < n; u++)
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				m_graph.strength[u] += weightType(w[slot]);
+				if (g.targets[slot] == u) m_graph.loop[u] += weightType(w[slot]);
+				else m_graph.g.offsets[u+1]++;
+			}
+		for (size_t i = 0; i < n; i++) m_graph.g.offsets[i+1] += m_graph.g.offsets[i];
+		m_graph.g.targets.resize(m_graph.g.offsets.back());
+		m_graph.g.edgeIndex.resize(m_graph.g.offsets.back());
+		m_graph.weight.resize(m_graph.g.offsets.back());
+		m_total = 0;
+		size_t next = 0;
+		for (vertexId u = 0; u < n; u++)
+		{
+			m_total += double(m_graph.strength[u]);
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				if (g.targets[slot] != u)
+				{
+					m_graph.g.targets[next] = g.targets[slot];
+					m_graph.g.edgeIndex[next] = next;
+					m_graph.weight[next++] = weightType(w[slot]);
+				}
+		}
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the communities of a #csrGraph
+	 * @param	g	The graph, a symmetric #csrGraph
+	 * @param	w	The weights in slot order, e.g. from #csrGraph::slotProperty, of any type converting to weightType
+	 */
+	template <typename valueType>
+	graphCommunities(const csrGraph& g, const propertyMap<valueType>& w) : m_total(0)
+	{
+		init(g, w);
+	}
+
+	/**
+	 * @brief Constructor to set up the communities of a #csrGraph with every edge weighing 1
+	 * @param	g	The graph, a symmetric #csrGraph
+	 */
+	explicit graphCommunities(const csrGraph& g) : m_total(0)
+	{
+		init(g, propertyMap<weightType>(g.numSlots(), 1));
+	}
+
+	/**
+	 * @brief Constructor to set up the communities of a #graph
+	 * @param	g	The graph, a #graphTraits::bidirectional one, whose vertex indices are the ids of the partitions
+	 * @param	w	The weights keyed by #edge::index, of any type converting to weightType
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer, typename valueType>
+	graphCommunities(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<valueType>& w) : m_total(0)
+	{
+		csrGraph csr(g);
+		init(csr, csr.slotProperty(w));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_graph.g.numVertices();}
+
+	///@brief Member function to get the total weight of the edges, loops included
+	double totalWeight() const {return m_total / 2;}
+
+	/**
+	 * @brief Member function to get the modularity of a partition of the graph
+	 * @param	membership	The community of every vertex, ids below the number of vertices
+	 * @param	resolution	The resolution, 1 for the classic modularity
+	 */
+	double modularity(const communityMap& membership, double resolution = 1.0) const
+	{
+		std::vector<vertexId> community(membership.data(), membership.data() + membership.size());
+		return modularity(m_graph, community, m_total, resolution);
+	}
+
+	/**
+	 * @brief Member function to detect the communities
+	 * @param	m			#louvain or #leiden
+	 * @param	resolution	The resolution, 1 for the classic modularity, higher for smaller communities
+	 * @param	noOfThreads	Number of threads of local moving, refinement and aggregation. The result does not depend on it.
+	 * @param	tolerance	Least modularity a round of local moving must add to go on
+	 * @param	maxLevels	Most levels to run
+	 * @return The partition of every level, from the finest to the coarsest. Every level merges some communities of the one before.
+	 */
+	hierarchy detect(method m = leiden, double resolution = 1.0, size_t noOfThreads = 1, double tolerance = 1e-6, size_t maxLevels = 32) const
+	{
+		hierarchy retVal;
+		size_t n = numVertices();
+		if (0 == n) return retVal;
+		noOfThreads = std::max<size_t>(1, noOfThreads);
+		std::vector<vertexId> original(n), community(n), refined, scratch, members;
+		std::vector<size_t> offsets, counts;
+		for (size_t v = 0; v < n; v++) original[v] = community[v] = vertexId(v);
+		levelGraph next;
+		const levelGraph* lg = &m_graph;
+		for (size_t depth = 0; depth < maxLevels; depth++)
+		{
+			size_t size = lg->g.numVertices();
+			std::vector<accumulator> local(noOfThreads);
+			for (size_t t = 0; t < noOfThreads; t++) local[t].reserve(size);
+			phaseState s;
+			s.g = lg;
+			s.scale = (0 == m_total) ? 0 : resolution / m_total;
+			s.local = &local;
+			size_t moves = localMoving(*lg, community, local, s.scale, noOfThreads, tolerance, (0 == m_total) ? 1 : m_total);
+			size_t groups = renumber(community, scratch);
+			if (0 == depth || groups < retVal.back().communities)
+			{
+				level l;
+				l.membership = communityMap(n);
+				for (size_t v = 0; v < n; v++) l.membership[v] = community[original[v]];
+				std::vector<vertexId> ids(l.membership.data(), l.membership.data() + n);
+				l.communities = renumber(ids, scratch);
+				for (size_t v = 0; v < n; v++) l.membership[v] = ids[v];
+				l.modularity = modularity(*lg, community, m_total, resolution);
+				retVal.push_back(l);
+			}
+			// Aggregates by the communities for Louvain and by their refinement for Leiden
+			std::vector<vertexId>* by = &community;
+			group(community, groups, offsets, members);
+			if (leiden == m)
+			{
+				refined.resize(size);
+				s.community = &community;
+				s.groupOffsets = &offsets;
+				s.members = &members;
+				s.refined = &refined;
+				runThreads(noOfThreads, refineRange, &s);
+				size_t parts = renumber(refined, scratch);
+				if (parts == size) break;
+				group(refined, parts, offsets, members);
+				by = &refined;
+			}
+			else if (0 == moves || groups == size) break;
+			size_t coarseSize = offsets.size() - 1;
+			counts.assign(coarseSize, 0);
+			s.community = by;
+			s.groupOffsets = &offsets;
+			s.members = &members;
+			s.counts = &counts;
+			s.coarse = NULL;
+			runThreads(noOfThreads, aggregateRange, &s);
+			levelGraph coarse;
+			coarse.g.offsets.assign(coarseSize + 1, 0);
+			for (size_t c = 0; c < coarseSize; c++) coarse.g.offsets[c+1] = coarse.g.offsets[c] + counts[c];
+			coarse.g.targets.resize(coarse.g.offsets.back());
+			coarse.g.edgeIndex.resize(coarse.g.offsets.back());
+			coarse.weight.resize(coarse.g.offsets.back());
+			coarse.loop.assign(coarseSize, 0);
+			coarse.strength.assign(coarseSize, 0);
+			s.coarse = &coarse;
+			runThreads(noOfThreads, aggregateRange, &s);
+			// The refined communities start the next level in the community they were refined from
+			std::vector<vertexId> start(coarseSize);
+			for (size_t c = 0; c < coarseSize; c++) start[c] = (leiden == m) ? community[members[offsets[c]]] : vertexId(c);
+			for (size_t v = 0; v < n; v++) original[v] = (*by)[original[v]];
+			community.swap(start);
+			next.g.offsets.swap(coarse.g.offsets);
+			next.g.targets.swap(coarse.g.targets);
+			next.g.edgeIndex.swap(coarse.g.edgeIndex);
+			next.weight.swap(coarse.weight);
+			next.loop.swap(coarse.loop);
+			next.strength.swap(coarse.strength);
+			lg = &next;
+		}
+		return retVal;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHCOMMUNITIES_HPP_ */
@@ -0,0 +1,339 @@
+/**
+ * @file GraphCompressed.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the compressed read-only adjacency of a #csrGraph. The sorted neighbor ids of every vertex are
+ *  delta encoded and the deltas are stored either as LEB128 varints or in the stream-vbyte layout. When the code is compiled
+ *  with SSSE3 (e.g. -mssse3 or -march=native) stream-vbyte rows are decoded four ids at a time with a byte shuffle.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHCOMPRESSED_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHCOMPRESSED_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+#include "GraphCSR.hpp"
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+/**
+ * @brief Compressed adjacency of a #csrGraph
+ * @details Row v starts at byte offsets[v] and holds the degree of v as a varint followed by the deltas of its neighbors in
+ * ascending order. The first delta is the zigzag encoded difference to v itself, the rest are the gaps between consecutive
+ * neighbors, so graphs whose neighbors have nearby ids (see #graphReorder) compress best. The difference is taken modulo 2^32,
+ * as a 32 bit signed value, so it fits in 32 bits for any two ids and adding it back to v gives the neighbor exactly. @n
+ * With #streamVByte the deltas are split in a control byte per four deltas, holding the byte length of each, followed by the
+ * data bytes. @n
+ * A row is visited in the same order as the row of a #csrGraph with sorted rows, e.g. one produced by #graphReorder::apply, so
+ * slot ordered property maps of such a #csrGraph can be read along with the compressed neighbors.
+ */
+class compressedGraph
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	///@brief Type to specify the byte layout of the deltas
+	typedef enum
+	{
+		varint,		///< Every delta is a LEB128 varint, 7 bits per byte
+		streamVByte	///< Deltas are 1 to 4 bytes with the lengths kept in separate control bytes
+	} encodingType;
+
+	/**
+	 * @brief Forward iterator over the neighbors of a vertex
+	 * @details The iterator decodes one delta at a time, so walking a row needs no buffer. Iterators of the same row compare equal
+	 * when they are at the same position.
+	 */
+	class neighborIterator
+	{
+		const uint8_t* m_control;	///< Member to hold the control bytes of a #streamVByte row, NULL for #varint
+		const uint8_t* m_data;	///< Member to hold the next data byte to be decoded
+		size_t m_position;	///< Member to hold the position in the row
+		size_t m_degree;	///< Member to hold the length of the row
+		vertexId m_value;	///< Member to hold the neighbor at m_position
+
+		///@brief Member function to decode the delta at m_position
+		uint32_t nextDelta()
+		{
+			if (NULL == m_control) return compressedGraph::readVarint(m_data);
+			return compressedGraph::readStreamDelta(m_control, m_data, m_position);
+		}
+	public:
+		///@brief Default constructor
+		neighborIterator() : m_control(NULL),m_data(NULL),m_position(0),m_degree(0),m_value(0){}
+		/**
+		 * @brief Constructor to position the iterator on the first neighbor of a row
+		 * @param	v		The vertex owning the row
+		 * @param	control	Control bytes of the row, NULL for #varint
+		 * @param	data	First data byte of the row
+		 * @param	degree	Number of neighbors in the row
+		 * @param	atEnd	Whether the iterator is to be positioned past the last neighbor instead
+		 */
+		neighborIterator(vertexId v, const uint8_t* control, const uint8_t* data, size_t degree, bool atEnd) :
+			m_control(control),m_data(data),m_position(atEnd ? degree : 0),m_degree(degree),m_value(v)
+		{
+			if (m_position < m_degree) m_value = compressedGraph::unzigzag(v, nextDelta());
+		}
+		///@brief Operator* to get the current neighbor
+		vertexId operator* () const {return m_value;}
+		///@brief Prefix operator++ to move to the next neighbor
+		neighborIterator& operator++ ()
+		{
+			if (++m_position < m_degree) m_value += nextDelta();
+			return *this;
+		}
+		///@brief Postfix operator++ to move to the next neighbor
+		neighborIterator operator++ (int)
+		{
+			neighborIterator retVal(*this);
+			++(*this);
+			return retVal;
+		}
+		bool operator== (const neighborIterator& that) const {return m_position == that.m_position;}	///< Equality operator
+		bool operator!= (const neighborIterator& that) const {return m_position != that.m_position;}	///< Inequality operator
+	};
+
+private:
+	std::vector<size_t> m_offsets;	///< Member to hold the first byte of every row, with one extra entry holding the size of m_bytes
+	std::vector<uint8_t> m_bytes;	///< Member to hold all the rows, padded by 16 bytes so that vector loads never read past it
+	size_t m_slots;	///< Member to hold the total number of neighbors
+	encodingType m_encoding;	///< Member to hold the layout of the deltas
+
+	///@brief Member function to zigzag encode the difference to - from modulo 2^32 so that small magnitudes give small values
+	static uint32_t zigzag(vertexId to, vertexId from)
+	{
+		uint32_t d = to - from;
+		return (d << 1) ^ (0u - (d >> 31));
+	}
+	///@brief Member function to add a zigzag encoded difference back to from, modulo 2^32
+	static vertexId unzigzag(vertexId from, uint32_t z) {return from + ((z >> 1) ^ (0u - (z & 1)));}
+
+	///@brief Member function to append x as a LEB128 varint
+	static void writeVarint(std::vector<uint8_t>& out, uint32_t x)
+	{
+		while (x >= 0x80)
+		{
+			out.push_back(uint8_t(x | 0x80));
+			x >>= 7;
+		}
+		out.push_back(uint8_t(x));
+	}
+
+	///@brief Member function to read a LEB128 varint and move p past it
+	static uint32_t readVarint(const uint8_t*& p)
+	{
+		uint32_t x = *p & 0x7f;
+		for (unsigned int shift = 7; *p++ & 0x80; shift += 7) x |= uint32_t(*p & 0x7f) << shift;
+		return x;
+	}
+
+	/**
+	 * @brief Member function to read the i-th #streamVByte delta of a row and move data past it
+	 * @details Four bytes are always loaded and the unused ones masked off, which the padding of m_bytes makes safe. The bytes are
+	 * little endian, as written by the constructor.
+	 */
+	static uint32_t readStreamDelta(const uint8_t* control, const uint8_t*& data, size_t i)
+	{
+		static const uint32_t masks[4] = {0xffu, 0xffffu, 0xffffffu, 0xffffffffu};
+		unsigned int code = (control[i >> 2] >> (2 * (i & 3))) & 3;
+		uint32_t delta;
+		memcpy(&delta, data, sizeof(delta));
+		data += code + 1;
+		return delta & masks[code];
+	}
+
+	///@brief Member function to get the number of bytes needed to store x in #streamVByte
+	static size_t byteLength(uint32_t x) {return (x < (1u << 8)) ? 1 : (x < (1u << 16)) ? 2 : (x < (1u << 24)) ? 3 : 4;}
+
+	///@brief Member function to get the start of the data bytes of a row, moving p past the degree
+	const uint8_t* rowStart(vertexId v, size_t& degree) const
+	{
+		const uint8_t* p = &m_bytes[m_offsets[v]];
+		degree = readVarint(p);
+		return p;
+	}
+
+#ifdef __SSSE3__
+	///@brief Shuffle masks spreading the data bytes of four deltas into four 32 bit lanes, one mask per control byte
+	struct shuffleTable
+	{
+		uint8_t mask[256][16];	///< The masks
+		uint8_t length[256];	///< Total number of data bytes used by each control byte
+		shuffleTable()
+		{
+			for (unsigned int c = 0; c < 256; c++)
+			{
+				uint8_t src = 0;
+				for (unsigned int lane = 0; lane < 4; lane++)
+				{
+					unsigned int l = ((c >> (2 * lane)) & 3) + 1;
+					for (unsigned int b = 0; b < 4; b++) mask[c][4*lane + b] = (b < l) ? src++ : 0x80;
+				}
+				length[c] = src;
+			}
+		}
+	};
+	///@brief Member function to provide the process wide #shuffleTable
+	static const shuffleTable& shuffles()
+	{
+		static shuffleTable table;
+		return table;
+	}
+#endif
+
+public:
+	///@brief Default constructor, creates an empty graph
+	compressedGraph() : m_offsets(1,0),m_bytes(16,0),m_slots(0),m_encoding(varint){}
+
+	/**
+	 * @brief Constructor to compress a #csrGraph
+	 * @param	g			The graph to be compressed
+	 * @param	encoding	The layout of the deltas
+	 * @details Rows that are not sorted are sorted while compressing.
+	 */
+	explicit compressedGraph(const csrGraph& g, encodingType encoding = streamVByte) : m_slots(g.numSlots()),m_encoding(encoding)
+	{
+		std::vector<vertexId> row;
+		std::vector<uint32_t> deltas;
+		m_offsets.resize(g.numVertices() + 1);
+		for (vertexId v = 0; v < g.numVertices(); v++)
+		{
+			m_offsets[v] = m_bytes.size();
+			row.assign(g.neighborBegin(v), g.neighborEnd(v));
+			std::sort(row.begin(), row.end());
+			deltas.resize(row.size());
+			for (size_t i = 0; i < row.size(); i++) deltas[i] = (0 == i) ? zigzag(row[0], v) : row[i] - row[i-1];
+			writeVarint(m_bytes, uint32_t(row.size()));
+			if (varint == encoding)
+			{
+				for (size_t i = 0; i < deltas.size(); i++) writeVarint(m_bytes, deltas[i]);
+				continue;
+			}
+			size_t control = m_bytes.size();
+			m_bytes.resize(m_bytes.size() + (row.size() + 3) / 4, 0);
+			for (size_t i = 0; i < deltas.size(); i++)
+			{
+				size_t length = byteLength(deltas[i]);
+				m_bytes[control + i/4] |= uint8_t((length - 1) << (2 * (i & 3)));
+				for (size_t b = 0; b < length; b++) m_bytes.push_back(uint8_t(deltas[i] >> (8 * b)));
+			}
+		}
+		m_offsets[g.numVertices()] = m_bytes.size();
+		m_bytes.resize(m_bytes.size() + 16, 0);
+	}
+
+	///@copydoc csrGraph::numVertices
+	size_t numVertices() const {return m_offsets.size() - 1;}
+
+	///@copydoc csrGraph::numSlots
+	size_t numSlots() const {return m_slots;}
+
+	///@copydoc csrGraph::degree
+	size_t degree(vertexId v) const
+	{
+		size_t retVal;
+		rowStart(v, retVal);
+		return retVal;
+	}
+
+	///@brief Member function to get the layout of the deltas
+	encodingType encoding() const {return m_encoding;}
+
+	///@brief Function to tell if #decode really uses SSSE3 for #streamVByte rows in this build
+	static bool simdAvailable()
+	{
+#ifdef __SSSE3__
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	///@brief Member function to get the bytes taken by the rows, without the per vertex offsets
+	size_t adjacencyBytes() const {return m_offsets.back();}
+
+	///@brief Member function to get the bytes taken by the rows and the per vertex offsets
+	size_t totalBytes() const {return m_offsets.back() + m_offsets.size() * sizeof(size_t);}
+
+	///@brief Member function to get the average number of bits per neighbor taken by the rows
+	double bitsPerEdge() const {return (0 == m_slots) ? 0 : 8.0 * adjacencyBytes() / m_slots;}
+
+	///@brief Member function to get the average number of bits per neighbor including the per vertex offsets
+	double totalBitsPerEdge() const {return (0 == m_slots) ? 0 : 8.0 * totalBytes() / m_slots;}
+
+	///@brief Member function to provide the iterator to the first neighbor of v
+	neighborIterator neighborBegin(vertexId v) const
+	{
+		size_t degree;
+		const uint8_t* p = rowStart(v, degree);
+		if (varint == m_encoding) return neighborIterator(v, NULL, p, degree, false);
+		return neighborIterator(v, p, p + (degree + 3) / 4, degree, false);
+	}
+
+	///@brief Member function to provide the iterator past the last neighbor of v
+	neighborIterator neighborEnd(vertexId v) const
+	{
+		size_t degree;
+		const uint8_t* p = rowStart(v, degree);
+		return neighborIterator(v, NULL, p, degree, true);
+	}
+
+	/**
+	 * @brief Member function to decode the whole row of v at once
+	 * @param	v	The vertex of which the neighbors are required
+	 * @param	out	Buffer to be filled, resized to the degree of v
+	 * @details This is the fast path for algorithms that scan complete rows. #streamVByte rows are decoded four deltas per
+	 * shuffle when SSSE3 is available, and the gaps are turned back into ids with a vector prefix sum.
+	 * @return The degree of v
+	 */
+	size_t decode(vertexId v, std::vector<vertexId>& out) const
+	{
+		size_t degree;
+		const uint8_t* p = rowStart(v, degree);
+		out.resize(degree);
+		if (0 == degree) return 0;
+		if (varint == m_encoding)
+		{
+			out[0] = unzigzag(v, readVarint(p));
+			for (size_t i = 1; i < degree; i++) out[i] = out[i-1] + readVarint(p);
+			return degree;
+		}
+		const uint8_t* control = p;
+		const uint8_t* data = p + (degree + 3) / 4;
+		size_t i = 0;
+#ifdef __SSSE3__
+		const shuffleTable& table = shuffles();
+		__m128i previous = _mm_setzero_si128();
+		for (; i + 4 <= degree; i += 4)
+		{
+			uint8_t c = control[i >> 2];
+			__m128i x = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(table.mask[c])));
+			data += table.length[c];
+			if (0 == i)
+			{
+				uint32_t first = uint32_t(_mm_cvtsi128_si32(x));
+				x = _mm_insert_epi16(x, 0, 0);
+				x = _mm_insert_epi16(x, 0, 1);
+				previous = _mm_set1_epi32(int32_t(unzigzag(v, first)));
+			}
+			x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+			x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+			x = _mm_add_epi32(x, previous);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), x);
+			previous = _mm_shuffle_epi32(x, 0xff);
+		}
+#endif
+		for (; i < degree; i++)
+		{
+			uint32_t delta = readStreamDelta(control, data, i);
+			out[i] = (0 == i) ? unzigzag(v, delta) : out[i-1] + delta;
+		}
+		return degree;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHCOMPRESSED_HPP_ */
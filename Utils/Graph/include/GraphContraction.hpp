@@ -0,0 +1,463 @@
+/**
+ * @file GraphContraction.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains Contraction Hierarchies: the preprocessing which orders and contracts the vertices, the query on
+ *  the resulting hierarchy and its binary save and load.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHCONTRACTION_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHCONTRACTION_HPP_
+
+#include <vector>
+#include <limits>
+#include <istream>
+#include <ostream>
+#include <stdint.h>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphBinary.hpp"
+#include "IndexedHeap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Contraction Hierarchy of a graph with non-negative weights, for exact point to point distances after preprocessing
+ * @tparam	weightType		Type of the edge weights, which must not be negative
+ * @tparam	distanceType	Type of the path lengths, wide enough for the longest path. Shortcuts are stored with this type.
+ * @tparam	stats			Stats policy which records the number of edges looked at by the queries. #noStats or #countingStats,
+ * selected by ALGOPP_STATS when not given.
+ * @details The preprocessing contracts the vertices one by one. Contracting v removes it from the remaining graph and adds a
+ * shortcut u->w of length d(u,v) + d(v,w) for every pair of remaining neighbors unless a witness search, a Dijkstra from u which
+ * avoids v and gives up after #witnessLimit settled vertices, finds a path which is not longer. The order comes from an
+ * #indexedHeap keyed by twice the edge difference, the shortcuts v would add minus the arcs it would remove, plus the number of
+ * neighbors already contracted to spread the contractions over the graph. Priorities are updated lazily: the top is recomputed and
+ * only contracted if it stays on top, and the neighbors of a contracted vertex are recomputed as well.
+ *
+ * The rank of a vertex is its position in the order. Every arc, original or shortcut, is stored once at its lower ranked end, in
+ * the upward CSR if it leads up and in the downward CSR, reversed, if it comes down. A query runs Dijkstra from s on the upward
+ * arcs and from t on the reversed downward arcs, and the distance is the best sum over the vertices reached by both. A vertex
+ * reached through a longer path than one coming down from a higher vertex is stalled and not expanded.
+ *
+ * #save and #load write and read the hierarchy as raw arrays in the byte order of the machine, with a header giving the sizes of
+ * the types.
+ */
+template <typename weightType = int, typename distanceType = long long, class stats = defaultStatsPolicy>
+class contractionHierarchy
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<distanceType> arcWeights;	///< Lengths of the arcs of the hierarchy in slot order
+
+	///@brief Member function to get the distance of the vertices which are not reachable
+	static distanceType unreachable() {return std::numeric_limits<distanceType>::max();}
+
+	///@brief Member function to get the number of vertices a witness search settles before giving up, a fifth of it when only
+	///counting the shortcuts for a priority
+	static size_t witnessLimit() {return 100;}
+
+private:
+	///@brief Arc of the remaining graph during the contraction
+	struct arc
+	{
+		vertexId to;	///< Member to hold the other end
+		distanceType w;	///< Member to hold the length
+	};
+
+	/**
+	 * @brief State of the preprocessing
+	 * @details The remaining graph keeps the in and out arcs of every vertex, with at most one arc per pair of vertices. Arcs to a
+	 * vertex are dropped from its neighbors once it is contracted.
+	 */
+	struct contractor
+	{
+		std::vector<std::vector<arc> > out;	///< Member to hold the out arcs of the remaining graph
+		std::vector<std::vector<arc> > in;	///< Member to hold the in arcs of the remaining graph
+		std::vector<size_t> deleted;	///< Member to hold the number of contracted neighbors of every vertex
+		std::vector<distanceType> dist;	///< Member to hold the distances of the witness search
+		std::vector<size_t> seen;	///< Member to hold the witness search in which every distance was last set
+		size_t round;	///< Member to hold the number of witness searches run so far
+		std::vector<size_t> target;	///< Member to hold the contraction whose out neighbors every vertex was last among
+		size_t contraction;	///< Member to hold the number of contractions, real or simulated, run so far
+		size_t noOfTargets;	///< Member to hold the number of out neighbors of the current contraction
+		indexedHeap<distanceType,basic_heap_min_traits<distanceType>,noStats> queue;	///< Member to hold the queue of the witness search
+
+		///@brief Constructor for n vertices without arcs
+		explicit contractor(size_t n) : out(n),in(n),deleted(n, 0),dist(n),seen(n, 0),round(0),target(n, 0),contraction(0),noOfTargets(0),queue(n){}
+
+		///@brief Member function to add the arc u->v, or shorten it if it is there already
+		static void addArc(std::vector<arc>& arcs, vertexId v, distanceType w)
+		{
+			for (size_t i = 0; i < arcs.size(); i++)
+				if (v == arcs[i].to)
+				{
+					arcs[i].w = std::min(arcs[i].w, w);
+					return;
+				}
+			arc a = {v, w};
+			arcs.push_back(a);
+		}
+
+		///@brief Member function to drop the arcs to v from a list
+		static void dropArcs(std::vector<arc>& arcs, vertexId v)
+		{
+			for (size_t i = 0; i < arcs.size(); )
+			{
+				if (v == arcs[i].to)
+				{
+					arcs[i] = arcs.back();
+					arcs.pop_back();
+				}
+				else i++;
+			}
+		}
+
+		///@brief Member function to get the witness distance of v, #unreachable if the last search did not reach it
+		distanceType witness(vertexId v) const {return (round == seen[v]) ? dist[v] : unreachable();}
+
+		/**
+		 * @brief Member function to run a witness search from u avoiding v
+		 * @details The search stops once it has settled all the out neighbors of v, gone beyond the given length or settled the
+		 * given number of vertices.
+		 */
+		void witnessSearch(vertexId u, vertexId v, distanceType limit, size_t settleLimit)
+		{
+			round++;
+			queue.clear();
+			seen[u] = round;
+			dist[u] = 0;
+			queue.insert(u, 0);
+			size_t targetsLeft = noOfTargets;
+			for (size_t settled = 0; false == queue.empty() && settled < settleLimit && queue.topKey() <= limit && 0 != targetsLeft; settled++)
+			{
+				vertexId x = vertexId(queue.extractTop());
+				if (contraction == target[x]) targetsLeft--;
+				for (size_t i = 0; i < out[x].size(); i++)
+				{
+					const arc& a = out[x][i];
+					if (v == a.to) continue;
+					distanceType d = dist[x] + a.w;
+					if (d >= witness(a.to)) continue;
+					seen[a.to] = round;
+					dist[a.to] = d;
+					queue.push(a.to, d);
+				}
+			}
+		}
+
+		/**
+		 * @brief Member function to find the shortcuts needed to contract v, and add them if asked
+		 * @details The shorter witness searches used when only counting may miss witnesses, which only makes the priority worse.
+		 * @return Number of shortcuts needed
+		 */
+		size_t shortcuts(vertexId v, bool add)
+		{
+			size_t retVal = 0;
+			distanceType maxOut = 0;
+			contraction++;
+			noOfTargets = out[v].size();
+			for (size_t j = 0; j < out[v].size(); j++)
+			{
+				maxOut = std::max(maxOut, out[v][j].w);
+				target[out[v][j].to] = contraction;
+			}
+			for (size_t i = 0; i < in[v].size(); i++)
+			{
+				arc first = in[v][i];
+				witnessSearch(first.to, v, first.w + maxOut, add ? witnessLimit() : witnessLimit() / 5);
+				for (size_t j = 0; j < out[v].size(); j++)
+				{
+					arc second = out[v][j];
+					if (first.to == second.to || witness(second.to) <= first.w + second.w) continue;
+					retVal++;
+					if (false == add) continue;
+					addArc(out[first.to], second.to, first.w + second.w);
+					addArc(in[second.to], first.to, first.w + second.w);
+				}
+			}
+			return retVal;
+		}
+
+		///@brief Member function to get the priority of v, smaller is contracted first
+		long long priority(vertexId v)
+		{
+			return 2 * ((long long)(shortcuts(v, false)) - (long long)(in[v].size() + out[v].size())) + (long long)(deleted[v]);
+		}
+	};
+
+	std::vector<vertexId> m_rank;	///< Member to hold the rank of every vertex
+	csrGraph m_up;	///< Member to hold the arcs to higher ranked vertices
+	arcWeights m_upWeights;	///< Member to hold the lengths of the upward arcs
+	csrGraph m_down;	///< Member to hold, reversed, the arcs from higher ranked vertices
+	arcWeights m_downWeights;	///< Member to hold the lengths of the downward arcs
+	size_t m_shortcuts;	///< Member to hold the number of shortcuts added by the preprocessing
+	std::vector<distanceType> m_dist[2];	///< Member to hold the tentative distances of the forward and backward searches
+	std::vector<size_t> m_seen[2];	///< Member to hold the query in which every distance was last set
+	size_t m_query;	///< Member to hold the number of queries run so far
+	size_t m_settled;	///< Member to hold the number of vertices settled by the last query
+	indexedHeap<distanceType,basic_heap_min_traits<distanceType>,noStats> m_queue[2];	///< Member to hold the queues of the searches
+
+	///@brief Member function to get the tentative distance of v in the search of the given direction, 0 forward and 1 backward
+	distanceType dist(size_t direction, vertexId v) const {return (m_query == m_seen[direction][v]) ? m_dist[direction][v] : unreachable();}
+
+	///@brief Member function to set the tentative distance of v in the search of the given direction
+	void setDist(size_t direction, vertexId v, distanceType d)
+	{
+		m_seen[direction][v] = m_query;
+		m_dist[direction][v] = d;
+	}
+
+	///@brief Member function to size the query arrays for the vertices of the hierarchy
+	void initQueries()
+	{
+		for (size_t d = 0; d < 2; d++)
+		{
+			m_dist[d].assign(m_rank.size(), unreachable());
+			m_seen[d].assign(m_rank.size(), 0);
+			m_queue[d].reset(m_rank.size());
+		}
+		m_query = 0;
+		m_settled = 0;
+	}
+
+	///@brief Member function to flatten the arcs kept at every vertex into a CSR and its lengths
+	static void flatten(const std::vector<std::vector<arc> >& arcs, csrGraph& g, arcWeights& w)
+	{
+		g.offsets.assign(arcs.size() + 1, 0);
+		for (size_t v = 0; v < arcs.size(); v++) g.offsets[v+1] = g.offsets[v] + arcs[v].size();
+		g.targets.resize(g.offsets.back());
+		g.edgeIndex.resize(g.offsets.back());
+		w = arcWeights(g.offsets.back());
+		for (size_t v = 0; v < arcs.size(); v++)
+			for (size_t i = 0; i < arcs[v].size(); i++)
+			{
+				size_t slot = g.offsets[v] + i;
+				g.targets[slot] = arcs[v][i].to;
+				g.edgeIndex[slot] = slot;
+				w[slot] = arcs[v][i].w;
+			}
+	}
+
+	///@brief Member function to build the hierarchy of a graph and its lengths in slot order
+	void build(const csrGraph& g, const propertyMap<weightType>& w)
+	{
+		size_t n = g.numVertices();
+		contractor c(n);
+		for (vertexId u = 0; u < n; u++)
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				vertexId v = g.targets[slot];
+				if (u == v) continue;
+				contractor::addArc(c.out[u], v, distanceType(w[slot]));
+				contractor::addArc(c.in[v], u, distanceType(w[slot]));
+			}
+		indexedHeap<long long,basic_heap_min_traits<long long>,noStats> order(n);
+		for (vertexId v = 0; v < n; v++) order.insert(v, c.priority(v));
+		std::vector<std::vector<arc> > up(n), down(n);
+		m_rank.assign(n, 0);
+		m_shortcuts = 0;
+		for (vertexId next = 0; false == order.empty(); )
+		{
+			vertexId v = vertexId(order.top());
+			order.changeKey(v, c.priority(v));
+			if (v != order.top()) continue;
+			order.extractTop();
+			m_rank[v] = next++;
+			m_shortcuts += c.shortcuts(v, true);
+			up[v] = c.out[v];
+			down[v] = c.in[v];
+			for (size_t i = 0; i < c.out[v].size(); i++)
+			{
+				vertexId u = c.out[v][i].to;
+				contractor::dropArcs(c.in[u], v);
+				c.deleted[u]++;
+			}
+			for (size_t i = 0; i < c.in[v].size(); i++)
+			{
+				vertexId u = c.in[v][i].to;
+				contractor::dropArcs(c.out[u], v);
+				c.deleted[u]++;
+			}
+			for (size_t i = 0; i < c.out[v].size(); i++) order.changeKey(c.out[v][i].to, c.priority(c.out[v][i].to));
+			for (size_t i = 0; i < c.in[v].size(); i++) order.changeKey(c.in[v][i].to, c.priority(c.in[v][i].to));
+			std::vector<arc>().swap(c.out[v]);
+			std::vector<arc>().swap(c.in[v]);
+		}
+		flatten(up, m_up, m_upWeights);
+		flatten(down, m_down, m_downWeights);
+		initQueries();
+	}
+
+	///@brief Member function to read the CSR and lengths of one direction, checking that they are well formed
+	static bool readArcs(std::istream& is, size_t n, uint64_t maxArcs, csrGraph& g, arcWeights& w)
+	{
+		std::vector<distanceType> lengths;
+		if (false == binaryArrays::read(is, g.offsets, n + 1) || n + 1 != g.offsets.size() || 0 != g.offsets[0]) return false;
+		for (size_t v = 0; v < n; v++) if (g.offsets[v] > g.offsets[v+1]) return false;
+		if (g.offsets.back() > maxArcs) return false;
+		if (false == binaryArrays::read(is, g.targets, g.offsets.back()) || g.targets.size() != g.offsets.back()) return false;
+		if (false == binaryArrays::read(is, lengths, g.offsets.back()) || lengths.size() != g.offsets.back()) return false;
+		g.edgeIndex.resize(g.targets.size());
+		w = arcWeights(lengths.size());
+		for (size_t slot = 0; slot < g.targets.size(); slot++)
+		{
+			if (g.targets[slot] >= n || lengths[slot] < 0) return false;
+			g.edgeIndex[slot] = slot;
+			w[slot] = lengths[slot];
+		}
+		return true;
+	}
+
+	///@brief Magic number at the start of a saved hierarchy
+	static uint64_t magic() {return 0x3130484350474c41ULL;}
+
+public:
+	///@brief Default constructor, creates an empty hierarchy to be filled by #load
+	contractionHierarchy() : m_shortcuts(0),m_query(0),m_settled(0){}
+
+	/**
+	 * @brief Constructor to preprocess a #csrGraph
+	 * @param	g	The graph
+	 * @param	w	The weights in slot order
+	 */
+	contractionHierarchy(const csrGraph& g, const propertyMap<weightType>& w) : m_shortcuts(0),m_query(0),m_settled(0)
+	{
+		build(g, w);
+	}
+
+	/**
+	 * @brief Constructor to preprocess a #graph
+	 * @param	g	The graph, whose vertex indices are the ids used by the queries
+	 * @param	w	The weights keyed by #edge::index
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	contractionHierarchy(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w)
+		: m_shortcuts(0),m_query(0),m_settled(0)
+	{
+		csrGraph csr(g);
+		build(csr, csr.slotProperty(w));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_rank.size();}
+
+	///@brief Member function to get the number of shortcuts added by the preprocessing
+	size_t numShortcuts() const {return m_shortcuts;}
+
+	///@brief Member function to get the number of arcs of the hierarchy, upward and downward
+	size_t numArcs() const {return m_up.numSlots() + m_down.numSlots();}
+
+	///@brief Member function to get the rank of a vertex, its position in the contraction order
+	vertexId rank(vertexId v) const {return m_rank[v];}
+
+	///@brief Member function to get the number of vertices settled by the last query
+	size_t lastSettled() const {return m_settled;}
+
+	/**
+	 * @brief Member function to get the shortest distance from s to t
+	 * @details The two searches take turns by the smaller top and a search stops once its top is not below the best sum found.
+	 * @return The distance, or #unreachable when there is no path
+	 */
+	distanceType distance(vertexId s, vertexId t)
+	{
+		m_query++;
+		m_settled = 0;
+		const csrGraph* graphs[2] = {&m_up, &m_down};
+		const arcWeights* weights[2] = {&m_upWeights, &m_downWeights};
+		distanceType retVal = unreachable();
+		for (size_t d = 0; d < 2; d++) m_queue[d].clear();
+		setDist(0, s, 0);
+		setDist(1, t, 0);
+		m_queue[0].insert(s, 0);
+		m_queue[1].insert(t, 0);
+		for (;;)
+		{
+			for (size_t d = 0; d < 2; d++) if (false == m_queue[d].empty() && m_queue[d].topKey() >= retVal) m_queue[d].clear();
+			if (true == m_queue[0].empty() && true == m_queue[1].empty()) break;
+			size_t d = (true == m_queue[1].empty() || (false == m_queue[0].empty() && m_queue[0].topKey() <= m_queue[1].topKey())) ? 0 : 1;
+			vertexId u = vertexId(m_queue[d].extractTop());
+			distanceType du = dist(d, u);
+			m_settled++;
+			distanceType other = dist(1 - d, u);
+			if (unreachable() != other && du + other < retVal) retVal = du + other;
+			// u is stalled if a higher vertex already reached in this search leads to it more cheaply
+			const csrGraph& back = *graphs[1 - d];
+			const arcWeights& backW = *weights[1 - d];
+			bool stalled = false;
+			for (size_t slot = back.offsets[u]; slot < back.offsets[u+1] && false == stalled; slot++)
+			{
+				distanceType dx = dist(d, back.targets[slot]);
+				stalled = (unreachable() != dx && dx + backW[slot] < du);
+			}
+			if (true == stalled) continue;
+			const csrGraph& g = *graphs[d];
+			const arcWeights& w = *weights[d];
+			stats::edgeVisit(g.degree(u));
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				vertexId v = g.targets[slot];
+				distanceType dv = du + w[slot];
+				if (dv >= dist(d, v)) continue;
+				setDist(d, v, dv);
+				m_queue[d].push(v, dv);
+			}
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to write the hierarchy to a binary stream
+	 * @return false if the stream failed
+	 */
+	bool save(std::ostream& os) const
+	{
+		uint64_t header[4] = {magic(), sizeof(vertexId), sizeof(distanceType), m_shortcuts};
+		os.write(reinterpret_cast<const char*>(header), sizeof(header));
+		binaryArrays::write(os, m_rank);
+		const csrGraph* graphs[2] = {&m_up, &m_down};
+		const arcWeights* weights[2] = {&m_upWeights, &m_downWeights};
+		for (size_t d = 0; d < 2; d++)
+		{
+			binaryArrays::write(os, graphs[d]->offsets);
+			binaryArrays::write(os, graphs[d]->targets);
+			binaryArrays::write(os, weights[d]->data(), weights[d]->size());
+		}
+		return bool(os);
+	}
+
+	/**
+	 * @brief Member function to read a hierarchy written by #save, replacing this one
+	 * @details The sizes of the types must match those of the writer and the arrays must be well formed, i.e. offsets growing,
+	 * targets in range and lengths not negative. The arrays are read with #binaryArrays::read.
+	 * @return false if the stream failed or did not hold a hierarchy, which then leaves this one empty
+	 */
+	bool load(std::istream& is)
+	{
+		*this = contractionHierarchy();
+		uint64_t header[4];
+		if (false == bool(is.read(reinterpret_cast<char*>(header), sizeof(header)))) return false;
+		if (magic() != header[0] || sizeof(vertexId) != header[1] || sizeof(distanceType) != header[2]) return false;
+		std::vector<vertexId> rank;
+		if (false == binaryArrays::read(is, rank, std::numeric_limits<vertexId>::max())) return false;
+		size_t n = rank.size();
+		std::vector<bool> used(n, false);
+		for (size_t v = 0; v < n; v++)
+		{
+			if (rank[v] >= n || true == used[rank[v]]) return false;
+			used[rank[v]] = true;
+		}
+		contractionHierarchy loaded;
+		// Every vertex has at most one arc to each other vertex
+		uint64_t maxArcs = uint64_t(n) * (n ? n - 1 : 0);
+		if (false == readArcs(is, n, maxArcs, loaded.m_up, loaded.m_upWeights)) return false;
+		if (false == readArcs(is, n, maxArcs, loaded.m_down, loaded.m_downWeights)) return false;
+		loaded.m_rank.swap(rank);
+		loaded.m_shortcuts = size_t(header[3]);
+		loaded.initQueries();
+		*this = loaded;
+		return true;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHCONTRACTION_HPP_ */
@@ -0,0 +1,293 @@
+/**
+ * @file GraphCores.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the k-core decomposition of undirected graphs, by sequential bucket peeling and by parallel level
+ *  peeling.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHCORES_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHCORES_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphThreads.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief k-core decomposition of an undirected graph
+ * @tparam	stats	Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by ALGOPP_STATS
+ * when not given.
+ * @details The k-core is the largest subgraph in which every vertex has at least k neighbors, and the core number, or coreness, of
+ * a vertex is the largest k whose k-core holds it. The graph is read as undirected, from a #graphTraits::bidirectional #graph or a
+ * symmetric #csrGraph, and its loops and parallel edges are dropped.
+ *
+ * #coreness peels the vertices in order of their current degree with the bucket queue of Batagelj and Zaversnik: the vertices are
+ * kept sorted by degree in one array, and lowering a degree swaps the vertex with the first one of its bucket. Every edge is looked
+ * at twice, so it runs in O(V + E) with no heap at all.
+ *
+ * #parallelCoreness peels level by level as in ParK: for k = 0, 1, ... the vertices of degree k are removed together, which lowers
+ * the degrees of their neighbors with atomic decrements, and the neighbors which drop to k are removed next in the same level. The
+ * vertices not removed yet are kept in a list which is compacted at every level, so that the scans shrink with the graph. The
+ * threads share the list and the frontiers between barriers.
+ */
+template <class stats = defaultStatsPolicy>
+class graphCores
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<size_t> coreMap;	///< Core number of every vertex
+
+private:
+	csrGraph m_graph;	///< Member to hold the simple undirected graph, both directions of every edge
+
+	/**
+	 * @brief State shared by the threads of #parallelCoreness
+	 * @details In a scan phase every thread splits its share of remaining into the vertices of degree level and the ones above it.
+	 * In a peel phase every thread removes its share of frontier and collects the neighbors which dropped to level. The main thread
+	 * alone joins what the threads collected between the phases.
+	 */
+	struct peelState
+	{
+		const csrGraph& g;	///< Member to hold the graph
+		std::vector<std::atomic<vertexId> > degree;	///< Member to hold the degree of every vertex among the ones not removed
+		coreMap& core;	///< Member to hold the core numbers
+		std::vector<vertexId> remaining;	///< Member to hold the vertices not removed at the start of the level
+		std::vector<vertexId> frontier;	///< Member to hold the vertices removed in this phase
+		std::vector<std::vector<vertexId> > kept;	///< Member to hold the vertices every thread kept in remaining
+		std::vector<std::vector<vertexId> > found;	///< Member to hold the vertices every thread found to remove next
+		std::vector<size_t> visited;	///< Member to hold the edges every thread visited in the phase
+		size_t level;	///< Member to hold the core number being peeled
+		bool scan;	///< Member to hold whether the phase is a scan or a peel
+
+		///@brief Constructor to set the degrees and put all the vertices in remaining
+		peelState(const csrGraph& g, coreMap& core, size_t noOfThreads) : g(g),degree(g.numVertices()),core(core),remaining(g.numVertices()),
+			kept(noOfThreads),found(noOfThreads),visited(noOfThreads, 0),level(0),scan(true)
+		{
+			for (vertexId v = 0; v < g.numVertices(); v++)
+			{
+				degree[v].store(vertexId(g.degree(v)), std::memory_order_relaxed);
+				remaining[v] = v;
+			}
+		}
+	};
+
+	///@brief Function to run the scan or the peel of thread t's share, keeping the edges it visited in visited
+	static void phaseShare(peelState& s, size_t t, size_t noOfThreads)
+	{
+		s.found[t].clear();
+		if (true == s.scan)
+		{
+			s.kept[t].clear();
+			size_t begin = s.remaining.size() * t / noOfThreads, end = s.remaining.size() * (t + 1) / noOfThreads;
+			for (size_t i = begin; i < end; i++)
+			{
+				vertexId v = s.remaining[i];
+				size_t d = s.degree[v].load(std::memory_order_relaxed);
+				// Vertices below the level were removed by the previous level and are dropped
+				if (d == s.level)
+				{
+					s.core[v] = s.level;
+					s.found[t].push_back(v);
+				}
+				else if (d > s.level) s.kept[t].push_back(v);
+			}
+			s.visited[t] = 0;
+			return;
+		}
+		size_t begin = s.frontier.size() * t / noOfThreads, end = s.frontier.size() * (t + 1) / noOfThreads, visited = 0;
+		for (size_t i = begin; i < end; i++)
+		{
+			vertexId v = s.frontier[i];
+			visited += s.g.degree(v);
+			for (size_t slot = s.g.offsets[v]; slot < s.g.offsets[v+1]; slot++)
+			{
+				vertexId u = s.g.targets[slot];
+				if (s.degree[u].load(std::memory_order_relaxed) <= s.level) continue;
+				size_t old = s.degree[u].fetch_sub(1, std::memory_order_relaxed);
+				if (old == s.level + 1)
+				{
+					s.core[u] = s.level;
+					s.found[t].push_back(u);
+				}
+				// Another thread took it down to the level first, and the degree must not go below it
+				else if (old <= s.level) s.degree[u].fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		s.visited[t] = visited;
+	}
+
+	/**
+	 * @brief Function to run one phase on all the threads, with the calling thread as thread 0, and join what they found
+	 * @details The edges visited are reported to the stats here, once per phase, since the threads share the stats.
+	 */
+	static void runPhase(peelState& s, phaseThreads<peelState>& threads, size_t noOfThreads)
+	{
+		threads.run();
+		size_t visited = 0;
+		for (size_t t = 0; t < noOfThreads; t++) visited += s.visited[t];
+		stats::edgeVisit(visited);
+		s.frontier.clear();
+		for (size_t t = 0; t < noOfThreads; t++) s.frontier.insert(s.frontier.end(), s.found[t].begin(), s.found[t].end());
+		if (false == s.scan) return;
+		s.remaining.clear();
+		for (size_t t = 0; t < noOfThreads; t++) s.remaining.insert(s.remaining.end(), s.kept[t].begin(), s.kept[t].end());
+	}
+
+	///@brief Member function to build the simple graph from a symmetric #csrGraph
+	void init(const csrGraph& g)
+	{
+		size_t n = g.numVertices();
+		// Marks the neighbors already added for the current vertex, so the parallel edges are dropped in linear time
+		std::vector<size_t> mark(n, size_t(-1));
+		m_graph.offsets.assign(n + 1, 0);
+		m_graph.targets.reserve(g.numSlots());
+		for (vertexId u = 0; u < n; u++)
+		{
+			mark[u] = u;
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				if (u != mark[g.targets[slot]])
+				{
+					mark[g.targets[slot]] = u;
+					m_graph.targets.push_back(g.targets[slot]);
+				}
+			m_graph.offsets[u+1] = m_graph.targets.size();
+		}
+		m_graph.edgeIndex.assign(m_graph.targets.size(), 0);
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the decomposition of a #csrGraph
+	 * @param	g	The graph, a symmetric #csrGraph
+	 */
+	explicit graphCores(const csrGraph& g)
+	{
+		init(g);
+	}
+
+	/**
+	 * @brief Constructor to set up the decomposition of a #graph
+	 * @param	g	The graph, a #graphTraits::bidirectional one, whose vertex indices are the ids of the core numbers
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	explicit graphCores(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g)
+	{
+		init(csrGraph(g));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_graph.numVertices();}
+
+	///@brief Member function to get the number of edges, without loops and parallel edges
+	size_t numEdges() const {return m_graph.numSlots() / 2;}
+
+	/**
+	 * @brief Member function to compute the core numbers by bucket peeling
+	 * @param	order	If not NULL, set to the vertices in the order they were peeled, a degeneracy ordering in which every vertex
+	 * has at most the degeneracy neighbors after it
+	 * @return The core number of every vertex
+	 */
+	coreMap coreness(std::vector<vertexId>* order = NULL) const
+	{
+		size_t n = m_graph.numVertices();
+		coreMap retVal(n, 0);
+		// Degrees and positions are below the number of vertices, so they fit the vertex id type, which halves the memory touched
+		std::vector<vertexId> degree(n), bucketStart, position(n), sorted(n);
+		vertexId maxDegree = 0;
+		for (vertexId v = 0; v < n; v++)
+		{
+			degree[v] = vertexId(m_graph.degree(v));
+			maxDegree = std::max(maxDegree, degree[v]);
+		}
+		// Counting sort of the vertices by degree, bucketStart[d] being the first position of degree d
+		bucketStart.assign(maxDegree + 2, 0);
+		for (vertexId v = 0; v < n; v++) bucketStart[degree[v] + 1]++;
+		for (size_t d = 0; d <= maxDegree; d++) bucketStart[d+1] += bucketStart[d];
+		std::vector<vertexId> next(bucketStart.begin(), bucketStart.end() - 1);
+		for (vertexId v = 0; v < n; v++)
+		{
+			position[v] = next[degree[v]]++;
+			sorted[position[v]] = v;
+		}
+		for (size_t i = 0; i < n; i++)
+		{
+			vertexId v = sorted[i];
+			retVal[v] = degree[v];
+			stats::edgeVisit(m_graph.degree(v));
+			for (size_t slot = m_graph.offsets[v]; slot < m_graph.offsets[v+1]; slot++)
+			{
+				vertexId u = m_graph.targets[slot];
+				if (degree[u] <= degree[v]) continue;
+				// Swaps u with the first vertex of its bucket, and moves the start of the bucket past it
+				vertexId first = std::max(bucketStart[degree[u]], vertexId(i + 1));
+				vertexId w = sorted[first];
+				std::swap(sorted[first], sorted[position[u]]);
+				position[w] = position[u];
+				position[u] = first;
+				bucketStart[degree[u]] = first + 1;
+				degree[u]--;
+			}
+		}
+		if (NULL != order) *order = sorted;
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to compute the core numbers by level peeling on several threads
+	 * @param	noOfThreads	Number of threads sharing the vertices
+	 * @return The core number of every vertex
+	 */
+	coreMap parallelCoreness(size_t noOfThreads = 1) const
+	{
+		coreMap retVal(m_graph.numVertices(), 0);
+		noOfThreads = std::max<size_t>(1, noOfThreads);
+		peelState s(m_graph, retVal, noOfThreads);
+		phaseThreads<peelState> threads(s, phaseShare, noOfThreads);
+		for (; false == s.remaining.empty(); s.level++)
+		{
+			s.scan = true;
+			runPhase(s, threads, noOfThreads);
+			s.scan = false;
+			while (false == s.frontier.empty()) runPhase(s, threads, noOfThreads);
+		}
+		threads.stop();
+		return retVal;
+	}
+
+	/**
+	 * @brief Function to count the vertices of every core number
+	 * @param	core	The core numbers, as given by #coreness
+	 * @return At position k the number of vertices whose core number is k, up to the degeneracy
+	 */
+	static std::vector<size_t> histogram(const coreMap& core)
+	{
+		std::vector<size_t> retVal;
+		for (size_t v = 0; v < core.size(); v++)
+		{
+			if (retVal.size() <= core[v]) retVal.resize(core[v] + 1, 0);
+			retVal[core[v]]++;
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Function to get the vertices of the k-core
+	 * @param	core	The core numbers, as given by #coreness
+	 * @param	k		The least core number kept
+	 * @return The vertices whose core number is at least k, in increasing order
+	 */
+	static std::vector<vertexId> kCore(const coreMap& core, size_t k)
+	{
+		std::vector<vertexId> retVal;
+		for (size_t v = 0; v < core.size(); v++) if (core[v] >= k) retVal.push_back(vertexId(v));
+		return retVal;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHCORES_HPP_ */
@@ -33,10 +33,13 @@ public:
 	nodeType* source; 	///< Member variable which is the source of this edge
 	nodeType* sink;		///< Member variable which is the sink of this edge
 	edgeProperties internalProperties;		///< Member of user defined edgeProperties to be encapsulated in this class
+	size_t index;	///< Dense index of this edge in its #graph. Both directions of a #graphTraits::bidirectional edge share it.
 	///@brief Default Constructor
-	edge() : source(NULL),sink(NULL){}
-	///@brief Triple Argument Constructor
-	edge(nodeType *source, nodeType *sink, edgeProperties& e) :source(source),sink(sink), internalProperties(e){}
+	edge() : source(NULL),sink(NULL),index(0){}
+	///@brief Triple Argument Constructor, the optional fourth argument is the dense index of the edge
+	edge(nodeType *source, nodeType *sink, edgeProperties& e, size_t index = 0) :source(source),sink(sink), internalProperties(e),index(index){}
+	///@brief Member function to provide access to the encapsulated user defined edge properties
+	edgeProperties& properties() {return internalProperties;}
 	/**
 	 * @brief Decompilation support provided to be used by classes which have nodes of this class type.
 	 * @param	out	ostream variable in which the output is piped.
@@ -63,8 +66,11 @@ public:
 	nodeType* source;	///<@copybrief edge::source
 	nodeType* sink;	///<@copybrief edge::sink
 	edgeProperties *internalProperties;	///<@copybrief edge::internalProperties
-	edge() : source(NULL),sink(NULL),internalProperties(NULL){}	///<@copybrief edge::edge
-	edge(nodeType *source, nodeType *sink, edgeProperties *e) :source(source),sink(sink), internalProperties(e){}	///<@copybrief edge::edge(nodeType *source, nodeType *sink, edgeProperties& e)
+	size_t index;	///<@copybrief edge::index
+	edge() : source(NULL),sink(NULL),internalProperties(NULL),index(0){}	///<@copybrief edge::edge
+	edge(nodeType *source, nodeType *sink, edgeProperties *e, size_t index = 0) :source(source),sink(sink), internalProperties(e),index(index){}	///<@copybrief edge::edge(nodeType *source, nodeType *sink, edgeProperties& e, size_t index)
+	///@copydoc edge::properties
+	edgeProperties& properties() {return *internalProperties;}
 	///@brief Type cast operator to user defined encapsulated type
 	operator edgeProperties* () { return internalProperties; }
 	///@copydoc edge::operator <<
@@ -88,8 +94,11 @@ public:
 	nodeType* source;	///<@copybrief edge::source
 	nodeType* sink;	///<@copybrief edge::sink
 	edgeProperties internalProperties;	///<@copybrief edge::internalProperties
-	edge() : source(NULL),sink(NULL){}	///<@copybrief edge::edge
-	edge(nodeType *source, nodeType *sink, edgeProperties& e) : source(source),sink(sink), internalProperties(e){}	///<@copybrief edge::edge(nodeType *source, nodeType *sink, edgeProperties& e)
+	size_t index;	///<@copybrief edge::index
+	edge() : source(NULL),sink(NULL),index(0){}	///<@copybrief edge::edge
+	edge(nodeType *source, nodeType *sink, edgeProperties& e, size_t index = 0) : source(source),sink(sink), internalProperties(e),index(index){}	///<@copybrief edge::edge(nodeType *source, nodeType *sink, edgeProperties& e, size_t index)
+	///@copydoc edge::properties
+	edgeProperties& properties() {return internalProperties;}
 	///@copydoc edge::operator <<
 	friend ostream& operator << (ostream &out, thisClass& e)
 	{
@@ -111,8 +120,11 @@ public:
 	nodeType* source;	///<@copybrief edge::source
 	nodeType* sink;	///<@copybrief edge::sink
 	edgeProperties *internalProperties;	///<@copybrief edge::internalProperties
-	edge() : source(NULL),sink(NULL),internalProperties(NULL){}	///<@copybrief edge::edge
-	edge(nodeType *source, nodeType *sink, edgeProperties *e) : source(source),sink(sink), internalProperties(e){}	///<@copybrief edge::edge(nodeType *source, nodeType *sink, edgeProperties& e)
+	size_t index;	///<@copybrief edge::index
+	edge() : source(NULL),sink(NULL),internalProperties(NULL),index(0){}	///<@copybrief edge::edge
+	edge(nodeType *source, nodeType *sink, edgeProperties *e, size_t index = 0) : source(source),sink(sink), internalProperties(e),index(index){}	///<@copybrief edge::edge(nodeType *source, nodeType *sink, edgeProperties& e, size_t index)
+	///@copydoc edge::properties
+	edgeProperties& properties() {return *internalProperties;}
 	///@brief Type cast operator to user defined encapsulated type
 	operator edgeProperties* () { return internalProperties; }
 	///@copydoc edge::operator <<
@@ -0,0 +1,443 @@
+/**
+ * @file GraphFlow.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the maximum flow and minimum cut of directed graphs, by Dinic's algorithm and by highest label
+ *  push-relabel, over a flat residual graph.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHFLOW_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHFLOW_HPP_
+
+#include <vector>
+#include <algorithm>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Maximum flow between two vertices of a directed graph
+ * @tparam	capacityType	Type of the capacities, a signed fundamental type
+ * @tparam	stats			Stats policy which records the number of arcs looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details Every edge u->v becomes a pair of arcs of the residual graph: u->v with the capacity of the edge and v->u with none,
+ * each holding the position of the other. The arcs of a vertex are stored together as in #csrGraph, its out edges first and then
+ * the reverse arcs of its in edges, so both algorithms walk flat arrays. Parallel and antiparallel edges keep their own pairs, and
+ * loops are left out. Every run starts from the zero flow, and after it #flow, #minCut and #cutSlots describe the flow found.
+ *
+ * #dinic repeatedly labels the vertices by their distance from the source and sends a blocking flow along the arcs going one level
+ * further, with a current arc per vertex so that no arc is tried twice in a phase. It needs at most V phases and is very fast on
+ * unit capacities and shallow graphs.
+ *
+ * #pushRelabel keeps a preflow and always discharges an active vertex of highest label. The labels are exact distances to the sink
+ * after a global relabel, a backward breadth first search, which is redone after every V relabels. When a relabel empties a
+ * label, every vertex above it is cut off from the sink and is lifted out of the way at once, the gap heuristic, using the lists of
+ * the vertices of every label. The first phase ends with the maximum preflow; the second returns the excess that cannot reach the
+ * sink to the source, with the same discharging towards the source, so that the result is a flow.
+ */
+template <typename capacityType = long long, class stats = defaultStatsPolicy>
+class graphMaxFlow
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+private:
+	std::vector<size_t> m_offsets;	///< Member to hold the first arc of every vertex, with one extra entry holding the number of arcs
+	std::vector<vertexId> m_head;	///< Member to hold the vertex every arc goes to
+	std::vector<size_t> m_reverse;	///< Member to hold the position of the reverse of every arc
+	std::vector<capacityType> m_capacity;	///< Member to hold the capacity of every arc
+	std::vector<capacityType> m_residual;	///< Member to hold the residual capacity of every arc
+	std::vector<size_t> m_slotArc;	///< Member to hold the arc of every slot of the input, #none() for loops
+
+	///@brief Function to get the value marking a missing arc or label
+	static size_t none() {return size_t(-1);}
+
+	///@brief Member function to build the residual graph of the slots of a graph with the given capacities
+	void init(const csrGraph& g, const propertyMap<capacityType>& c)
+	{
+		size_t n = g.numVertices();
+		m_offsets.assign(n + 1, 0);
+		for (vertexId u = 0; u < n; u++)
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				if (g.targets[slot] != u)
+				{
+					m_offsets[u+1]++;
+					m_offsets[g.targets[slot]+1]++;
+				}
+		for (size_t i = 0; i < n; i++) m_offsets[i+1] += m_offsets[i];
+		m_head.resize(m_offsets.back());
+		m_reverse.resize(m_offsets.back());
+		m_capacity.assign(m_offsets.back(), 0);
+		m_slotArc.assign(g.numSlots(), none());
+		std::vector<size_t> next(m_offsets.begin(), m_offsets.end() - 1);
+		for (vertexId u = 0; u < n; u++)
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				vertexId v = g.targets[slot];
+				if (v == u) continue;
+				size_t forward = next[u]++, backward = next[v]++;
+				m_head[forward] = v;
+				m_head[backward] = u;
+				m_reverse[forward] = backward;
+				m_reverse[backward] = forward;
+				m_capacity[forward] = c[slot];
+				m_slotArc[slot] = forward;
+			}
+		m_residual = m_capacity;
+	}
+
+	///@brief Member function to label every vertex with its distance from s along the arcs with residual capacity, none() if unreached
+	void levels(vertexId s, std::vector<size_t>& level) const
+	{
+		level.assign(numVertices(), none());
+		std::vector<vertexId> queue(1, s);
+		level[s] = 0;
+		for (size_t head = 0; head < queue.size(); head++)
+		{
+			vertexId u = queue[head];
+			stats::edgeVisit(m_offsets[u+1] - m_offsets[u]);
+			for (size_t a = m_offsets[u]; a < m_offsets[u+1]; a++)
+				if (m_residual[a] > 0 && none() == level[m_head[a]])
+				{
+					level[m_head[a]] = level[u] + 1;
+					queue.push_back(m_head[a]);
+				}
+		}
+	}
+
+	///@brief Member function to send a blocking flow from s to t along the arcs going one level further, returning its value
+	capacityType blockingFlow(vertexId s, vertexId t, std::vector<size_t>& level, std::vector<size_t>& current)
+	{
+		capacityType retVal = 0;
+		std::vector<size_t> path;
+		vertexId v = s;
+		for (;;)
+		{
+			if (v == t)
+			{
+				capacityType pushed = m_residual[path[0]];
+				size_t saturated = 0;
+				for (size_t i = 1; i < path.size(); i++)
+					if (m_residual[path[i]] < pushed)
+					{
+						pushed = m_residual[path[i]];
+						saturated = i;
+					}
+				for (size_t i = 0; i < path.size(); i++)
+				{
+					m_residual[path[i]] -= pushed;
+					m_residual[m_reverse[path[i]]] += pushed;
+				}
+				retVal += pushed;
+				// Goes back to the tail of the first arc the path saturated
+				v = m_head[m_reverse[path[saturated]]];
+				path.resize(saturated);
+				continue;
+			}
+			size_t& a = current[v];
+			for (; a < m_offsets[v+1]; a++)
+				if (m_residual[a] > 0 && level[m_head[a]] == level[v] + 1) break;
+			stats::edgeVisit(1);
+			if (a < m_offsets[v+1])
+			{
+				path.push_back(a);
+				v = m_head[a];
+				continue;
+			}
+			// A dead end, which no later path of the phase can use
+			level[v] = none();
+			if (v == s) break;
+			v = m_head[m_reverse[path.back()]];
+			path.pop_back();
+			current[v]++;
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief State of a phase of #pushRelabel
+	 * @details The vertices of every label below V are kept in doubly linked lists for the gap heuristic, and the active ones in a
+	 * stack per label, from which the stale entries are skipped when popped.
+	 */
+	struct preflowState
+	{
+		vertexId target;	///< Member to hold the vertex the excess is pushed towards
+		vertexId other;	///< Member to hold the other terminal, which is never active and keeps the label V
+		std::vector<capacityType> excess;	///< Member to hold the excess of every vertex
+		std::vector<size_t> label;	///< Member to hold the label of every vertex, V once it cannot reach the target
+		std::vector<size_t> current;	///< Member to hold the current arc of every vertex
+		std::vector<std::vector<vertexId> > active;	///< Member to hold the active vertices of every label
+		std::vector<vertexId> listHead;	///< Member to hold the first vertex of every label
+		std::vector<vertexId> listNext;	///< Member to hold the next vertex of the same label
+		std::vector<vertexId> listPrevious;	///< Member to hold the previous vertex of the same label
+		size_t highestActive;	///< Member to hold a label at or above the highest active vertex
+		size_t highestLabel;	///< Member to hold a label at or above the highest labelled vertex below V
+		size_t relabels;	///< Member to hold the number of relabels since the last global relabel
+	};
+
+	///@brief Function to get the value ending the lists of the vertices of a label
+	static vertexId endOfList() {return vertexId(-1);}
+
+	///@brief Member function to add a vertex to the list of its label
+	void link(preflowState& st, vertexId v) const
+	{
+		size_t l = st.label[v];
+		st.listPrevious[v] = endOfList();
+		st.listNext[v] = st.listHead[l];
+		if (endOfList() != st.listHead[l]) st.listPrevious[st.listHead[l]] = v;
+		st.listHead[l] = v;
+		st.highestLabel = std::max(st.highestLabel, l);
+	}
+
+	///@brief Member function to remove a vertex from the list of its label
+	void unlink(preflowState& st, vertexId v) const
+	{
+		if (endOfList() != st.listPrevious[v]) st.listNext[st.listPrevious[v]] = st.listNext[v];
+		else st.listHead[st.label[v]] = st.listNext[v];
+		if (endOfList() != st.listNext[v]) st.listPrevious[st.listNext[v]] = st.listPrevious[v];
+	}
+
+	///@brief Member function to set every label to the distance to the target along the arcs with residual capacity
+	void globalRelabel(preflowState& st) const
+	{
+		size_t n = numVertices();
+		st.label.assign(n, n);
+		st.listHead.assign(n, endOfList());
+		for (size_t l = 0; l < n; l++) st.active[l].clear();
+		st.highestActive = 0;
+		st.highestLabel = 0;
+		st.relabels = 0;
+		std::vector<vertexId> queue(1, st.target);
+		st.label[st.target] = 0;
+		link(st, st.target);
+		for (size_t head = 0; head < queue.size(); head++)
+		{
+			vertexId u = queue[head];
+			stats::edgeVisit(m_offsets[u+1] - m_offsets[u]);
+			for (size_t a = m_offsets[u]; a < m_offsets[u+1]; a++)
+			{
+				vertexId v = m_head[a];
+				if (n != st.label[v] || v == st.other || 0 == m_residual[m_reverse[a]]) continue;
+				st.label[v] = st.label[u] + 1;
+				st.current[v] = m_offsets[v];
+				link(st, v);
+				queue.push_back(v);
+				if (st.excess[v] > 0)
+				{
+					st.active[st.label[v]].push_back(v);
+					st.highestActive = std::max(st.highestActive, st.label[v]);
+				}
+			}
+		}
+	}
+
+	///@brief Member function to lift a vertex with no admissible arc left, applying the gap heuristic if it empties its label
+	void relabel(preflowState& st, vertexId u) const
+	{
+		size_t n = numVertices(), old = st.label[u], lowest = n;
+		st.relabels++;
+		stats::edgeVisit(m_offsets[u+1] - m_offsets[u]);
+		for (size_t a = m_offsets[u]; a < m_offsets[u+1]; a++)
+			if (m_residual[a] > 0) lowest = std::min(lowest, st.label[m_head[a]] + 1);
+		unlink(st, u);
+		if (endOfList() == st.listHead[old])
+		{
+			// Nothing is left at the old label, so nothing above it can reach the target any more
+			for (size_t l = old + 1; l <= st.highestLabel; l++)
+			{
+				for (vertexId v = st.listHead[l]; endOfList() != v; v = st.listNext[v]) st.label[v] = n;
+				st.listHead[l] = endOfList();
+			}
+			st.highestLabel = old;
+			st.label[u] = n;
+			return;
+		}
+		st.label[u] = std::min(lowest, n);
+		st.current[u] = m_offsets[u];
+		if (st.label[u] < n) link(st, u);
+	}
+
+	///@brief Member function to push the excess of a vertex along its admissible arcs, relabelling it when they run out
+	void discharge(preflowState& st, vertexId u)
+	{
+		size_t n = numVertices();
+		while (st.excess[u] > 0 && st.label[u] < n)
+		{
+			size_t a = st.current[u];
+			if (a == m_offsets[u+1])
+			{
+				relabel(st, u);
+				continue;
+			}
+			vertexId v = m_head[a];
+			if (m_residual[a] > 0 && st.label[u] == st.label[v] + 1)
+			{
+				capacityType pushed = std::min(st.excess[u], m_residual[a]);
+				m_residual[a] -= pushed;
+				m_residual[m_reverse[a]] += pushed;
+				st.excess[u] -= pushed;
+				if (0 == st.excess[v] && v != st.target && v != st.other)
+				{
+					st.active[st.label[v]].push_back(v);
+					st.highestActive = std::max(st.highestActive, st.label[v]);
+				}
+				st.excess[v] += pushed;
+				if (0 == m_residual[a]) st.current[u]++;
+			}
+			else st.current[u]++;
+		}
+	}
+
+	///@brief Member function to discharge the active vertices, highest label first, until none is left below V
+	void preflowPhase(preflowState& st)
+	{
+		size_t n = numVertices();
+		globalRelabel(st);
+		for (;;)
+		{
+			while (st.highestActive > 0 && true == st.active[st.highestActive].empty()) st.highestActive--;
+			if (true == st.active[st.highestActive].empty()) break;
+			vertexId u = st.active[st.highestActive].back();
+			st.active[st.highestActive].pop_back();
+			if (st.label[u] != st.highestActive || 0 == st.excess[u]) continue;
+			discharge(st, u);
+			if (st.relabels >= n) globalRelabel(st);
+		}
+	}
+
+	///@brief Member function to find the vertices reachable from s along the arcs with residual capacity
+	std::vector<bool> reachable(vertexId s) const
+	{
+		std::vector<size_t> level;
+		levels(s, level);
+		std::vector<bool> retVal(numVertices());
+		for (size_t v = 0; v < level.size(); v++) retVal[v] = (none() != level[v]);
+		return retVal;
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the flows of a #csrGraph
+	 * @param	g	The graph
+	 * @param	c	The capacities in slot order, e.g. from #csrGraph::slotProperty, none of them negative
+	 */
+	graphMaxFlow(const csrGraph& g, const propertyMap<capacityType>& c)
+	{
+		init(g, c);
+	}
+
+	/**
+	 * @brief Constructor to set up the flows of a #graph
+	 * @param	g	The graph, a #graphTraits::directed one, whose vertex indices are the ids used by the runs
+	 * @param	c	The capacities keyed by #edge::index, none of them negative
+	 * @details The slots of #flow and #cutSlots are those of csrGraph(g).
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	graphMaxFlow(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<capacityType>& c)
+	{
+		csrGraph csr(g);
+		init(csr, csr.slotProperty(c));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_offsets.size() - 1;}
+
+	///@brief Member function to get the number of arcs of the residual graph, twice the edges which are not loops
+	size_t numArcs() const {return m_head.size();}
+
+	/**
+	 * @brief Member function to compute a maximum flow by Dinic's algorithm
+	 * @param	s	The source
+	 * @param	t	The sink
+	 * @return The value of the flow, 0 if s is t
+	 */
+	capacityType dinic(vertexId s, vertexId t)
+	{
+		m_residual = m_capacity;
+		capacityType retVal = 0;
+		if (s == t) return retVal;
+		std::vector<size_t> level, current;
+		for (levels(s, level); none() != level[t]; levels(s, level))
+		{
+			current.assign(m_offsets.begin(), m_offsets.end() - 1);
+			retVal += blockingFlow(s, t, level, current);
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to compute a maximum flow by highest label push-relabel
+	 * @copydetails dinic
+	 */
+	capacityType pushRelabel(vertexId s, vertexId t)
+	{
+		m_residual = m_capacity;
+		if (s == t) return 0;
+		size_t n = numVertices();
+		preflowState st;
+		st.excess.assign(n, 0);
+		st.current.assign(m_offsets.begin(), m_offsets.end() - 1);
+		st.active.resize(n);
+		st.listNext.resize(n);
+		st.listPrevious.resize(n);
+		for (size_t a = m_offsets[s]; a < m_offsets[s+1]; a++)
+		{
+			st.excess[m_head[a]] += m_residual[a];
+			m_residual[m_reverse[a]] += m_residual[a];
+			m_residual[a] = 0;
+		}
+		st.target = t;
+		st.other = s;
+		preflowPhase(st);
+		// The excess left on the vertices cut off from the sink goes back to the source
+		st.target = s;
+		st.other = t;
+		preflowPhase(st);
+		return st.excess[t];
+	}
+
+	/**
+	 * @brief Member function to get the flow of the last run on a slot of the input
+	 * @param	slot	Slot of the #csrGraph given to the constructor
+	 * @return The flow along the edge of the slot, 0 for loops
+	 */
+	capacityType flow(size_t slot) const
+	{
+		size_t a = m_slotArc[slot];
+		return (none() == a) ? 0 : m_capacity[a] - m_residual[a];
+	}
+
+	/**
+	 * @brief Member function to get the source side of a minimum cut after the last run
+	 * @param	s	The source of the last run
+	 * @return The vertices still reachable from s along arcs with residual capacity, in increasing order
+	 */
+	std::vector<vertexId> minCut(vertexId s) const
+	{
+		std::vector<bool> side = reachable(s);
+		std::vector<vertexId> retVal;
+		for (size_t v = 0; v < side.size(); v++) if (true == side[v]) retVal.push_back(vertexId(v));
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to get the edges of a minimum cut after the last run
+	 * @param	s	The source of the last run
+	 * @return The slots of the input going from the source side of #minCut to the other side, whose capacities add up to the flow
+	 */
+	std::vector<size_t> cutSlots(vertexId s) const
+	{
+		std::vector<bool> side = reachable(s);
+		std::vector<size_t> retVal;
+		for (size_t slot = 0; slot < m_slotArc.size(); slot++)
+		{
+			size_t a = m_slotArc[slot];
+			if (none() != a && true == side[m_head[m_reverse[a]]] && false == side[m_head[a]]) retVal.push_back(slot);
+		}
+		return retVal;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHFLOW_HPP_ */
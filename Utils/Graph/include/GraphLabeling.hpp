@@ -0,0 +1,512 @@
+/**
+ * @file GraphLabeling.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the pruned landmark labeling, a 2-hop cover of a graph which answers reachability and distance
+ *  queries by merging two sorted labels, and its binary save and load.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHLABELING_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHLABELING_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <chrono>
+#include <istream>
+#include <ostream>
+#include <stdint.h>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphBinary.hpp"
+#include "GraphSimd.hpp"
+#include "IndexedHeap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief 2-hop labeling of a graph by pruned landmark labeling, for reachability and exact distances without searching
+ * @tparam	weightType		Type of the edge weights, which must be positive
+ * @tparam	distanceType	Type of the distances stored in the labels, wide enough for twice the longest shortest path. The labels
+ * hold one of these per entry, so a narrow type keeps the index small.
+ * @tparam	stats			Stats policy which records the number of edges looked at by the construction. #noStats or
+ * #countingStats, selected by ALGOPP_STATS when not given.
+ * @details Every vertex v gets an out label of hubs it reaches and an in label of hubs which reach it, each with the distance. The
+ * labels cover every pair: if t is reachable from s, some hub on a shortest path from s to t is in both the out label of s and the
+ * in label of t, so the distance is the least sum over the common hubs and t is reachable exactly when there is one.
+ *
+ * The vertices are taken as hubs in order of falling degree, in plus out. The hub of rank r runs a breadth first search, or
+ * Dijkstra on the weighted graph, forward to add itself to the in labels and backward on the transpose to add itself to the out
+ * labels. The searches are pruned: a vertex whose distance the labels of the higher ranked hubs already give, or for
+ * #reachability any vertex they already connect, is neither labelled nor expanded. So the labels stay small on graphs with a few
+ * central vertices, and the whole construction costs far less than a search per vertex. The check runs against the label of the
+ * hub scattered into an array indexed by rank, so it costs one pass over the label of the vertex. When the graph is symmetric,
+ * e.g. a #graphTraits::bidirectional #graph, the in and out labels are the same and only one set is built and stored.
+ *
+ * The labels are flat: per direction the offsets of every vertex, the hub ranks and, for #distances only, the distances in
+ * separate arrays. The hubs of a label are in increasing rank, as the searches add them in that order, and every label ends with
+ * the rank #sentinel, so a query is a merge of two sorted arrays with no bounds checks whose two cursors advance by the results of
+ * comparisons instead of branches. With SSE2 the merge first compares blocks of four ranks of each label at once with
+ * #sortedBlocks, and leaves the ends of the labels shorter than a block to the scalar merge.
+ *
+ * #save and #load write and read the labels as raw arrays in the byte order of the machine, with a header giving the sizes of
+ * the types.
+ */
+template <typename weightType = int, typename distanceType = unsigned int, class stats = defaultStatsPolicy>
+class hubLabeling
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+	///@brief What the labels answer
+	enum kind
+	{
+		distances,	///< Distances, from which reachability follows
+		reachability	///< Reachability only, with smaller labels and no distances stored
+	};
+
+	///@brief Member function to get the distance of the vertices which are not reachable
+	static distanceType unreachable() {return std::numeric_limits<distanceType>::max();}
+
+	///@brief Member function to get the hub rank which ends every label
+	static vertexId sentinel() {return std::numeric_limits<vertexId>::max();}
+
+private:
+	/**
+	 * @brief Labels of one direction, flattened
+	 */
+	struct labelSet
+	{
+		std::vector<size_t> offsets;	///< Member to hold the first entry of every vertex, with one extra entry holding their number
+		std::vector<vertexId> hubs;	///< Member to hold the hub ranks, increasing within a label and ending with #sentinel
+		std::vector<distanceType> dist;	///< Member to hold the distance to or from the hub of every entry, empty for #reachability
+	};
+
+	///@brief Entry of a label while it is built
+	typedef std::pair<vertexId,distanceType> entry;
+
+	kind m_kind;	///< Member to hold what the labels answer
+	bool m_symmetric;	///< Member to hold whether the in labels are the out labels
+	labelSet m_out;	///< Member to hold the out labels, hubs reachable from every vertex
+	labelSet m_in;	///< Member to hold the in labels, hubs which reach every vertex, empty when symmetric
+	double m_buildSeconds;	///< Member to hold the time the construction took
+
+	/**
+	 * @brief State of the construction
+	 */
+	struct builder
+	{
+		std::vector<std::vector<entry> > out;	///< Member to hold the out labels built so far
+		std::vector<std::vector<entry> > in;	///< Member to hold the in labels built so far
+		std::vector<distanceType> hubDist;	///< Member to hold the label of the current hub scattered by rank
+		std::vector<distanceType> dist;	///< Member to hold the distances of the current search
+		std::vector<vertexId> reached;	///< Member to hold the vertices of the current search, its queue when breadth first
+		indexedHeap<distanceType,basic_heap_min_traits<distanceType>,noStats> heap;	///< Member to hold the queue of Dijkstra
+
+		///@brief Constructor for n vertices
+		explicit builder(size_t n) : out(n),in(n),hubDist(n, unreachable()),dist(n, unreachable()),heap(n){}
+	};
+
+	///@brief Member function to get the in labels
+	const labelSet& inLabels() const {return m_symmetric ? m_out : m_in;}
+
+	///@brief Function to check whether the current hub and its label already cover v at distance d
+	static bool covered(const builder& b, const std::vector<entry>& label, distanceType d, kind k)
+	{
+		for (size_t i = 0; i < label.size(); i++)
+		{
+			distanceType h = b.hubDist[label[i].first];
+			if (unreachable() == h) continue;
+			if (reachability == k || distanceType(h + label[i].second) <= d) return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Function to run the pruned search of the hub of rank r from x, adding it to the labels the search reaches
+	 * @param	b		State of the construction
+	 * @param	g		The arcs to search along
+	 * @param	w		Their lengths in slot order, empty for a breadth first search
+	 * @param	hub		The labels of x whose hubs are scattered into the array of the state
+	 * @param	labels	The labels to add the hub to
+	 * @param	k		What the labels answer, #reachability pruning every vertex the labels connect at all
+	 */
+	static void prunedSearch(builder& b, const csrGraph& g, const std::vector<weightType>& w, vertexId x, vertexId r,
+		const std::vector<entry>& hub, std::vector<std::vector<entry> >& labels, kind k)
+	{
+		for (size_t i = 0; i < hub.size(); i++) b.hubDist[hub[i].first] = hub[i].second;
+		b.dist[x] = 0;
+		b.reached.push_back(x);
+		if (true == w.empty())
+		{
+			for (size_t head = 0; head < b.reached.size(); head++)
+			{
+				vertexId v = b.reached[head];
+				if (true == covered(b, labels[v], b.dist[v], k)) continue;
+				labels[v].push_back(entry(r, b.dist[v]));
+				stats::edgeVisit(g.degree(v));
+				for (size_t slot = g.offsets[v]; slot < g.offsets[v+1]; slot++)
+				{
+					vertexId u = g.targets[slot];
+					if (unreachable() != b.dist[u]) continue;
+					b.dist[u] = b.dist[v] + 1;
+					b.reached.push_back(u);
+				}
+			}
+		}
+		else
+		{
+			b.heap.insert(x, 0);
+			while (false == b.heap.empty())
+			{
+				vertexId v = vertexId(b.heap.extractTop());
+				if (true == covered(b, labels[v], b.dist[v], k)) continue;
+				labels[v].push_back(entry(r, b.dist[v]));
+				stats::edgeVisit(g.degree(v));
+				for (size_t slot = g.offsets[v]; slot < g.offsets[v+1]; slot++)
+				{
+					vertexId u = g.targets[slot];
+					distanceType next = distanceType(b.dist[v] + w[slot]);
+					if (next >= b.dist[u]) continue;
+					if (unreachable() == b.dist[u]) b.reached.push_back(u);
+					b.dist[u] = next;
+					b.heap.push(u, next);
+				}
+			}
+		}
+		for (size_t i = 0; i < b.reached.size(); i++) b.dist[b.reached[i]] = unreachable();
+		b.reached.clear();
+		for (size_t i = 0; i < hub.size(); i++) b.hubDist[hub[i].first] = unreachable();
+	}
+
+	///@brief Function to order the vertices from the largest degree down, and by vertex among equal degrees
+	static bool higherDegree(const std::pair<size_t,vertexId>& a, const std::pair<size_t,vertexId>& b)
+	{
+		return (a.first != b.first) ? (a.first > b.first) : (a.second < b.second);
+	}
+
+	///@brief Function to check whether the transpose has the same arcs with the same weights as the graph
+	static bool symmetric(const csrGraph& g, const std::vector<weightType>& w, const csrGraph& t, const std::vector<weightType>& tw)
+	{
+		std::vector<std::pair<vertexId,weightType> > a, b;
+		for (vertexId v = 0; v < g.numVertices(); v++)
+		{
+			if (g.degree(v) != t.degree(v)) return false;
+			a.clear();
+			b.clear();
+			for (size_t slot = g.offsets[v]; slot < g.offsets[v+1]; slot++) a.push_back(std::make_pair(g.targets[slot], w.empty() ? 1 : w[slot]));
+			for (size_t slot = t.offsets[v]; slot < t.offsets[v+1]; slot++) b.push_back(std::make_pair(t.targets[slot], tw.empty() ? 1 : tw[slot]));
+			std::sort(a.begin(), a.end());
+			std::sort(b.begin(), b.end());
+			if (a != b) return false;
+		}
+		return true;
+	}
+
+	///@brief Function to flatten the labels of one direction, releasing them as it goes
+	static void flatten(std::vector<std::vector<entry> >& labels, labelSet& set, kind k)
+	{
+		size_t n = labels.size(), total = n;
+		for (size_t v = 0; v < n; v++) total += labels[v].size();
+		set.offsets.assign(1, 0);
+		set.offsets.reserve(n + 1);
+		set.hubs.reserve(total);
+		if (distances == k) set.dist.reserve(total);
+		for (size_t v = 0; v < n; v++)
+		{
+			for (size_t i = 0; i < labels[v].size(); i++)
+			{
+				set.hubs.push_back(labels[v][i].first);
+				if (distances == k) set.dist.push_back(labels[v][i].second);
+			}
+			set.hubs.push_back(sentinel());
+			if (distances == k) set.dist.push_back(0);
+			set.offsets.push_back(set.hubs.size());
+			std::vector<entry>().swap(labels[v]);
+		}
+	}
+
+	///@brief Member function to build the labels of a graph with the lengths in slot order, empty for an unweighted graph
+	void build(const csrGraph& g, const std::vector<weightType>& w)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		size_t n = g.numVertices();
+		// Transposed with the slots as edge indices, so that the lengths can be gathered from those in slot order
+		csrGraph t = g;
+		for (size_t slot = 0; slot < t.numSlots(); slot++) t.edgeIndex[slot] = slot;
+		t = t.transpose();
+		std::vector<weightType> tw(w.empty() ? 0 : t.numSlots());
+		for (size_t slot = 0; slot < tw.size(); slot++) tw[slot] = w[t.edgeIndex[slot]];
+		m_symmetric = symmetric(g, w, t, tw);
+		std::vector<std::pair<size_t,vertexId> > byDegree(n);
+		for (vertexId v = 0; v < n; v++) byDegree[v] = std::make_pair(g.degree(v) + t.degree(v), v);
+		std::sort(byDegree.begin(), byDegree.end(), higherDegree);
+		builder b(n);
+		for (vertexId r = 0; r < n; r++)
+		{
+			vertexId x = byDegree[r].second;
+			if (true == m_symmetric) prunedSearch(b, g, w, x, r, b.out[x], b.out, m_kind);
+			else
+			{
+				prunedSearch(b, g, w, x, r, b.out[x], b.in, m_kind);
+				prunedSearch(b, t, tw, x, r, b.in[x], b.out, m_kind);
+			}
+		}
+		flatten(b.out, m_out, m_kind);
+		if (false == m_symmetric) flatten(b.in, m_in, m_kind);
+		m_buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	///@brief Member function to write the labels of one direction
+	static void writeLabels(std::ostream& os, const labelSet& set)
+	{
+		binaryArrays::write(os, set.offsets);
+		binaryArrays::write(os, set.hubs);
+		binaryArrays::write(os, set.dist);
+	}
+
+	/**
+	 * @brief Function to read the labels of one direction, checking that they are well formed
+	 * @details Every label must hold hubs below the number of vertices in increasing rank and end with #sentinel, and the
+	 * distances, if any, must match the hubs one to one.
+	 * @param	limit	Most offsets to accept, one more than the number of vertices
+	 */
+	static bool readLabels(std::istream& is, kind k, uint64_t limit, labelSet& set)
+	{
+		if (false == binaryArrays::read(is, set.offsets, limit) || set.offsets.empty() || 0 != set.offsets[0]) return false;
+		size_t n = set.offsets.size() - 1;
+		for (size_t v = 0; v < n; v++) if (set.offsets[v] >= set.offsets[v+1]) return false;
+		// Every label holds every hub at most once, and its sentinel
+		if (set.offsets.back() > uint64_t(n) * (n + 1)) return false;
+		if (false == binaryArrays::read(is, set.hubs, set.offsets.back()) || set.hubs.size() != set.offsets.back()) return false;
+		if (false == binaryArrays::read(is, set.dist, set.offsets.back())) return false;
+		if (set.dist.size() != ((distances == k) ? set.hubs.size() : 0)) return false;
+		for (size_t v = 0; v < n; v++)
+		{
+			if (sentinel() != set.hubs[set.offsets[v+1] - 1]) return false;
+			for (size_t i = set.offsets[v]; i + 1 < set.offsets[v+1]; i++)
+				if (set.hubs[i] >= n || (i > set.offsets[v] && set.hubs[i-1] >= set.hubs[i])) return false;
+		}
+		return true;
+	}
+
+	///@brief Magic number at the start of saved labels
+	static uint64_t magic() {return 0x31304c4250474c41ULL;}
+
+public:
+	///@brief Default constructor, creates empty labels to be filled by #load
+	hubLabeling() : m_kind(distances),m_symmetric(true),m_buildSeconds(0){m_out.offsets.assign(1, 0);}
+
+	/**
+	 * @brief Constructor to label an unweighted #csrGraph
+	 * @param	g	The graph
+	 * @param	k	What the labels answer
+	 */
+	explicit hubLabeling(const csrGraph& g, kind k = distances) : m_kind(k),m_symmetric(true),m_buildSeconds(0)
+	{
+		build(g, std::vector<weightType>());
+	}
+
+	/**
+	 * @brief Constructor to label a weighted #csrGraph for #distances
+	 * @param	g	The graph
+	 * @param	w	The weights in slot order, e.g. from #csrGraph::slotProperty, all positive
+	 */
+	hubLabeling(const csrGraph& g, const propertyMap<weightType>& w) : m_kind(distances),m_symmetric(true),m_buildSeconds(0)
+	{
+		build(g, std::vector<weightType>(w.data(), w.data() + w.size()));
+	}
+
+	/**
+	 * @brief Constructor to label an unweighted #graph
+	 * @param	g	The graph, whose vertex indices are the ids used by the queries
+	 * @param	k	What the labels answer
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	explicit hubLabeling(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, kind k = distances)
+		: m_kind(k),m_symmetric(true),m_buildSeconds(0)
+	{
+		csrGraph csr(g);
+		build(csr, std::vector<weightType>());
+	}
+
+	/**
+	 * @brief Constructor to label a weighted #graph for #distances
+	 * @param	g	The graph, whose vertex indices are the ids used by the queries
+	 * @param	w	The weights keyed by #edge::index, all positive
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	hubLabeling(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w)
+		: m_kind(distances),m_symmetric(true),m_buildSeconds(0)
+	{
+		csrGraph csr(g);
+		propertyMap<weightType> slots = csr.slotProperty(w);
+		build(csr, std::vector<weightType>(slots.data(), slots.data() + slots.size()));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_out.offsets.size() - 1;}
+
+	///@brief Member function to get what the labels answer
+	kind getKind() const {return m_kind;}
+
+	///@brief Member function to get whether one set of labels serves both directions
+	bool isSymmetric() const {return m_symmetric;}
+
+	///@brief Member function to get the number of label entries over both directions, not counting the sentinels
+	size_t numEntries() const
+	{
+		size_t retVal = m_out.hubs.size() - numVertices();
+		if (false == m_symmetric) retVal += m_in.hubs.size() - numVertices();
+		return retVal;
+	}
+
+	///@brief Member function to get the average number of entries of a label
+	double averageLabel() const
+	{
+		if (0 == numVertices()) return 0;
+		return double(numEntries()) / double((m_symmetric ? 1 : 2) * numVertices());
+	}
+
+	///@brief Member function to get the bytes the labels take, which is what #save writes up to a few lengths
+	size_t indexBytes() const
+	{
+		size_t retVal = 0;
+		const labelSet* sets[2] = {&m_out, &m_in};
+		for (size_t d = 0; d < 2; d++)
+			retVal += sets[d]->offsets.size() * sizeof(size_t) + sets[d]->hubs.size() * sizeof(vertexId) + sets[d]->dist.size() * sizeof(distanceType);
+		return retVal;
+	}
+
+	///@brief Member function to get the time the construction took in seconds, 0 after a #load
+	double buildSeconds() const {return m_buildSeconds;}
+
+	///@brief Member function to get the number of entries of the out label of v, i.e. the hubs it reaches
+	size_t outLabelSize(vertexId v) const {return m_out.offsets[v+1] - m_out.offsets[v] - 1;}
+
+	///@brief Member function to get the number of entries of the in label of v, i.e. the hubs which reach it
+	size_t inLabelSize(vertexId v) const {return inLabels().offsets[v+1] - inLabels().offsets[v] - 1;}
+
+	/**
+	 * @brief Member function to check whether t is reachable from s
+	 * @details The merge stops at the first common hub.
+	 */
+	bool reachable(vertexId s, vertexId t) const
+	{
+		const labelSet& in = inLabels();
+		const vertexId* a = &m_out.hubs[m_out.offsets[s]];
+		const vertexId* b = &in.hubs[in.offsets[t]];
+#ifdef __SSE2__
+		const vertexId* endA = &m_out.hubs[0] + m_out.offsets[s+1];
+		const vertexId* endB = &in.hubs[0] + in.offsets[t+1];
+		while (a + 4 <= endA && b + 4 <= endB)
+		{
+			int mask = sortedBlocks::matches(a, b);
+			// The sentinel is the last rank of both labels, so the first match is a hub unless the labels have none in common
+			if (0 != mask) return sentinel() != a[__builtin_ctz(mask)];
+			vertexId lastA = a[3], lastB = b[3];
+			a += (lastA <= lastB) ? 4 : 0;
+			b += (lastB <= lastA) ? 4 : 0;
+		}
+#endif
+		for (;;)
+		{
+			vertexId x = *a, y = *b;
+			if (x == y) return sentinel() != x;
+			a += (x < y);
+			b += (y < x);
+		}
+	}
+
+	/**
+	 * @brief Member function to get the distance from s to t
+	 * @details The merge of the two labels runs to the end, taking the least sum over the common hubs.
+	 * @return The distance, #unreachable if t is not reachable from s or the labels were built for #reachability only
+	 */
+	distanceType distance(vertexId s, vertexId t) const
+	{
+		if (reachability == m_kind) return unreachable();
+		const labelSet& in = inLabels();
+		const vertexId* a = &m_out.hubs[m_out.offsets[s]];
+		const vertexId* b = &in.hubs[in.offsets[t]];
+		const distanceType* da = &m_out.dist[m_out.offsets[s]];
+		const distanceType* db = &in.dist[in.offsets[t]];
+		distanceType retVal = unreachable();
+#ifdef __SSE2__
+		const vertexId* endA = &m_out.hubs[0] + m_out.offsets[s+1];
+		const vertexId* endB = &in.hubs[0] + in.offsets[t+1];
+		while (a + 4 <= endA && b + 4 <= endB)
+		{
+			for (int mask = sortedBlocks::matches(a, b); 0 != mask; mask &= mask - 1)
+			{
+				int i = __builtin_ctz(mask), j = 0;
+				if (sentinel() == a[i]) return retVal;
+				while (b[j] != a[i]) j++;
+				distanceType d = distanceType(da[i] + db[j]);
+				retVal = (d < retVal) ? d : retVal;
+			}
+			vertexId lastA = a[3], lastB = b[3];
+			size_t stepA = (lastA <= lastB) ? 4 : 0, stepB = (lastB <= lastA) ? 4 : 0;
+			a += stepA;
+			da += stepA;
+			b += stepB;
+			db += stepB;
+		}
+#endif
+		for (;;)
+		{
+			vertexId x = *a, y = *b;
+			if (x == y)
+			{
+				if (sentinel() == x) break;
+				distanceType d = distanceType(*da + *db);
+				retVal = (d < retVal) ? d : retVal;
+			}
+			size_t stepA = (x <= y), stepB = (y <= x);
+			a += stepA;
+			da += stepA;
+			b += stepB;
+			db += stepB;
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to write the labels to a binary stream
+	 * @return false if the stream failed
+	 */
+	bool save(std::ostream& os) const
+	{
+		uint64_t header[4] = {magic(), sizeof(vertexId), sizeof(distanceType), uint64_t(m_kind) | (uint64_t(m_symmetric) << 1)};
+		os.write(reinterpret_cast<const char*>(header), sizeof(header));
+		writeLabels(os, m_out);
+		if (false == m_symmetric) writeLabels(os, m_in);
+		return bool(os);
+	}
+
+	/**
+	 * @brief Member function to read labels written by #save, replacing these
+	 * @details The sizes of the types must match those of the writer and the labels must be well formed, i.e. offsets growing,
+	 * hubs in range and increasing and every label ended. The arrays are read with #binaryArrays::read.
+	 * @return false if the stream failed or did not hold labels, which then leaves these empty
+	 */
+	bool load(std::istream& is)
+	{
+		*this = hubLabeling();
+		uint64_t header[4];
+		if (false == bool(is.read(reinterpret_cast<char*>(header), sizeof(header)))) return false;
+		if (magic() != header[0] || sizeof(vertexId) != header[1] || sizeof(distanceType) != header[2] || header[3] > 3) return false;
+		hubLabeling loaded;
+		loaded.m_kind = kind(header[3] & 1);
+		loaded.m_symmetric = (0 != (header[3] & 2));
+		if (false == readLabels(is, loaded.m_kind, sentinel(), loaded.m_out)) return false;
+		uint64_t n = loaded.m_out.offsets.size();
+		if (false == loaded.m_symmetric && (false == readLabels(is, loaded.m_kind, n, loaded.m_in) || n != loaded.m_in.offsets.size())) return false;
+		*this = loaded;
+		return true;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHLABELING_HPP_ */
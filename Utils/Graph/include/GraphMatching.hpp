@@ -0,0 +1,672 @@
+/**
+ * @file GraphMatching.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the maximum matching of bipartite graphs by Hopcroft-Karp and their minimum cost assignment by the
+ *  Hungarian method, both of which resume from their previous solution when the graph changes.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHMATCHING_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHMATCHING_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "IndexedHeap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Maximum cardinality matching of a bipartite graph
+ * @tparam	stats	Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by ALGOPP_STATS
+ * when not given.
+ * @details The graph is directed from the left side to the right one, e.g. from jobs to machines: every vertex with out edges is a
+ * left vertex and every other vertex a right one. Edges into left vertices do not fit that and are left out, which #isBipartite
+ * reports.
+ *
+ * #maximumMatching first matches free left vertices greedily to free neighbours and then runs the phases of Hopcroft-Karp: a
+ * breadth first search from all the free left vertices at once layers the graph along alternating paths up to the nearest free
+ * right vertices, and a depth first search with a current edge per vertex then augments along a maximal set of vertex disjoint
+ * shortest paths. At most 2 sqrt(V) phases are needed, each O(E) over flat arrays.
+ *
+ * The matching is kept between runs. #update replaces the graph by a changed one over the same vertices, keeping the pairs that are
+ * still edges, so the next run only has to augment from the vertices which lost their partner or gained edges, usually in one or
+ * two phases.
+ */
+template <class stats = defaultStatsPolicy>
+class bipartiteMatching
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+private:
+	csrGraph m_graph;	///< Member to hold the graph
+	std::vector<vertexId> m_mate;	///< Member to hold the partner of every vertex, #none() if free
+	std::vector<size_t> m_layer;	///< Member to hold the layer of every left vertex in the current phase
+	std::vector<size_t> m_next;	///< Member to hold the current edge of every left vertex in the current phase
+	size_t m_limit;	///< Member to hold the layer of the free right vertices nearest to the free left ones in the current phase
+	bool m_bipartite;	///< Member to hold whether every edge goes from a left vertex to a right one
+	size_t m_phases;	///< Member to hold the number of phases of the last run
+
+	///@brief Member function to tell whether v is a left vertex
+	bool isLeft(vertexId v) const {return m_graph.offsets[v+1] > m_graph.offsets[v];}
+
+	///@brief Member function to set up the graph, keeping the pairs of the previous matching which are still edges
+	void init(const csrGraph& g)
+	{
+		m_graph = g;
+		size_t n = g.numVertices();
+		m_bipartite = true;
+		for (size_t slot = 0; slot < g.numSlots(); slot++) m_bipartite = m_bipartite && (false == isLeft(g.targets[slot]));
+		std::vector<vertexId> previous(n, none());
+		if (m_mate.size() == n) previous.swap(m_mate);
+		m_mate.assign(n, none());
+		for (vertexId u = 0; u < n; u++)
+			if (none() != previous[u] && true == isLeft(u))
+				for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+					if (g.targets[slot] == previous[u] && none() == m_mate[g.targets[slot]] && false == isLeft(g.targets[slot]))
+					{
+						m_mate[u] = g.targets[slot];
+						m_mate[g.targets[slot]] = u;
+						break;
+					}
+	}
+
+	///@brief Member function to layer the left vertices by breadth first search from the free ones, the first roots entries of queue,
+	///returning whether a free right vertex is reachable
+	bool layers(std::vector<vertexId>& queue, size_t& roots)
+	{
+		queue.clear();
+		for (vertexId u = 0; u < m_graph.numVertices(); u++)
+		{
+			m_layer[u] = none();
+			if (true == isLeft(u) && none() == m_mate[u])
+			{
+				m_layer[u] = 0;
+				queue.push_back(u);
+			}
+			m_next[u] = m_graph.offsets[u];
+		}
+		roots = queue.size();
+		m_limit = none();
+		for (size_t head = 0; head < queue.size() && m_layer[queue[head]] < m_limit; head++)
+		{
+			vertexId u = queue[head];
+			stats::edgeVisit(m_graph.degree(u));
+			for (size_t slot = m_graph.offsets[u]; slot < m_graph.offsets[u+1]; slot++)
+			{
+				vertexId v = m_graph.targets[slot];
+				if (true == isLeft(v)) continue;
+				vertexId w = m_mate[v];
+				if (none() == w) m_limit = m_layer[u] + 1;
+				else if (none() == m_layer[w])
+				{
+					m_layer[w] = m_layer[u] + 1;
+					queue.push_back(w);
+				}
+			}
+		}
+		return none() != m_limit;
+	}
+
+	/**
+	 * @brief Member function to augment along a shortest alternating path from the free left vertex root, returning whether one was found
+	 * @details Only the vertices of the layer before the limit may end a path at a free right vertex. The vertices of the limit
+	 * layer were layered before the limit was known and not expanded, and a path through them would be longer than the shortest.
+	 */
+	bool augment(vertexId root, std::vector<vertexId>& stack)
+	{
+		stack.assign(1, root);
+		while (false == stack.empty())
+		{
+			vertexId u = stack.back();
+			if (m_next[u] == m_graph.offsets[u+1])
+			{
+				m_layer[u] = none();
+				stack.pop_back();
+				continue;
+			}
+			stats::edgeVisit();
+			vertexId v = m_graph.targets[m_next[u]++];
+			if (true == isLeft(v)) continue;
+			vertexId w = m_mate[v];
+			if (none() == w && m_layer[u] + 1 == m_limit)
+			{
+				// Every vertex of the stack takes the right vertex of its current edge
+				for (size_t i = stack.size(); i-- > 0;)
+				{
+					vertexId x = stack[i], y = m_graph.targets[m_next[x] - 1];
+					m_mate[x] = y;
+					m_mate[y] = x;
+				}
+				return true;
+			}
+			if (none() != w && none() != m_layer[w] && m_layer[w] == m_layer[u] + 1) stack.push_back(w);
+		}
+		return false;
+	}
+
+public:
+	///@brief Function to get the value marking a free vertex
+	static vertexId none() {return vertexId(-1);}
+
+	/**
+	 * @brief Constructor to set up the matching of a #csrGraph
+	 * @param	g	The graph, whose slots go from the left vertices to the right ones
+	 */
+	explicit bipartiteMatching(const csrGraph& g) : m_limit(0),m_bipartite(true),m_phases(0)
+	{
+		init(g);
+	}
+
+	/**
+	 * @brief Constructor to set up the matching of a #graph
+	 * @param	g	The graph, a #graphTraits::directed one whose edges go from the left vertices to the right ones and whose vertex
+	 * indices are the ids used by the matching
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	explicit bipartiteMatching(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g) : m_limit(0),m_bipartite(true),m_phases(0)
+	{
+		init(csrGraph(g));
+	}
+
+	/**
+	 * @brief Member function to replace the graph by a changed one, keeping the pairs which are still edges
+	 * @param	g	The new graph. If its number of vertices differs, the matching starts from scratch.
+	 */
+	void update(const csrGraph& g)
+	{
+		init(g);
+	}
+
+	/**
+	 * @brief Member function to replace the graph by a changed one, keeping the pairs which are still edges
+	 * @param	g	The new graph, a #graphTraits::directed one. If its number of vertices differs, the matching starts from scratch.
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	void update(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g)
+	{
+		init(csrGraph(g));
+	}
+
+	/**
+	 * @brief Member function to grow the matching to a maximum one
+	 * @return The number of pairs
+	 */
+	size_t maximumMatching()
+	{
+		size_t n = m_graph.numVertices();
+		for (vertexId u = 0; u < n; u++)
+			if (true == isLeft(u) && none() == m_mate[u])
+			{
+				stats::edgeVisit(m_graph.degree(u));
+				for (size_t slot = m_graph.offsets[u]; slot < m_graph.offsets[u+1]; slot++)
+				{
+					vertexId v = m_graph.targets[slot];
+					if (false == isLeft(v) && none() == m_mate[v])
+					{
+						m_mate[u] = v;
+						m_mate[v] = u;
+						break;
+					}
+				}
+			}
+		m_layer.resize(n);
+		m_next.resize(n);
+		m_phases = 0;
+		std::vector<vertexId> queue, stack;
+		size_t roots = 0;
+		while (true == layers(queue, roots))
+		{
+			m_phases++;
+			for (size_t i = 0; i < roots; i++) augment(queue[i], stack);
+		}
+		return size();
+	}
+
+	///@brief Member function to get the partner of v, #none() if it is free
+	vertexId mate(vertexId v) const {return m_mate[v];}
+
+	///@brief Member function to get the number of pairs of the matching
+	size_t size() const
+	{
+		size_t retVal = 0;
+		for (vertexId u = 0; u < m_mate.size(); u++) retVal += (none() != m_mate[u] && true == isLeft(u));
+		return retVal;
+	}
+
+	///@brief Member function to get the number of phases of the last #maximumMatching
+	size_t lastPhases() const {return m_phases;}
+
+	///@brief Member function to tell whether every edge goes from a left vertex to a right one
+	bool isBipartite() const {return m_bipartite;}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_graph.numVertices();}
+};
+
+/**
+ * @brief Minimum cost assignment of a bipartite graph
+ * @tparam	costType	Type of the costs, a signed fundamental type. With floating point costs the pairs are kept only while their
+ * reduced cost is exactly 0, which is still correct but may redo more work after #update.
+ * @tparam	stats		Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The sides are those of #bipartiteMatching: the edges go from the left vertices, the rows, to the right ones, the
+ * columns, and a left vertex may have several edges to the same right vertex, of which the cheapest counts. The result matches as
+ * many left vertices as possible, and among all such matchings has the least total cost.
+ *
+ * Every left vertex gets a private dummy column of a cost larger than any difference of matchings, so that a left vertex ends on
+ * it only when no maximum matching covers it, and the problem becomes one of matching every row. #solve is the Hungarian method
+ * over the sparse graph: potentials on rows and columns keep every reduced cost, the cost of an edge less the potentials of its
+ * ends, non negative and those of the pairs 0, and every free row is matched along a shortest alternating path found by Dijkstra
+ * with an #indexedHeap over the reduced costs, after which the potentials of the columns it settled are moved so that the
+ * invariants hold again. Columns which are not matched keep potential 0, none above, as a minimum cost matching needs. Rows with a
+ * 0 reduced cost edge to a free column are first matched without a search.
+ *
+ * Everything is kept between runs, and #update repairs it for a changed graph over the same vertices as in the dynamic Hungarian
+ * method: every row whose edges became cheaper lowers its potential, which breaks its pair when that pair is no longer at reduced
+ * cost 0, in one O(E) pass. A column left free with a negative potential would break the invariants, and raising it to 0 could
+ * break the pairs of all its rows in a chain, so it gets a backward search instead, which only looks as far as its potential
+ * is below 0 and either matches it again or brings it back to 0. The next #solve then needs one search per broken pair instead
+ * of one per row, see #lastSearches.
+ */
+template <typename costType = long long, class stats = defaultStatsPolicy>
+class bipartiteAssignment
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+private:
+	csrGraph m_graph;	///< Member to hold the graph
+	propertyMap<costType> m_cost;	///< Member to hold the cost of every slot
+	std::vector<size_t> m_columnOffsets;	///< Member to hold the first entry of #m_columnSlots of every vertex
+	std::vector<size_t> m_columnSlots;	///< Member to hold the slots into every right vertex
+	std::vector<vertexId> m_tails;	///< Member to hold the left vertex of every slot
+	costType m_dummy;	///< Member to hold the cost of the dummy columns
+	std::vector<costType> m_rowPotential;	///< Member to hold the potential of every left vertex
+	std::vector<costType> m_columnPotential;	///< Member to hold the potential of every right vertex, and of the dummy of left vertex u at V + u
+	std::vector<size_t> m_mate;	///< Member to hold the partner of every vertex and dummy, #free() if none
+	size_t m_searches;	///< Member to hold the number of shortest path searches since the last #update
+	indexedHeap<costType,basic_heap_min_traits<costType>,noStats> m_heap;	///< Member to hold the queue of the searches
+	std::vector<costType> m_distance;	///< Member to hold the distance of every vertex, dummy and the sink at 2 V in the current search
+	std::vector<size_t> m_predecessor;	///< Member to hold what every vertex, dummy and the sink was reached from in the current search
+	std::vector<char> m_state;	///< Member to hold whether every vertex, dummy and the sink is unseen, queued or settled in the current search
+
+	///@brief Function to get the value marking a free vertex or dummy
+	static size_t free() {return size_t(-1);}
+
+	///@brief Member function to tell whether v is a left vertex
+	bool isLeft(vertexId v) const {return m_graph.offsets[v+1] > m_graph.offsets[v];}
+
+	///@brief Member function to get the number of vertices
+	size_t n() const {return m_graph.numVertices();}
+
+	///@brief Member function to set up the graph and the dummy cost, and repair the potentials and pairs kept from the last run
+	void init(const csrGraph& g, const propertyMap<costType>& cost)
+	{
+		bool keep = (g.numVertices() == n() && false == m_mate.empty());
+		m_graph = g;
+		m_cost = cost;
+		m_tails.resize(g.numSlots());
+		m_columnOffsets.assign(n() + 1, 0);
+		costType least = 0, most = 0;
+		size_t rows = 0;
+		for (vertexId u = 0; u < n(); u++)
+		{
+			rows += isLeft(u);
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+			{
+				m_tails[slot] = u;
+				if (false == isLeft(g.targets[slot])) m_columnOffsets[g.targets[slot] + 1]++;
+				least = std::min(least, cost[slot]);
+				most = std::max(most, cost[slot]);
+			}
+		}
+		for (size_t v = 0; v < n(); v++) m_columnOffsets[v+1] += m_columnOffsets[v];
+		m_columnSlots.resize(m_columnOffsets.back());
+		std::vector<size_t> next(m_columnOffsets.begin(), m_columnOffsets.end() - 1);
+		for (size_t slot = 0; slot < g.numSlots(); slot++)
+			if (false == isLeft(g.targets[slot])) m_columnSlots[next[g.targets[slot]]++] = slot;
+		// Trading a dummy for an edge must pay off whatever happens to the other rows
+		m_dummy = costType(rows + 1) * (most - least) + most + 1;
+		if (false == keep)
+		{
+			m_rowPotential.assign(n(), std::numeric_limits<costType>::max());
+			m_columnPotential.assign(2 * n(), 0);
+			m_mate.assign(2 * n(), free());
+			m_heap = indexedHeap<costType,basic_heap_min_traits<costType>,noStats>(2 * n() + 1);
+			m_distance.assign(2 * n() + 1, 0);
+			m_predecessor.assign(2 * n() + 1, 0);
+			m_state.assign(2 * n() + 1, 0);
+		}
+		m_searches = 0;
+		repair();
+	}
+
+	///@brief Member function to break the pair of the row u, keeping its column if that is left with a negative potential
+	void unmatch(vertexId u, std::vector<size_t>& columns)
+	{
+		size_t column = m_mate[u];
+		if (free() == column) return;
+		m_mate[u] = free();
+		m_mate[column] = free();
+		if (m_columnPotential[column] < 0) columns.push_back(column);
+	}
+
+	/**
+	 * @brief Member function to make every reduced cost non negative, every pair tight and every free column 0 again
+	 * @details Pairs whose ends changed sides are dropped first. Then every row lowers its potential to its least reduced cost and
+	 * loses its pair if that is not at reduced cost 0 any more, and every column left free with a negative potential is put right by
+	 * #release.
+	 */
+	void repair()
+	{
+		std::vector<size_t> columns, touched;
+		for (size_t x = 0; x < 2 * n(); x++)
+		{
+			size_t y = m_mate[x];
+			if (free() == y) continue;
+			bool leftEnd = (x < n() && true == isLeft(vertexId(x)));
+			bool fits = (m_mate[y] == x) && ((true == leftEnd) ? (y >= n() || false == isLeft(vertexId(y))) : (y < n() && true == isLeft(vertexId(y))));
+			if (false == fits) m_mate[x] = free();
+		}
+		for (size_t x = 0; x < 2 * n(); x++)
+			if ((x < n()) ? (false == isLeft(vertexId(x))) : (true == isLeft(vertexId(x - n()))))
+				if (free() == m_mate[x] && m_columnPotential[x] < 0) columns.push_back(x);
+		for (vertexId u = 0; u < n(); u++)
+		{
+			if (false == isLeft(u)) continue;
+			costType least = m_dummy - m_columnPotential[n() + u];
+			bool tight = (m_mate[u] == n() + u && 0 == least - m_rowPotential[u]);
+			stats::edgeVisit(m_graph.degree(u));
+			for (size_t slot = m_graph.offsets[u]; slot < m_graph.offsets[u+1]; slot++)
+			{
+				vertexId v = m_graph.targets[slot];
+				if (true == isLeft(v)) continue;
+				costType reduced = m_cost[slot] - m_columnPotential[v];
+				least = std::min(least, reduced);
+				tight = tight || (m_mate[u] == v && 0 == reduced - m_rowPotential[u]);
+			}
+			if (least < m_rowPotential[u])
+			{
+				m_rowPotential[u] = least;
+				tight = false;
+			}
+			if (false == tight) unmatch(u, columns);
+		}
+		for (size_t i = 0; i < columns.size(); i++)
+			if (free() == m_mate[columns[i]] && m_columnPotential[columns[i]] < 0) release(columns[i], touched);
+	}
+
+	///@brief Member function to offer the vertex, column or sink x the distance d through from in the current search
+	void reach(size_t x, costType d, size_t from, std::vector<size_t>& touched)
+	{
+		if (0 == m_state[x])
+		{
+			m_state[x] = 1;
+			touched.push_back(x);
+		}
+		else if (2 == m_state[x] || d >= m_distance[x]) return;
+		m_distance[x] = d;
+		m_predecessor[x] = from;
+		m_heap.push(x, d);
+	}
+
+	///@brief Member function to empty the queue and forget the current search
+	void clearSearch(const std::vector<size_t>& touched)
+	{
+		for (size_t i = 0; i < touched.size(); i++)
+		{
+			m_heap.remove(touched[i]);
+			m_state[touched[i]] = 0;
+		}
+	}
+
+	///@brief Member function to give the pairs along the predecessors from the row u up to the column start
+	void rematch(size_t u, size_t start)
+	{
+		for (;;)
+		{
+			size_t column = m_predecessor[u];
+			m_mate[u] = column;
+			m_mate[column] = u;
+			if (column == start) return;
+			u = m_predecessor[column];
+		}
+	}
+
+	/**
+	 * @brief Member function to bring a free column with a negative potential back to 0, or match it
+	 * @param	start	The column
+	 * @param	touched	Scratch list of the vertices reached
+	 * @details Dijkstra runs backwards from the column over the reduced costs, the way a pair would have to change to take the
+	 * column: from a column to the rows with an edge into it which is not their pair, from a row to its partner, and from a matched
+	 * column to a sink at minus its potential, the price of freeing it instead. Whatever comes first within the deficit of the column,
+	 * minus its potential, ends the search: a free row takes the column along the path, or the sink frees the matched column it came
+	 * from and moves the pairs along the path to take the column, or else the column goes back to 0. The settled vertices then move
+	 * their potentials by the end distance less their own, as #search does the other way round, so that only the vertices nearer than
+	 * the deficit are touched.
+	 */
+	void release(size_t start, std::vector<size_t>& touched)
+	{
+		size_t sink = 2 * n(), end = free();
+		costType cap = -m_columnPotential[start];
+		m_searches++;
+		touched.clear();
+		reach(start, 0, free(), touched);
+		while (false == m_heap.empty() && m_heap.topKey() < cap)
+		{
+			costType d = m_heap.topKey();
+			size_t x = m_heap.extractTop();
+			m_state[x] = 2;
+			bool row = (x < n() && true == isLeft(vertexId(x)));
+			if (sink == x || (true == row && free() == m_mate[x]))
+			{
+				end = x;
+				cap = d;
+				break;
+			}
+			if (true == row)
+			{
+				reach(m_mate[x], d, x, touched);
+				continue;
+			}
+			if (start != x) reach(sink, d - m_columnPotential[x], x, touched);
+			if (x >= n())
+			{
+				vertexId u = vertexId(x - n());
+				if (m_mate[u] != x) reach(u, d + m_dummy - m_rowPotential[u] - m_columnPotential[x], x, touched);
+				continue;
+			}
+			stats::edgeVisit(m_columnOffsets[x+1] - m_columnOffsets[x]);
+			for (size_t i = m_columnOffsets[x]; i < m_columnOffsets[x+1]; i++)
+			{
+				size_t slot = m_columnSlots[i];
+				vertexId u = m_tails[slot];
+				if (m_mate[u] != x) reach(u, d + m_cost[slot] - m_rowPotential[u] - m_columnPotential[x], x, touched);
+			}
+		}
+		for (size_t i = 0; i < touched.size(); i++)
+		{
+			size_t x = touched[i];
+			if (2 != m_state[x] || sink == x || m_distance[x] >= cap) continue;
+			if (x < n() && true == isLeft(vertexId(x))) m_rowPotential[x] -= cap - m_distance[x];
+			else m_columnPotential[x] += cap - m_distance[x];
+		}
+		if (sink == end)
+		{
+			size_t freed = m_predecessor[sink], u = m_mate[freed];
+			m_mate[freed] = free();
+			rematch(u, start);
+		}
+		else if (free() != end) rematch(end, start);
+		clearSearch(touched);
+	}
+
+	///@brief Member function to offer the columns of row u, reached at distance d, in the current search
+	void scan(vertexId u, costType d, std::vector<size_t>& touched)
+	{
+		costType base = d - m_rowPotential[u];
+		reach(n() + u, base + m_dummy - m_columnPotential[n() + u], u, touched);
+		stats::edgeVisit(m_graph.degree(u));
+		for (size_t slot = m_graph.offsets[u]; slot < m_graph.offsets[u+1]; slot++)
+		{
+			vertexId v = m_graph.targets[slot];
+			if (false == isLeft(v)) reach(v, base + m_cost[slot] - m_columnPotential[v], u, touched);
+		}
+	}
+
+	///@brief Member function to match the free row root along a shortest alternating path to a free column
+	void search(vertexId root, std::vector<size_t>& touched, std::vector<size_t>& settled)
+	{
+		m_searches++;
+		touched.clear();
+		settled.clear();
+		scan(root, 0, touched);
+		size_t column = free();
+		costType d = 0;
+		while (false == m_heap.empty())
+		{
+			d = m_heap.topKey();
+			column = m_heap.extractTop();
+			m_state[column] = 2;
+			if (free() == m_mate[column]) break;
+			settled.push_back(column);
+			scan(vertexId(m_mate[column]), d, touched);
+		}
+		// The root's dummy is always reachable, so the search ends at a free column at distance d
+		m_rowPotential[root] += d;
+		for (size_t i = 0; i < settled.size(); i++)
+		{
+			costType gain = d - m_distance[settled[i]];
+			m_columnPotential[settled[i]] -= gain;
+			m_rowPotential[m_mate[settled[i]]] += gain;
+		}
+		for (;;)
+		{
+			size_t u = m_predecessor[column], previous = m_mate[u];
+			m_mate[u] = column;
+			m_mate[column] = u;
+			if (u == root) break;
+			column = previous;
+		}
+		clearSearch(touched);
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the assignment of a #csrGraph
+	 * @param	g		The graph, whose slots go from the left vertices to the right ones
+	 * @param	cost	The costs in slot order, e.g. from #csrGraph::slotProperty
+	 */
+	bipartiteAssignment(const csrGraph& g, const propertyMap<costType>& cost) : m_dummy(0),m_searches(0)
+	{
+		init(g, cost);
+	}
+
+	/**
+	 * @brief Constructor to set up the assignment of a #graph
+	 * @param	g		The graph, a #graphTraits::directed one whose edges go from the left vertices to the right ones and whose vertex
+	 * indices are the ids used by the assignment
+	 * @param	cost	The costs keyed by #edge::index
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	bipartiteAssignment(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<costType>& cost) : m_dummy(0),m_searches(0)
+	{
+		csrGraph csr(g);
+		init(csr, csr.slotProperty(cost));
+	}
+
+	/**
+	 * @brief Member function to replace the graph and costs by changed ones, keeping the potentials and the pairs which stay optimal
+	 * @param	g		The new graph. If its number of vertices differs, the assignment starts from scratch.
+	 * @param	cost	The new costs in slot order
+	 */
+	void update(const csrGraph& g, const propertyMap<costType>& cost)
+	{
+		init(g, cost);
+	}
+
+	/**
+	 * @brief Member function to replace the graph and costs by changed ones, keeping the potentials and the pairs which stay optimal
+	 * @param	g		The new graph, a #graphTraits::directed one. If its number of vertices differs, the assignment starts from scratch.
+	 * @param	cost	The new costs keyed by #edge::index
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	void update(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<costType>& cost)
+	{
+		csrGraph csr(g);
+		init(csr, csr.slotProperty(cost));
+	}
+
+	/**
+	 * @brief Member function to complete the assignment
+	 * @return The total cost of the pairs
+	 */
+	costType solve()
+	{
+		std::vector<size_t> touched, settled;
+		for (vertexId u = 0; u < n(); u++)
+		{
+			if (false == isLeft(u) || free() != m_mate[u]) continue;
+			for (size_t slot = m_graph.offsets[u]; slot < m_graph.offsets[u+1]; slot++)
+			{
+				vertexId v = m_graph.targets[slot];
+				if (false == isLeft(v) && free() == m_mate[v] && 0 == m_cost[slot] - m_rowPotential[u] - m_columnPotential[v])
+				{
+					m_mate[u] = v;
+					m_mate[v] = u;
+					break;
+				}
+			}
+			if (free() != m_mate[u]) continue;
+			search(u, touched, settled);
+		}
+		return cost();
+	}
+
+	///@brief Member function to get the partner of v, #none() if it is free
+	vertexId mate(vertexId v) const {return (m_mate[v] < n()) ? vertexId(m_mate[v]) : none();}
+
+	///@brief Function to get the value marking a free vertex
+	static vertexId none() {return vertexId(-1);}
+
+	///@brief Member function to get the number of pairs
+	size_t size() const
+	{
+		size_t retVal = 0;
+		for (vertexId u = 0; u < n(); u++) retVal += (true == isLeft(u) && m_mate[u] < n());
+		return retVal;
+	}
+
+	///@brief Member function to get the total cost of the pairs, the cheapest edge of every pair
+	costType cost() const
+	{
+		costType retVal = 0;
+		for (vertexId u = 0; u < n(); u++)
+		{
+			if (false == isLeft(u) || m_mate[u] >= n()) continue;
+			bool found = false;
+			costType least = 0;
+			for (size_t slot = m_graph.offsets[u]; slot < m_graph.offsets[u+1]; slot++)
+				if (m_graph.targets[slot] == m_mate[u] && (false == found || m_cost[slot] < least))
+				{
+					least = m_cost[slot];
+					found = true;
+				}
+			retVal += least;
+		}
+		return retVal;
+	}
+
+	///@brief Member function to get the number of shortest path searches since the construction or the last #update
+	size_t lastSearches() const {return m_searches;}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return n();}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHMATCHING_HPP_ */
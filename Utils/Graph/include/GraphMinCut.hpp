@@ -0,0 +1,469 @@
+/**
+ * @file GraphMinCut.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the global minimum cut of undirected weighted graphs, by Stoer-Wagner, by Nagamochi-Ibaraki
+ *  contraction and by the randomized recursive contraction of Karger and Stein.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHMINCUT_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHMINCUT_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <cmath>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphThreads.hpp"
+#include "IndexedHeap.hpp"
+#include "RollbackUnionFind.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Global minimum cut of an undirected weighted graph
+ * @tparam	weightType	Type of the edge weights, a fundamental type. The weights must not be negative.
+ * @tparam	stats		Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The minimum cut splits the vertices into two non empty sides with the least total weight of the edges between them. The
+ * graph is read as undirected, from a #graphTraits::bidirectional #graph or a symmetric #csrGraph, and
+ * is kept as a list of edges with loops dropped and parallel edges merged by adding their weights. Every method returns the value
+ * of the cut and can give the side which does not hold vertex 0, and stops as soon as it finds a cut of value 0, which a graph
+ * that is not connected always has.
+ *
+ * All the methods contract edges: the ends of an edge which no minimum cut can separate, or a random one, become a single vertex,
+ * whose edges to the same vertex are merged. Every contraction unites the vertices in a #rollbackUnionFind and then renumbers the
+ * sets and merges the edges in linear time.
+ *
+ * #stoerWagner runs maximum adjacency orderings with an #indexedHeap: every vertex is added in turn to a growing set, always the
+ * one most strongly connected to it. The last vertex of the ordering alone is a minimum cut between the last two, which are then
+ * contracted, so V - 1 orderings find the minimum cut in O(V E log V).
+ *
+ * #nagamochiIbaraki runs the same orderings, but every ordering also gives for every edge a lower bound on the connectivity of its
+ * ends, and every edge whose bound is at least the best cut found so far is contracted at once. Along with the best cut, which is
+ * never more than the least weighted degree, this usually shrinks the graph a lot in every round, so that graphs of hundreds of
+ * thousands of edges need only a few orderings.
+ *
+ * #kargerStein contracts random edges, picked with probability proportional to their weight, down to V / sqrt(2) vertices twice
+ * independently, and recurses on both results, finishing graphs of six vertices or less by trying all their cuts. One trial takes
+ * O(V^2 log V) and finds a given minimum cut with probability Omega(1 / log V). The trials are independent and are shared among
+ * threads. The random contraction sorts the edges by exponential keys of rate equal to their weight and unites them in that order,
+ * which is the same as picking them one at a time, and the two branches of a level contract from the same union-find, rolled back
+ * in between.
+ */
+template <typename weightType = long long, class stats = defaultStatsPolicy>
+class graphMinCut
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+private:
+	/**
+	 * @brief Undirected graph as a list of edges, without loops and parallel edges
+	 */
+	struct edgeList
+	{
+		size_t n;	///< Member to hold the number of vertices
+		std::vector<vertexId> u;	///< Member to hold the smaller end of every edge
+		std::vector<vertexId> v;	///< Member to hold the larger end of every edge
+		std::vector<weightType> w;	///< Member to hold the weight of every edge
+	};
+
+	/**
+	 * @brief Best cut found by a run
+	 */
+	struct bestCut
+	{
+		weightType value;	///< Member to hold the value of the cut
+		std::vector<bool> side;	///< Member to hold whether every original vertex is on the side without vertex 0
+	};
+
+	edgeList m_graph;	///< Member to hold the graph
+
+	///@brief Function to get the value standing for no cut found yet
+	static weightType infinity() {return std::numeric_limits<weightType>::max();}
+
+	/**
+	 * @brief Function to number the sets of a union-find over the vertices of g and build the graph of the sets
+	 * @param	g		The graph
+	 * @param	uf		Union-find over the vertices of g
+	 * @param	child	Set to the graph whose vertices are the sets, numbered by their smallest vertex
+	 * @param	map		Set to the vertex of child of every vertex of g
+	 * @return The number of edges visited, left to the caller to report, as the trials of #kargerStein contract on several threads
+	 */
+	static size_t contract(const edgeList& g, const rollbackUnionFind<noStats>& uf, edgeList& child, std::vector<vertexId>& map)
+	{
+		std::vector<vertexId> setOf(g.n, vertexId(-1));
+		map.resize(g.n);
+		child.n = 0;
+		for (size_t x = 0; x < g.n; x++)
+		{
+			size_t root = uf.find(x);
+			if (vertexId(-1) == setOf[root]) setOf[root] = vertexId(child.n++);
+			map[x] = setOf[root];
+		}
+		// Buckets the edges by their smaller end, and merges the ones with the same larger end with a marker per vertex
+		std::vector<size_t> start(child.n + 1, 0), order(g.u.size()), last(child.n, size_t(-1));
+		for (size_t e = 0; e < g.u.size(); e++)
+		{
+			vertexId a = map[g.u[e]], b = map[g.v[e]];
+			if (a != b) start[std::min(a, b) + 1]++;
+		}
+		for (size_t i = 0; i < child.n; i++) start[i+1] += start[i];
+		std::vector<size_t> next(start.begin(), start.end() - 1);
+		for (size_t e = 0; e < g.u.size(); e++)
+		{
+			vertexId a = map[g.u[e]], b = map[g.v[e]];
+			if (a != b) order[next[std::min(a, b)]++] = e;
+		}
+		child.u.clear();
+		child.v.clear();
+		child.w.clear();
+		for (vertexId a = 0; a < child.n; a++)
+		{
+			size_t first = child.u.size();
+			for (size_t i = start[a]; i < start[a+1]; i++)
+			{
+				size_t e = order[i];
+				vertexId b = std::max(map[g.u[e]], map[g.v[e]]);
+				if (size_t(-1) != last[b] && last[b] >= first) child.w[last[b]] += g.w[e];
+				else
+				{
+					last[b] = child.u.size();
+					child.u.push_back(a);
+					child.v.push_back(b);
+					child.w.push_back(g.w[e]);
+				}
+			}
+		}
+		return g.u.size();
+	}
+
+	///@brief Function to build the adjacency of a list of edges, whose edgeIndex holds the position of the edge in the list
+	static csrGraph adjacency(const edgeList& g)
+	{
+		csrGraph retVal;
+		retVal.offsets.assign(g.n + 1, 0);
+		for (size_t e = 0; e < g.u.size(); e++)
+		{
+			retVal.offsets[g.u[e] + 1]++;
+			retVal.offsets[g.v[e] + 1]++;
+		}
+		for (size_t i = 0; i < g.n; i++) retVal.offsets[i+1] += retVal.offsets[i];
+		retVal.targets.resize(2 * g.u.size());
+		retVal.edgeIndex.resize(2 * g.u.size());
+		std::vector<size_t> next(retVal.offsets.begin(), retVal.offsets.end() - 1);
+		for (size_t e = 0; e < g.u.size(); e++)
+		{
+			size_t a = next[g.u[e]]++, b = next[g.v[e]]++;
+			retVal.targets[a] = g.v[e];
+			retVal.edgeIndex[a] = e;
+			retVal.targets[b] = g.u[e];
+			retVal.edgeIndex[b] = e;
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Function to run a maximum adjacency ordering
+	 * @param	g		The graph
+	 * @param	adj		Its #adjacency
+	 * @param	bound	Set to the connectivity of the ends of every edge to the vertices before the later end when it was reached,
+	 * a lower bound on the connectivity of the ends
+	 * @param	s		Set to the last but one vertex
+	 * @param	t		Set to the last vertex
+	 * @return The connectivity of t to all the other vertices, the value of the cut between s and t
+	 */
+	static weightType maximumAdjacency(const edgeList& g, const csrGraph& adj, std::vector<weightType>& bound, vertexId& s, vertexId& t)
+	{
+		indexedHeap<weightType,basic_heap_max_traits<weightType>,noStats> heap(g.n);
+		for (vertexId x = 0; x < g.n; x++) heap.insert(x, 0);
+		bound.assign(g.u.size(), 0);
+		weightType retVal = 0;
+		s = t = 0;
+		while (false == heap.empty())
+		{
+			s = t;
+			retVal = heap.topKey();
+			t = vertexId(heap.extractTop());
+			stats::edgeVisit(adj.degree(t));
+			for (size_t slot = adj.offsets[t]; slot < adj.offsets[t+1]; slot++)
+			{
+				vertexId x = adj.targets[slot];
+				if (false == heap.contains(x)) continue;
+				size_t e = adj.edgeIndex[slot];
+				bound[e] = heap.key(x) + g.w[e];
+				heap.changeKey(x, bound[e]);
+			}
+		}
+		return retVal;
+	}
+
+	///@brief Member function to record a cut whose side is the set of original vertices in group x, if it beats the best one
+	void record(bestCut& best, weightType value, const std::vector<vertexId>& group, vertexId x) const
+	{
+		if (value >= best.value) return;
+		best.value = value;
+		best.side.assign(group.size(), false);
+		for (size_t i = 0; i < group.size(); i++) best.side[i] = (group[i] == x);
+		if (true == best.side[0]) best.side.flip();
+	}
+
+	///@brief Member function to give the result of a run, 0 with no side for graphs of less than two vertices
+	weightType finish(const bestCut& best, std::vector<vertexId>* side) const
+	{
+		if (NULL != side)
+		{
+			side->clear();
+			for (size_t i = 0; i < best.side.size(); i++) if (true == best.side[i]) side->push_back(vertexId(i));
+		}
+		return (infinity() == best.value) ? 0 : best.value;
+	}
+
+	/**
+	 * @brief State of one trial of #kargerStein
+	 */
+	struct trialState
+	{
+		std::mt19937_64 random;	///< Member to hold the random numbers of the trial
+		std::vector<std::vector<vertexId> > maps;	///< Member to hold the maps from every level of the recursion to the next
+		bestCut best;	///< Member to hold the best cut of the trial
+		size_t visited;	///< Member to hold the edges visited by the contractions of the trial
+	};
+
+	///@brief Member function to record a cut of the deepest level, whose side is given for its vertices, if it beats the best one
+	void recordLevel(trialState& st, weightType value, const std::vector<bool>& levelSide) const
+	{
+		if (value >= st.best.value) return;
+		st.best.value = value;
+		st.best.side.assign(m_graph.n, false);
+		for (size_t x = 0; x < m_graph.n; x++)
+		{
+			size_t y = x;
+			for (size_t l = 0; l < st.maps.size(); l++) y = st.maps[l][y];
+			st.best.side[x] = levelSide[y];
+		}
+		if (true == st.best.side[0]) st.best.side.flip();
+	}
+
+	///@brief Member function to run the recursive contraction of one trial on g
+	void recurse(trialState& st, const edgeList& g) const
+	{
+		if (g.n <= 6)
+		{
+			// Every cut of a small graph, the last vertex always on the side with mask bit 0
+			std::vector<bool> levelSide(g.n);
+			for (size_t mask = 1; mask < (size_t(1) << (g.n - 1)); mask++)
+			{
+				weightType value = 0;
+				for (size_t e = 0; e < g.u.size(); e++) value += (((mask >> g.u[e]) ^ (mask >> g.v[e])) & 1) ? g.w[e] : 0;
+				if (value >= st.best.value) continue;
+				for (size_t x = 0; x < g.n; x++) levelSide[x] = ((mask >> x) & 1);
+				recordLevel(st, value, levelSide);
+			}
+			return;
+		}
+		size_t target = size_t(std::ceil(1 + double(g.n) / std::sqrt(2.0)));
+		rollbackUnionFind<noStats> uf(g.n);
+		std::vector<std::pair<double,size_t> > keys;
+		edgeList child;
+		for (size_t branch = 0; branch < 2; branch++)
+		{
+			keys.clear();
+			for (size_t e = 0; e < g.u.size(); e++)
+				if (g.w[e] > 0)
+				{
+					double uniform = (double(st.random() >> 11) + 0.5) / 9007199254740992.0;
+					keys.push_back(std::make_pair(-std::log(uniform) / double(g.w[e]), e));
+				}
+			std::sort(keys.begin(), keys.end());
+			for (size_t i = 0; i < keys.size() && uf.components() > target; i++) uf.unite(g.u[keys[i].second], g.v[keys[i].second]);
+			if (uf.components() > target)
+			{
+				// The edges ran out, so the sets are not connected to each other and any one of them is a cut of value 0
+				std::vector<bool> levelSide(g.n);
+				for (size_t x = 0; x < g.n; x++) levelSide[x] = uf.connected(x, 0);
+				recordLevel(st, 0, levelSide);
+				return;
+			}
+			st.maps.push_back(std::vector<vertexId>());
+			st.visited += contract(g, uf, child, st.maps.back());
+			recurse(st, child);
+			st.maps.pop_back();
+			uf.rollback(0);
+		}
+	}
+
+	/**
+	 * @brief State shared by the threads of #kargerStein
+	 */
+	struct sharedTrials
+	{
+		const graphMinCut* p;	///< Member to hold the graph
+		size_t trials;	///< Member to hold the number of trials
+		unsigned long long seed;	///< Member to hold the seed of the first trial
+		std::vector<bestCut> best;	///< Member to hold the best cut of every thread
+		std::vector<size_t> visited;	///< Member to hold the edges visited by the trials of every thread
+	};
+
+	///@brief Function run by every thread of #kargerStein on the trials t, t + threads, ...
+	static void runTrials(sharedTrials* s, size_t t)
+	{
+		for (size_t trial = t; trial < s->trials && 0 != s->best[t].value; trial += s->best.size())
+		{
+			trialState st;
+			st.random.seed(s->seed + trial);
+			st.best.value = s->best[t].value;
+			st.visited = 0;
+			s->p->recurse(st, s->p->m_graph);
+			s->visited[t] += st.visited;
+			if (st.best.value < s->best[t].value) s->best[t] = st.best;
+		}
+	}
+
+	///@brief Member function to keep the edges u < v of a symmetric #csrGraph, merged
+	void init(const csrGraph& g, const propertyMap<weightType>& w)
+	{
+		edgeList all;
+		all.n = g.numVertices();
+		for (vertexId a = 0; a < g.numVertices(); a++)
+			for (size_t slot = g.offsets[a]; slot < g.offsets[a+1]; slot++)
+				if (a < g.targets[slot])
+				{
+					all.u.push_back(a);
+					all.v.push_back(g.targets[slot]);
+					all.w.push_back(w[slot]);
+				}
+		std::vector<vertexId> map;
+		stats::edgeVisit(contract(all, rollbackUnionFind<noStats>(all.n), m_graph, map));
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the cuts of a #csrGraph
+	 * @param	g	The graph, a symmetric #csrGraph
+	 * @param	w	The weights in slot order, e.g. from #csrGraph::slotProperty
+	 */
+	graphMinCut(const csrGraph& g, const propertyMap<weightType>& w)
+	{
+		init(g, w);
+	}
+
+	/**
+	 * @brief Constructor to set up the cuts of a #graph
+	 * @param	g	The graph, a #graphTraits::bidirectional one, whose vertex indices are the ids of the sides
+	 * @param	w	The weights keyed by #edge::index
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	graphMinCut(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w)
+	{
+		csrGraph csr(g);
+		init(csr, csr.slotProperty(w));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_graph.n;}
+
+	///@brief Member function to get the number of edges, once loops are dropped and parallel edges merged
+	size_t numEdges() const {return m_graph.u.size();}
+
+	/**
+	 * @brief Member function to find a minimum cut by Stoer-Wagner
+	 * @param	side	If not NULL, set to the vertices of the side of the cut without vertex 0, in increasing order
+	 * @return The value of the cut, 0 for graphs of less than two vertices
+	 */
+	weightType stoerWagner(std::vector<vertexId>* side = NULL) const
+	{
+		bestCut best = {infinity(), std::vector<bool>()};
+		std::vector<vertexId> group(m_graph.n), map;
+		for (size_t x = 0; x < m_graph.n; x++) group[x] = vertexId(x);
+		edgeList g = m_graph, child;
+		std::vector<weightType> bound;
+		while (g.n > 1 && 0 != best.value)
+		{
+			vertexId s, t;
+			weightType cut = maximumAdjacency(g, adjacency(g), bound, s, t);
+			record(best, cut, group, t);
+			rollbackUnionFind<noStats> uf(g.n);
+			uf.unite(s, t);
+			stats::edgeVisit(contract(g, uf, child, map));
+			for (size_t x = 0; x < group.size(); x++) group[x] = map[group[x]];
+			g.n = child.n;
+			g.u.swap(child.u);
+			g.v.swap(child.v);
+			g.w.swap(child.w);
+		}
+		return finish(best, side);
+	}
+
+	/**
+	 * @brief Member function to find a minimum cut by Nagamochi-Ibaraki contraction
+	 * @copydetails stoerWagner
+	 */
+	weightType nagamochiIbaraki(std::vector<vertexId>* side = NULL) const
+	{
+		bestCut best = {infinity(), std::vector<bool>()};
+		std::vector<vertexId> group(m_graph.n), map;
+		for (size_t x = 0; x < m_graph.n; x++) group[x] = vertexId(x);
+		edgeList g = m_graph, child;
+		std::vector<weightType> bound, degree;
+		while (g.n > 1 && 0 != best.value)
+		{
+			degree.assign(g.n, 0);
+			for (size_t e = 0; e < g.u.size(); e++)
+			{
+				degree[g.u[e]] += g.w[e];
+				degree[g.v[e]] += g.w[e];
+			}
+			vertexId lightest = vertexId(std::min_element(degree.begin(), degree.end()) - degree.begin());
+			record(best, degree[lightest], group, lightest);
+			vertexId s, t;
+			maximumAdjacency(g, adjacency(g), bound, s, t);
+			rollbackUnionFind<noStats> uf(g.n);
+			// The cut of s and t is the degree of t, already recorded, so they can be contracted in any case
+			uf.unite(s, t);
+			for (size_t e = 0; e < g.u.size(); e++) if (bound[e] >= best.value) uf.unite(g.u[e], g.v[e]);
+			stats::edgeVisit(contract(g, uf, child, map));
+			for (size_t x = 0; x < group.size(); x++) group[x] = map[group[x]];
+			g.n = child.n;
+			g.u.swap(child.u);
+			g.v.swap(child.v);
+			g.w.swap(child.w);
+		}
+		return finish(best, side);
+	}
+
+	/**
+	 * @brief Member function to find a minimum cut with high probability by Karger-Stein
+	 * @param	trials		Number of independent trials, 0 for the square of log2 V, which misses a minimum cut with probability
+	 * about 1 / V
+	 * @param	noOfThreads	Number of threads sharing the trials
+	 * @param	seed		Seed of the random numbers, trial i using seed + i, so that the result does not depend on the threads
+	 * @copydetails stoerWagner
+	 */
+	weightType kargerStein(size_t trials = 0, size_t noOfThreads = 1, unsigned long long seed = 1, std::vector<vertexId>* side = NULL) const
+	{
+		bestCut best = {infinity(), std::vector<bool>()};
+		if (m_graph.n < 2) return finish(best, side);
+		if (0 == trials)
+		{
+			size_t logN = 1;
+			while ((size_t(1) << logN) < m_graph.n) logN++;
+			trials = logN * logN;
+		}
+		noOfThreads = std::max<size_t>(1, std::min(noOfThreads, trials));
+		sharedTrials s = {this, trials, seed, std::vector<bestCut>(noOfThreads, best), std::vector<size_t>(noOfThreads, 0)};
+		forkJoin(noOfThreads, runTrials, &s);
+		for (size_t t = 0; t < noOfThreads; t++)
+		{
+			if (s.best[t].value < best.value) best = s.best[t];
+			stats::edgeVisit(s.visited[t]);
+		}
+		return finish(best, side);
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHMINCUT_HPP_ */
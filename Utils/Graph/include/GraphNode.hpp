@@ -8,6 +8,7 @@
 #ifndef UTILS_GRAPH_INCLUDE_GRAPHNODE_HPP_
 #define UTILS_GRAPH_INCLUDE_GRAPHNODE_HPP_
 
+#include <iterator>
 #include "GraphTraits.hpp"
 
 /**
@@ -27,13 +28,17 @@ class base_vertex
 {
 	nodeProperties internalProperties;	///< Member to store user defined node properties
 public:
+	size_t index;	///< Dense index of this vertex in its #graph, used to key #propertyMap and #csrGraph arrays
+	bool removed;	///< Whether this vertex was removed by #base_graph::removeVertex and is waiting for #base_graph::compact
 	///@brief Default constructor
-	base_vertex(){}
+	base_vertex():index(0),removed(false){}
 	/**
 	 * @brief Single argument constructor
 	 * @param	v	Reference to user defined node properties to be stored in this class
 	 */
-	base_vertex(nodeProperties& v) : internalProperties(v){}
+	base_vertex(nodeProperties& v) : internalProperties(v),index(0),removed(false){}
+	///@brief Member function to provide access to the encapsulated user defined node properties
+	nodeProperties& properties() {return internalProperties;}
 	typedef edge<nodeProperties, edgeProperties, graphType, edgeContainer> edgeType;	///< Type of the edge used in the vertex of graph
 	typedef typename container_gen<edgeContainer,edgeType>::type edgeListContainerType;	///< Type to denote the type of memory taken by edge list
 	typedef typename edgeListContainerType::iterator edgeDescriptor;	///< Descriptor type of edge
@@ -74,8 +79,12 @@ class base_vertex<nodeProperties*,edgeProperties*,graphType,edgeContainer>
 {
 	nodeProperties* internalProperties; 	///<@copybrief base_vertex::internalProperties
 public:
-	base_vertex():internalProperties(NULL){}	///<@copybrief base_vertex::base_vertex
-	base_vertex(nodeProperties *v) : internalProperties(v){}	///<@copybrief base_vertex::base_vertex(nodeProperties& v)
+	size_t index;	///<@copybrief base_vertex::index
+	bool removed;	///<@copybrief base_vertex::removed
+	base_vertex():internalProperties(NULL),index(0),removed(false){}	///<@copybrief base_vertex::base_vertex
+	base_vertex(nodeProperties *v) : internalProperties(v),index(0),removed(false){}	///<@copybrief base_vertex::base_vertex(nodeProperties& v)
+	///@copydoc base_vertex::properties
+	nodeProperties& properties() {return *internalProperties;}
 	typedef edge<nodeProperties*, edgeProperties*, graphType, edgeContainer> edgeType;	///<@copybrief base_vertex::edgeType
 	typedef typename container_gen<edgeContainer,edgeType>::type edgeListContainerType;	///<@copybrief base_vertex::edgeListContainerType
 	typedef typename edgeListContainerType::iterator edgeDescriptor;	///<@copybrief base_vertex::edgeDescriptor
@@ -107,8 +116,12 @@ class base_vertex<nodeProperties*,edgeProperties,graphType,edgeContainer>
 {
 	nodeProperties* internalProperties;	///<@copybrief base_vertex::internalProperties
 public:
-	base_vertex() : internalProperties(NULL){}///<@copybrief base_vertex::base_vertex
-	base_vertex(nodeProperties *v) : internalProperties(v){}	///<@copybrief base_vertex::base_vertex(nodeProperties& v)
+	size_t index;	///<@copybrief base_vertex::index
+	bool removed;	///<@copybrief base_vertex::removed
+	base_vertex() : internalProperties(NULL),index(0),removed(false){}///<@copybrief base_vertex::base_vertex
+	base_vertex(nodeProperties *v) : internalProperties(v),index(0),removed(false){}	///<@copybrief base_vertex::base_vertex(nodeProperties& v)
+	///@copydoc base_vertex::properties
+	nodeProperties& properties() {return *internalProperties;}
 	typedef edge<nodeProperties*, edgeProperties, graphType, edgeContainer> edgeType;	///<@copybrief base_vertex::edgeType
 	typedef typename container_gen<edgeContainer,edgeType>::type edgeListContainerType;	///<@copybrief base_vertex::edgeListContainerType
 	typedef typename edgeListContainerType::iterator edgeDescriptor;	///<@copybrief base_vertex::edgeDescriptor
@@ -140,8 +153,12 @@ class base_vertex<nodeProperties,edgeProperties*,graphType,edgeContainer>
 {
 	nodeProperties internalProperties;	///<@copybrief base_vertex::internalProperties
 public:
-	base_vertex(){}
-	base_vertex(nodeProperties& v) : internalProperties(v){}	///<@copybrief base_vertex::base_vertex(nodeProperties& v)
+	size_t index;	///<@copybrief base_vertex::index
+	bool removed;	///<@copybrief base_vertex::removed
+	base_vertex():index(0),removed(false){}
+	base_vertex(nodeProperties& v) : internalProperties(v),index(0),removed(false){}	///<@copybrief base_vertex::base_vertex(nodeProperties& v)
+	///@copydoc base_vertex::properties
+	nodeProperties& properties() {return internalProperties;}
 	typedef edge<nodeProperties, edgeProperties*, graphType, edgeContainer> edgeType;	///<@copybrief base_vertex::edgeType
 	typedef typename container_gen<edgeContainer,edgeType>::type edgeListContainerType;	///<@copybrief base_vertex::edgeListContainerType
 	typedef typename edgeListContainerType::iterator edgeDescriptor;	///<@copybrief base_vertex::edgeDescriptor
@@ -227,6 +244,32 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+
+	/**
+	 * @brief Member function to remove an outgoing edge of this vertex together with its entry in #adjVertexList
+	 * @param	e	The edge to be removed
+	 * @return The descriptor of the edge following the removed one
+	 */
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+
+	/**
+	 * @brief Member function to remove an incoming edge of this vertex
+	 * @param	e	The edge to be removed
+	 * @return The descriptor of the edge following the removed one
+	 */
+	edgeDescriptor removeInEdge(edgeDescriptor e) {return this->in_edges.erase(e);}
+
+	///@brief Member function to remove all the edges of this vertex
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->in_edges.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -265,6 +308,21 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeInEdge
+	edgeDescriptor removeInEdge(edgeDescriptor e) {return this->in_edges.erase(e);}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->in_edges.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -303,6 +361,21 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeInEdge
+	edgeDescriptor removeInEdge(edgeDescriptor e) {return this->in_edges.erase(e);}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->in_edges.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -341,6 +414,21 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeInEdge
+	edgeDescriptor removeInEdge(edgeDescriptor e) {return this->in_edges.erase(e);}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->in_edges.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -372,6 +460,18 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -403,6 +503,18 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -434,6 +546,18 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->out_edges.clear();
+	}
 };
 
 /**
@@ -465,5 +589,17 @@ public:
 		this->adjVertexList.push_back(e.sink);
 		this->out_edges.push_back(e);
 	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::removeOutEdge
+	edgeDescriptor removeOutEdge(edgeDescriptor e)
+	{
+		this->adjVertexList.erase(this->adjVertexList.begin() + std::distance(this->out_edges.begin(), e));
+		return this->out_edges.erase(e);
+	}
+	///@copydoc vertex<nodeProperties,edgeProperties,graphTraits::directed,edgeContainer>::clearEdges
+	void clearEdges()
+	{
+		this->adjVertexList.clear();
+		this->out_edges.clear();
+	}
 };
 #endif /* UTILS_GRAPH_INCLUDE_GRAPHNODE_HPP_ */
@@ -0,0 +1,362 @@
+/**
+ * @file GraphPageRank.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains PageRank by pull iteration, its Gauss-Seidel variant and personalized PageRank by forward push.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHPAGERANK_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHPAGERANK_HPP_
+
+#include <vector>
+#include <algorithm>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphThreads.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief PageRank of the vertices of a directed graph
+ * @tparam	valueType	Floating point type of the ranks
+ * @tparam	stats		Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The rank is the stationary distribution of a walk which follows a random out edge with probability d, the damping,
+ * and jumps to a random vertex otherwise. A vertex without out edges, a dangling vertex, always jumps, so its rank is spread over
+ * all the vertices. The ranks add up to 1.
+ *
+ * The graph is kept as its #csrGraph and the transpose of it, so that #pageRank pulls the contributions rank(u) / outdegree(u)
+ * of the in neighbors of every vertex. Each iteration reads the contributions of the previous one and writes the ranks and the
+ * next contributions, so the vertices can be shared among threads, in ranges of about the same number of in arcs. The sums along
+ * the in arcs use four partial sums to overlap the loads, and the other loops are branch free so that they vectorize.
+ * #gaussSeidel instead updates the ranks in place, on one thread, which lets every vertex use the ranks already updated in the
+ * same sweep. That only helps along the arcs from lower to higher ids: when most arcs go that way, as after ordering the vertices
+ * by a search from the sources, it needs less than half the sweeps. On an order unrelated to the arcs the error left after the
+ * first sweeps can still decay by only the damping per sweep, and then it needs as many sweeps as #pageRank needs iterations.
+ *
+ * #personalized computes the PageRank in which the walk jumps to a set of seed vertices instead of to any vertex, with the forward
+ * push of Andersen, Chung and Lang. It only touches the vertices close to the seeds, so its cost does not depend on the size of the
+ * graph. The vertices are pushed in first in, first out order, so a vertex gathers the mass of a whole round of its in neighbors
+ * before it is pushed again, which needs several times fewer pushes than pushing the latest one first. It is the faster way to
+ * answer a query when the seeds reach a small part of the graph within the tolerance; on a small graph which mixes fast a few
+ * iterations over the whole of it cost less.
+ */
+template <typename valueType = double, class stats = defaultStatsPolicy>
+class graphPageRank
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<valueType> rankMap;	///< Rank of every vertex
+	typedef std::vector<std::pair<vertexId,valueType> > sparseRanks;	///< Ranks of some vertices
+
+private:
+	csrGraph m_out;	///< Member to hold the out arcs
+	csrGraph m_in;	///< Member to hold the in arcs
+	std::vector<valueType> m_inverseDegree;	///< Member to hold 1 / outdegree of every vertex, 0 for the dangling ones
+	std::vector<valueType> m_isDangling;	///< Member to hold 1 for the dangling vertices and 0 for the others
+	size_t m_iterations;	///< Member to hold the iterations, sweeps or pushes of the last computation
+	valueType m_residual;	///< Member to hold the L1 change of the last iteration, or the residual left by the last push
+	std::vector<valueType> m_estimate;	///< Member to hold the estimates of #personalized
+	std::vector<valueType> m_pushResidual;	///< Member to hold the residuals of #personalized
+	std::vector<size_t> m_seen;	///< Member to hold the query in which the estimate and residual of every vertex were last reset
+	size_t m_query;	///< Member to hold the number of personalized queries run so far
+
+	///@brief Member function to set up the per vertex arrays once the graphs are set
+	void init()
+	{
+		size_t n = m_out.numVertices();
+		m_inverseDegree.assign(n, 0);
+		m_isDangling.assign(n, 0);
+		for (vertexId v = 0; v < n; v++)
+		{
+			if (0 == m_out.degree(v)) m_isDangling[v] = 1;
+			else m_inverseDegree[v] = valueType(1) / valueType(m_out.degree(v));
+		}
+		m_estimate.assign(n, 0);
+		m_pushResidual.assign(n, 0);
+		m_seen.assign(n, 0);
+	}
+
+	///@brief Member function to sum the values at the given indices, with four partial sums to overlap the loads
+	static valueType gatherSum(const valueType* values, const vertexId* index, size_t count)
+	{
+		valueType s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			s0 += values[index[i]];
+			s1 += values[index[i+1]];
+			s2 += values[index[i+2]];
+			s3 += values[index[i+3]];
+		}
+		for (; i < count; i++) s0 += values[index[i]];
+		return (s0 + s1) + (s2 + s3);
+	}
+
+	/**
+	 * @brief State shared by the threads of one iteration of #pageRank
+	 */
+	struct pullState
+	{
+		const graphPageRank* p;	///< Member to hold the graph
+		const valueType* contribution;	///< Member to hold the contributions of the previous iteration
+		valueType* rank;	///< Member to hold the ranks, read as the previous ones and written as the new ones
+		valueType* nextContribution;	///< Member to hold the contributions of the new ranks
+		valueType base;	///< Member to hold the part of every rank coming from the jumps
+		valueType damping;	///< Member to hold the damping
+		std::vector<valueType> change;	///< Member to hold the L1 change of the ranks of every thread
+		std::vector<valueType> dangling;	///< Member to hold the new rank of the dangling vertices of every thread
+		std::vector<vertexId> ranges;	///< Member to hold the first vertex of the range of every thread, and the number of vertices
+	};
+
+	///@brief Member function run by every thread of an iteration of #pageRank over the vertices of its range
+	static void pullRange(pullState* s, size_t thread)
+	{
+		const csrGraph& in = s->p->m_in;
+		const vertexId begin = s->ranges[thread], end = s->ranges[thread+1];
+		valueType change = 0, dangling = 0;
+		for (vertexId v = begin; v < end; v++)
+		{
+			valueType sum = gatherSum(s->contribution, in.targets.empty() ? NULL : &in.targets[0] + in.offsets[v], in.degree(v));
+			valueType r = s->base + s->damping * sum;
+			change += std::abs(r - s->rank[v]);
+			s->rank[v] = r;
+		}
+		for (vertexId v = begin; v < end; v++)
+		{
+			s->nextContribution[v] = s->rank[v] * s->p->m_inverseDegree[v];
+			dangling += s->rank[v] * s->p->m_isDangling[v];
+		}
+		s->change[thread] = change;
+		s->dangling[thread] = dangling;
+	}
+
+	///@brief Member function to split the vertices into ranges of about the same number of vertices plus in arcs
+	std::vector<vertexId> splitRanges(size_t noOfThreads) const
+	{
+		size_t n = m_in.numVertices();
+		size_t total = n + m_in.numSlots();
+		std::vector<vertexId> retVal(1, 0);
+		for (size_t t = 1; t < noOfThreads; t++)
+		{
+			size_t goal = total * t / noOfThreads;
+			vertexId v = retVal.back();
+			while (v < n && v + m_in.offsets[v] < goal) v++;
+			retVal.push_back(v);
+		}
+		retVal.push_back(vertexId(n));
+		return retVal;
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the ranking of a #csrGraph
+	 * @param	g	The graph, whose transpose is built here
+	 */
+	explicit graphPageRank(const csrGraph& g) : m_out(g),m_in(g.transpose()),m_iterations(0),m_residual(0),m_query(0)
+	{
+		init();
+	}
+
+	/**
+	 * @brief Constructor to set up the ranking of a #graph
+	 * @param	g	The graph, whose vertex indices are the ids of the ranks
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	explicit graphPageRank(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g)
+		: m_out(g),m_iterations(0),m_residual(0),m_query(0)
+	{
+		m_in = m_out.transpose();
+		init();
+	}
+
+	///@brief Member function to get the iterations or sweeps of the last ranking, or the pushes of the last personalized query
+	size_t lastIterations() const {return m_iterations;}
+
+	///@brief Member function to get the L1 change of the last iteration or sweep, or the residual left by the last personalized query
+	valueType lastResidual() const {return m_residual;}
+
+	/**
+	 * @brief Member function to compute the ranks by pull iteration
+	 * @param	damping			Probability of following an edge
+	 * @param	tolerance		The iteration stops once the ranks change by less than this in L1 norm
+	 * @param	maxIterations	The iteration stops after this many iterations anyway
+	 * @param	noOfThreads		Number of threads sharing the vertices
+	 * @return The ranks
+	 */
+	rankMap pageRank(valueType damping = 0.85, valueType tolerance = 1e-9, size_t maxIterations = 100, size_t noOfThreads = 1)
+	{
+		size_t n = m_in.numVertices();
+		rankMap retVal(n, n ? valueType(1) / valueType(n) : 0);
+		m_iterations = 0;
+		m_residual = 0;
+		if (0 == n) return retVal;
+		noOfThreads = std::max<size_t>(1, std::min(noOfThreads, n));
+		std::vector<valueType> contribution(n), nextContribution(n);
+		valueType dangling = 0;
+		for (vertexId v = 0; v < n; v++)
+		{
+			contribution[v] = retVal[v] * m_inverseDegree[v];
+			dangling += retVal[v] * m_isDangling[v];
+		}
+		pullState s;
+		s.p = this;
+		s.rank = retVal.data();
+		s.damping = damping;
+		s.change.assign(noOfThreads, 0);
+		s.dangling.assign(noOfThreads, 0);
+		s.ranges = splitRanges(noOfThreads);
+		do
+		{
+			s.contribution = &contribution[0];
+			s.nextContribution = &nextContribution[0];
+			s.base = (1 - damping) / valueType(n) + damping * dangling / valueType(n);
+			forkJoin(noOfThreads, pullRange, &s);
+			stats::edgeVisit(m_in.numSlots());
+			m_residual = 0;
+			dangling = 0;
+			for (size_t t = 0; t < noOfThreads; t++)
+			{
+				m_residual += s.change[t];
+				dangling += s.dangling[t];
+			}
+			contribution.swap(nextContribution);
+			m_iterations++;
+		}
+		while (m_residual >= tolerance && m_iterations < maxIterations);
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to compute the ranks by Gauss-Seidel sweeps, updating the ranks in place
+	 * @details The rank of the dangling vertices is tracked as they are updated, and the ranks are scaled to add up to 1 after every
+	 * sweep, since the sweeps do not keep the sum. The change of a sweep is measured on the scaled ranks, as the drift of the sum
+	 * it removes is not a change of the ranks and would keep the sweeps going long after they have converged.
+	 * @param	damping			Probability of following an edge
+	 * @param	tolerance		The sweeps stop once the scaled ranks change by less than this in L1 norm
+	 * @param	maxIterations	The sweeps stop after this many sweeps anyway
+	 * @return The ranks
+	 */
+	rankMap gaussSeidel(valueType damping = 0.85, valueType tolerance = 1e-9, size_t maxIterations = 100)
+	{
+		size_t n = m_in.numVertices();
+		rankMap retVal(n, n ? valueType(1) / valueType(n) : 0);
+		m_iterations = 0;
+		m_residual = 0;
+		if (0 == n) return retVal;
+		std::vector<valueType> contribution(n);
+		rankMap previous(retVal);
+		valueType dangling = 0;
+		for (vertexId v = 0; v < n; v++)
+		{
+			contribution[v] = retVal[v] * m_inverseDegree[v];
+			dangling += retVal[v] * m_isDangling[v];
+		}
+		do
+		{
+			previous = retVal;
+			for (vertexId v = 0; v < n; v++)
+			{
+				valueType sum = gatherSum(&contribution[0], m_in.targets.empty() ? NULL : &m_in.targets[0] + m_in.offsets[v], m_in.degree(v));
+				valueType r = (1 - damping) / valueType(n) + damping * (dangling / valueType(n) + sum);
+				dangling += (r - retVal[v]) * m_isDangling[v];
+				contribution[v] = r * m_inverseDegree[v];
+				retVal[v] = r;
+			}
+			// The sweep does not keep the sum at 1, and left alone the excess would only decay by the damping every sweep
+			valueType total = 0;
+			for (vertexId v = 0; v < n; v++) total += retVal[v];
+			valueType scale = valueType(1) / total;
+			m_residual = 0;
+			for (vertexId v = 0; v < n; v++)
+			{
+				retVal[v] *= scale;
+				contribution[v] *= scale;
+				m_residual += std::abs(retVal[v] - previous[v]);
+			}
+			dangling *= scale;
+			stats::edgeVisit(m_in.numSlots());
+			m_iterations++;
+		}
+		while (m_residual >= tolerance && m_iterations < maxIterations);
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to compute the PageRank personalized to a set of seeds by forward push
+	 * @details Every seed starts with an equal share of a residual of 1. Pushing a vertex u moves (1 - d) of its residual to its
+	 * estimate and spreads the rest over the residuals of its out neighbors, or of the seeds when u is dangling. Vertices are pushed
+	 * while their residual is at least epsilon times their out degree, so every estimate is below its exact value by at most
+	 * epsilon times the out degree, and the exact values add up to 1. The vertices are pushed in the order their residuals reach
+	 * the threshold.
+	 * @param	seeds	The seeds, which must not be empty
+	 * @param	damping	Probability of following an edge
+	 * @param	epsilon	Residual per out arc below which a vertex is not pushed
+	 * @return The estimates of the vertices with a positive one, from the largest down
+	 */
+	sparseRanks personalized(const std::vector<vertexId>& seeds, valueType damping = 0.85, valueType epsilon = 1e-7)
+	{
+		sparseRanks retVal;
+		m_iterations = 0;
+		m_residual = 0;
+		if (true == seeds.empty()) return retVal;
+		m_query++;
+		std::vector<vertexId> touched, queue;
+		// Resets the vertex the first time a query touches it, and queues it while its residual is over the threshold
+		struct visitor
+		{
+			graphPageRank& p;
+			std::vector<vertexId>& touched;
+			std::vector<vertexId>& queue;
+			valueType epsilon;
+			void add(vertexId v, valueType mass)
+			{
+				if (p.m_query != p.m_seen[v])
+				{
+					p.m_seen[v] = p.m_query;
+					p.m_estimate[v] = 0;
+					p.m_pushResidual[v] = 0;
+					touched.push_back(v);
+				}
+				valueType threshold = epsilon * valueType(std::max<size_t>(1, p.m_out.degree(v)));
+				bool wasBelow = (p.m_pushResidual[v] < threshold);
+				p.m_pushResidual[v] += mass;
+				if (true == wasBelow && p.m_pushResidual[v] >= threshold) queue.push_back(v);
+			}
+		} visit = {*this, touched, queue, epsilon};
+		for (size_t i = 0; i < seeds.size(); i++) visit.add(seeds[i], valueType(1) / valueType(seeds.size()));
+		for (size_t head = 0; head < queue.size(); head++)
+		{
+			vertexId u = queue[head];
+			valueType r = m_pushResidual[u];
+			m_pushResidual[u] = 0;
+			m_estimate[u] += (1 - damping) * r;
+			m_iterations++;
+			stats::edgeVisit(m_out.degree(u));
+			if (0 == m_out.degree(u))
+			{
+				for (size_t i = 0; i < seeds.size(); i++) visit.add(seeds[i], damping * r / valueType(seeds.size()));
+				continue;
+			}
+			valueType share = damping * r * m_inverseDegree[u];
+			for (size_t slot = m_out.offsets[u]; slot < m_out.offsets[u+1]; slot++) visit.add(m_out.targets[slot], share);
+		}
+		for (size_t i = 0; i < touched.size(); i++)
+		{
+			m_residual += m_pushResidual[touched[i]];
+			if (m_estimate[touched[i]] > 0) retVal.push_back(std::make_pair(touched[i], m_estimate[touched[i]]));
+		}
+		std::sort(retVal.begin(), retVal.end(), byRank);
+		return retVal;
+	}
+
+private:
+	///@brief Function to order the ranks from the largest down, and by vertex among equal ranks
+	static bool byRank(const std::pair<vertexId,valueType>& a, const std::pair<vertexId,valueType>& b)
+	{
+		return (a.second != b.second) ? (a.second > b.second) : (a.first < b.first);
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHPAGERANK_HPP_ */
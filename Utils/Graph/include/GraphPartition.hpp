@@ -0,0 +1,738 @@
+/**
+ * @file GraphPartition.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the multilevel k-way partitioning of undirected weighted graphs: heavy edge matching, recursive
+ *  bisection of the coarsest graph, Fiduccia-Mattheyses refinement on the way back up, and the binary save and load of the
+ *  subgraph of every part.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHPARTITION_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHPARTITION_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <random>
+#include <istream>
+#include <ostream>
+#include <stdint.h>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphBinary.hpp"
+#include "IndexedHeap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Balanced k-way partitioning of an undirected weighted graph with a small edge cut
+ * @tparam	weightType	Type of the edge weights, a signed type since gains are kept in it. The weights must not be negative.
+ * @tparam	stats		Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The graph is read as undirected, from a #graphTraits::bidirectional #graph or a symmetric #csrGraph,
+ * and loops are dropped. Every vertex weighs 1 and no part may weigh more than 1 + imbalance times the average, rounded
+ * up. #partition works in three phases, as METIS does.
+ *
+ * Coarsening visits the vertices in random order and matches every unmatched one with the unmatched neighbor it shares the
+ * heaviest edge with, as long as the pair is not heavier than a fraction of a part, and contracts every pair into a vertex of a
+ * coarser graph, summing the weights of the edges which become parallel. It stops at about 20 vertices per part or when a level
+ * shrinks the graph by less than a tenth.
+ *
+ * The coarsest graph is bisected recursively, with the parts split evenly between the two sides. Every bisection grows one side
+ * from a random vertex, always adding the vertex of the other side with the largest gain, the edges it has to the grown side less
+ * those it has to the rest, until the side has its share of the weight, and refines it. The best of a few tries is kept.
+ *
+ * The partition is then carried back to every finer graph and refined there. Refinement first moves vertices out of the parts
+ * which are too heavy, those losing the least cut first, and then runs passes of k-way Fiduccia-Mattheyses: the boundary vertices
+ * sit in an #indexedHeap keyed by the gain of their best move to a part with room for them, the best one is moved and locked, its
+ * neighbors are updated, and moves go on even when they lose until a run of them finds nothing better, when the moves after the
+ * best cut seen are undone. The passes stop once one does not lower the cut.
+ *
+ * #savePart writes the subgraph of a part as raw arrays in the byte order of the machine, with a header giving the sizes of the
+ * types as the saved #contractionHierarchy does: the original ids of its vertices, its own edges in CSR over local ids and the
+ * edges it has to other parts, by local source and original target. #loadPart reads it back into a #shard.
+ */
+template <typename weightType = long long, class stats = defaultStatsPolicy>
+class graphPartition
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<vertexId> partitionMap;	///< Part of every vertex
+
+	/**
+	 * @brief Subgraph of one part, as written by #savePart
+	 */
+	struct shard
+	{
+		size_t part;	///< Member to hold the part
+		size_t parts;	///< Member to hold the number of parts
+		std::vector<vertexId> ids;	///< Member to hold the original id of every local vertex
+		csrGraph g;	///< Member to hold the edges between the vertices of the part, over local ids
+		propertyMap<weightType> weights;	///< Member to hold the weights of g in slot order
+		std::vector<vertexId> cutSources;	///< Member to hold the local source of every edge leaving the part
+		std::vector<vertexId> cutTargets;	///< Member to hold the original target of every edge leaving the part
+		propertyMap<weightType> cutWeights;	///< Member to hold the weight of every edge leaving the part
+	};
+
+private:
+	/**
+	 * @brief Graph of a level, the original one or a coarser one
+	 */
+	struct levelGraph
+	{
+		csrGraph g;	///< Member to hold the adjacency, without loops
+		std::vector<weightType> weight;	///< Member to hold the weight of every slot
+		std::vector<size_t> size;	///< Member to hold the weight of every vertex, the original vertices it stands for
+	};
+
+	levelGraph m_graph;	///< Member to hold the graph
+
+	///@brief Function to get the total weight of the vertices of a level graph
+	static size_t totalSize(const levelGraph& lg)
+	{
+		size_t retVal = 0;
+		for (size_t v = 0; v < lg.size.size(); v++) retVal += lg.size[v];
+		return retVal;
+	}
+
+	/**
+	 * @brief Function to contract a level graph by heavy edge matching
+	 * @param	fine	The level graph
+	 * @param	limit	Heaviest pair that may be matched
+	 * @param	random	Random numbers of the visiting order
+	 * @param	coarser	Set to the vertex of the coarser graph every vertex is contracted into
+	 * @return The coarser graph, its vertices numbered in the order their first end was visited
+	 */
+	static levelGraph coarsen(const levelGraph& fine, size_t limit, std::mt19937_64& random, std::vector<vertexId>& coarser)
+	{
+		size_t n = fine.g.numVertices();
+		std::vector<vertexId> order(n), mate(n, vertexId(-1)), first;
+		for (size_t v = 0; v < n; v++) order[v] = vertexId(v);
+		for (size_t i = n; i > 1; i--) std::swap(order[i-1], order[size_t(random() % i)]);
+		coarser.assign(n, vertexId(-1));
+		for (size_t i = 0; i < n; i++)
+		{
+			vertexId u = order[i], best = u;
+			if (vertexId(-1) != mate[u]) continue;
+			weightType heaviest = -1;
+			stats::edgeVisit(fine.g.degree(u));
+			for (size_t slot = fine.g.offsets[u]; slot < fine.g.offsets[u+1]; slot++)
+			{
+				vertexId v = fine.g.targets[slot];
+				if (vertexId(-1) == mate[v] && fine.weight[slot] > heaviest && fine.size[u] + fine.size[v] <= limit)
+				{
+					heaviest = fine.weight[slot];
+					best = v;
+				}
+			}
+			mate[u] = best;
+			mate[best] = u;
+			coarser[u] = coarser[best] = vertexId(first.size());
+			first.push_back(u);
+		}
+		size_t coarseSize = first.size();
+		levelGraph retVal;
+		retVal.size.assign(coarseSize, 0);
+		retVal.g.offsets.assign(coarseSize + 1, 0);
+		std::vector<size_t> seen(coarseSize, size_t(-1));
+		std::vector<weightType> sum(coarseSize, 0);
+		std::vector<vertexId> touched;
+		for (size_t c = 0; c < coarseSize; c++)
+		{
+			vertexId ends[2] = {first[c], mate[first[c]]};
+			for (size_t e = 0; e < ((ends[1] != ends[0]) ? 2u : 1u); e++)
+			{
+				retVal.size[c] += fine.size[ends[e]];
+				for (size_t slot = fine.g.offsets[ends[e]]; slot < fine.g.offsets[ends[e]+1]; slot++)
+				{
+					vertexId d = coarser[fine.g.targets[slot]];
+					if (d == c) continue;
+					if (c != seen[d])
+					{
+						seen[d] = c;
+						sum[d] = 0;
+						touched.push_back(d);
+					}
+					sum[d] += fine.weight[slot];
+				}
+			}
+			for (size_t i = 0; i < touched.size(); i++)
+			{
+				retVal.g.targets.push_back(touched[i]);
+				retVal.weight.push_back(sum[touched[i]]);
+			}
+			touched.clear();
+			retVal.g.offsets[c+1] = retVal.g.targets.size();
+		}
+		retVal.g.edgeIndex.resize(retVal.g.targets.size());
+		for (size_t slot = 0; slot < retVal.g.edgeIndex.size(); slot++) retVal.g.edgeIndex[slot] = slot;
+		return retVal;
+	}
+
+	/**
+	 * @brief Refinement of a partition of a level graph
+	 * @details The weights of the parts and the weight from a vertex to every part are kept in flat arrays, the latter through a
+	 * sparse accumulator keyed by part. The weight every vertex has to its own part and to the others is kept up to date by the
+	 * moves, and their difference bounds the gain of any move of the vertex from above.
+	 */
+	struct refiner
+	{
+		const levelGraph& lg;	///< Member to hold the level graph
+		std::vector<vertexId>& part;	///< Member to hold the part of every vertex
+		const std::vector<size_t>& maxSize;	///< Member to hold the heaviest every part may be
+		std::vector<size_t> partSize;	///< Member to hold the weight of every part
+		std::vector<weightType> link;	///< Member to hold the weight from the vertex looked at to every part
+		std::vector<vertexId> touched;	///< Member to hold the parts with a weight in link
+		std::vector<bool> seen;	///< Member to hold whether every part is in touched
+		std::vector<weightType> internal;	///< Member to hold the weight from every vertex to its own part
+		std::vector<weightType> external;	///< Member to hold the weight from every vertex to the other parts
+
+		///@brief Constructor to weigh the parts and the vertices
+		refiner(const levelGraph& l, std::vector<vertexId>& p, const std::vector<size_t>& m)
+			: lg(l),part(p),maxSize(m),partSize(m.size(), 0),link(m.size(), 0),seen(m.size(), false),internal(p.size(), 0),external(p.size(), 0)
+		{
+			for (vertexId v = 0; v < part.size(); v++)
+			{
+				partSize[part[v]] += lg.size[v];
+				for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+					((part[lg.g.targets[slot]] == part[v]) ? internal[v] : external[v]) += lg.weight[slot];
+			}
+		}
+
+		///@brief Member function to get the bound on the gain of the moves of v
+		weightType bound(vertexId v) const {return external[v] - internal[v];}
+
+		///@brief Member function to gather the weight from v to every part
+		void gather(vertexId v)
+		{
+			for (size_t i = 0; i < touched.size(); i++)
+			{
+				link[touched[i]] = 0;
+				seen[touched[i]] = false;
+			}
+			touched.clear();
+			stats::edgeVisit(lg.g.degree(v));
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+			{
+				vertexId p = part[lg.g.targets[slot]];
+				if (false == seen[p])
+				{
+					seen[p] = true;
+					touched.push_back(p);
+				}
+				link[p] += lg.weight[slot];
+			}
+		}
+
+		/**
+		 * @brief Member function to find the best move of v to a part it has edges to and which has room for it
+		 * @return The gain and the part, the part of v when there is no such move
+		 */
+		std::pair<weightType,vertexId> bestMove(vertexId v)
+		{
+			gather(v);
+			vertexId from = part[v];
+			std::pair<weightType,vertexId> retVal(0, from);
+			for (size_t i = 0; i < touched.size(); i++)
+			{
+				vertexId p = touched[i];
+				if (p == from || partSize[p] + lg.size[v] > maxSize[p]) continue;
+				weightType gain = link[p] - (seen[from] ? link[from] : 0);
+				if (retVal.second == from || gain > retVal.first || (gain == retVal.first && partSize[p] < partSize[retVal.second]))
+					retVal = std::make_pair(gain, p);
+			}
+			return retVal;
+		}
+
+		///@brief Member function to move v to part p, updating the weights of v and its neighbors
+		void move(vertexId v, vertexId p)
+		{
+			vertexId from = part[v];
+			partSize[from] -= lg.size[v];
+			partSize[p] += lg.size[v];
+			part[v] = p;
+			weightType total = internal[v] + external[v];
+			internal[v] = 0;
+			stats::edgeVisit(lg.g.degree(v));
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+			{
+				vertexId u = lg.g.targets[slot];
+				weightType w = lg.weight[slot];
+				if (part[u] == from)
+				{
+					internal[u] -= w;
+					external[u] += w;
+				}
+				else if (part[u] == p)
+				{
+					internal[u] += w;
+					external[u] -= w;
+					internal[v] += w;
+				}
+			}
+			external[v] = total - internal[v];
+		}
+
+		/**
+		 * @brief Member function to move vertices out of the parts which are too heavy
+		 * @details The vertices of every such part are sorted by the least cut they add going to a part with room, one they have
+		 * edges to if they can, and moved in that order until it is light enough or none fits anywhere.
+		 */
+		void rebalance()
+		{
+			size_t k = maxSize.size();
+			for (vertexId heavy = 0; heavy < k; heavy++)
+			{
+				if (partSize[heavy] <= maxSize[heavy]) continue;
+				std::vector<std::pair<weightType,vertexId> > candidates;
+				for (vertexId v = 0; v < part.size(); v++)
+				{
+					if (heavy != part[v]) continue;
+					gather(v);
+					weightType gain = link[heavy];
+					for (size_t i = 0; i < touched.size(); i++) if (touched[i] != heavy) gain = std::min(gain, link[heavy] - link[touched[i]]);
+					candidates.push_back(std::make_pair(gain, v));
+				}
+				std::sort(candidates.begin(), candidates.end());
+				for (size_t i = 0; i < candidates.size() && partSize[heavy] > maxSize[heavy]; i++)
+				{
+					vertexId v = candidates[i].second;
+					std::pair<weightType,vertexId> best = bestMove(v);
+					if (best.second == heavy)
+					{
+						// No neighboring part has room, so the lightest one with room takes it
+						for (vertexId p = 0; p < k; p++)
+							if (p != heavy && partSize[p] + lg.size[v] <= maxSize[p] && (best.second == heavy || partSize[p] < partSize[best.second]))
+								best.second = p;
+					}
+					if (best.second != heavy) move(v, best.second);
+				}
+			}
+		}
+
+		/**
+		 * @brief Member function to run a pass of Fiduccia-Mattheyses
+		 * @details The heap is keyed by bounds on the gain and updated lazily, as the order of #contractionHierarchy is: the top is
+		 * recomputed and only moved if it stays on top. A vertex enters with the bound of its weights and a move shifts the keys of
+		 * the neighbors by what it can change their gains, without looking at their edges.
+		 * @return How much the pass lowered the cut
+		 */
+		weightType pass()
+		{
+			size_t n = part.size();
+			indexedHeap<weightType,basic_heap_max_traits<weightType>,noStats> heap(n);
+			std::vector<bool> locked(n, false);
+			for (vertexId v = 0; v < n; v++) if (external[v] > 0) heap.insert(v, bound(v));
+			std::vector<std::pair<vertexId,vertexId> > moves;
+			weightType total = 0, bestTotal = 0;
+			size_t bestMoves = 0, patience = std::max<size_t>(50, n / 100);
+			while (false == heap.empty() && moves.size() - bestMoves < patience)
+			{
+				vertexId v = vertexId(heap.top());
+				std::pair<weightType,vertexId> best = bestMove(v);
+				if (best.second == part[v])
+				{
+					heap.extractTop();
+					continue;
+				}
+				if (best.first < heap.topKey())
+				{
+					heap.changeKey(v, best.first);
+					continue;
+				}
+				heap.extractTop();
+				vertexId from = part[v];
+				moves.push_back(std::make_pair(v, from));
+				move(v, best.second);
+				locked[v] = true;
+				total += best.first;
+				if (total > bestTotal)
+				{
+					bestTotal = total;
+					bestMoves = moves.size();
+				}
+				for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+				{
+					vertexId u = lg.g.targets[slot];
+					if (true == locked[u]) continue;
+					if (0 == external[u]) heap.remove(u);
+					else if (false == heap.contains(u)) heap.insert(u, bound(u));
+					else
+					{
+						// Moves of u gain at most 2w more if it is left behind, w less if it was joined and w more otherwise
+						weightType w = lg.weight[slot], shift = (part[u] == from) ? 2 * w : ((part[u] == part[v]) ? -w : w);
+						heap.changeKey(u, std::min(bound(u), heap.key(u) + shift));
+					}
+				}
+			}
+			while (moves.size() > bestMoves)
+			{
+				move(moves.back().first, moves.back().second);
+				moves.pop_back();
+			}
+			return bestTotal;
+		}
+	};
+
+	///@brief Function to balance and refine a partition of a level graph
+	static void refine(const levelGraph& lg, std::vector<vertexId>& part, const std::vector<size_t>& maxSize)
+	{
+		refiner r(lg, part, maxSize);
+		r.rebalance();
+		for (size_t i = 0; i < maxPasses() && r.pass() > 0; i++);
+	}
+
+	///@brief Function to get the most passes of Fiduccia-Mattheyses per level
+	static size_t maxPasses() {return 8;}
+
+	/**
+	 * @brief Function to bisect a level graph by greedy growing from a random vertex
+	 * @param	lg		The level graph
+	 * @param	share	Weight the side grown, side 0, should get
+	 * @param	random	Random numbers of the first vertex
+	 * @param	side	Set to the side of every vertex
+	 */
+	static void grow(const levelGraph& lg, size_t share, std::mt19937_64& random, std::vector<vertexId>& side)
+	{
+		size_t n = lg.g.numVertices(), grown = 0;
+		side.assign(n, 1);
+		indexedHeap<weightType,basic_heap_max_traits<weightType>,noStats> frontier(n);
+		std::vector<weightType> gain(n, 0);
+		for (vertexId v = 0; v < n; v++)
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++) gain[v] -= lg.weight[slot];
+		while (grown < share)
+		{
+			vertexId v;
+			if (true == frontier.empty())
+			{
+				// A new component starts from a random vertex still on the other side
+				std::vector<vertexId> rest;
+				for (vertexId u = 0; u < n; u++) if (1 == side[u]) rest.push_back(u);
+				if (true == rest.empty()) break;
+				v = rest[size_t(random() % rest.size())];
+			}
+			else v = vertexId(frontier.extractTop());
+			// Stop short rather than overshoot by more
+			if (grown > 0 && grown + lg.size[v] > share && grown + lg.size[v] - share > share - grown) break;
+			side[v] = 0;
+			grown += lg.size[v];
+			stats::edgeVisit(lg.g.degree(v));
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+			{
+				vertexId u = lg.g.targets[slot];
+				if (0 == side[u]) continue;
+				gain[u] += 2 * lg.weight[slot];
+				frontier.push(u, gain[u]);
+			}
+		}
+	}
+
+	/**
+	 * @brief Function to partition a level graph into parts first..first+k-1 by recursive bisection
+	 * @param	lg		The level graph
+	 * @param	k		Number of parts
+	 * @param	first	First part
+	 * @param	slack	Largest part over the average part, e.g. 1.03
+	 * @param	random	Random numbers
+	 * @param	part	Set to the part of every vertex
+	 */
+	static void bisect(const levelGraph& lg, size_t k, vertexId first, double slack, std::mt19937_64& random, std::vector<vertexId>& part)
+	{
+		size_t n = lg.g.numVertices();
+		part.assign(n, first);
+		if (k < 2 || 0 == n) return;
+		size_t total = totalSize(lg), half = k / 2, share = (total * half + k / 2) / k;
+		std::vector<size_t> maxSize(2);
+		maxSize[0] = std::max<size_t>(share + 1, size_t(slack * double(share)));
+		maxSize[1] = std::max<size_t>(total - share + 1, size_t(slack * double(total - share)));
+		std::vector<vertexId> side, best;
+		weightType bestCut = std::numeric_limits<weightType>::max();
+		for (size_t t = 0; t < tries(); t++)
+		{
+			grow(lg, share, random, side);
+			refine(lg, side, maxSize);
+			weightType c = cut(lg, side);
+			if (c < bestCut)
+			{
+				bestCut = c;
+				best = side;
+			}
+		}
+		// Every side is partitioned on its own, over local ids
+		for (vertexId s = 0; s < 2; s++)
+		{
+			levelGraph sub;
+			std::vector<vertexId> local(n, vertexId(-1)), ids;
+			for (vertexId v = 0; v < n; v++)
+				if (s == best[v])
+				{
+					local[v] = vertexId(ids.size());
+					ids.push_back(v);
+					sub.size.push_back(lg.size[v]);
+				}
+			sub.g.offsets.assign(ids.size() + 1, 0);
+			for (size_t i = 0; i < ids.size(); i++)
+			{
+				for (size_t slot = lg.g.offsets[ids[i]]; slot < lg.g.offsets[ids[i]+1]; slot++)
+					if (vertexId(-1) != local[lg.g.targets[slot]])
+					{
+						sub.g.targets.push_back(local[lg.g.targets[slot]]);
+						sub.g.edgeIndex.push_back(sub.g.edgeIndex.size());
+						sub.weight.push_back(lg.weight[slot]);
+					}
+				sub.g.offsets[i+1] = sub.g.targets.size();
+			}
+			std::vector<vertexId> subPart;
+			bisect(sub, (0 == s) ? half : k - half, (0 == s) ? first : vertexId(first + half), slack, random, subPart);
+			for (size_t i = 0; i < ids.size(); i++) part[ids[i]] = subPart[i];
+		}
+	}
+
+	///@brief Function to get the most coarser graphs
+	static size_t maxLevels() {return 64;}
+
+	///@brief Function to get the number of tries of every bisection
+	static size_t tries() {return 4;}
+
+	///@brief Function to get the weight of the edges of a level graph between different parts
+	static weightType cut(const levelGraph& lg, const std::vector<vertexId>& part)
+	{
+		weightType retVal = 0;
+		for (vertexId v = 0; v < lg.g.numVertices(); v++)
+			for (size_t slot = lg.g.offsets[v]; slot < lg.g.offsets[v+1]; slot++)
+				if (part[lg.g.targets[slot]] != part[v]) retVal += lg.weight[slot];
+		return retVal / 2;
+	}
+
+	///@brief Magic number at the start of a saved part
+	static uint64_t magic() {return 0x3130545250474c41ULL;}
+
+	///@brief Member function to build the graph of a symmetric #csrGraph
+	template <typename valueType>
+	void init(const csrGraph& g, const propertyMap<valueType>& w)
+	{
+		size_t n = g.numVertices();
+		m_graph.size.assign(n, 1);
+		m_graph.g.offsets.assign(n + 1, 0);
+		for (vertexId u = 0; u < n; u++)
+		{
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				if (g.targets[slot] != u)
+				{
+					m_graph.g.targets.push_back(g.targets[slot]);
+					m_graph.g.edgeIndex.push_back(m_graph.g.edgeIndex.size());
+					m_graph.weight.push_back(weightType(w[slot]));
+				}
+			m_graph.g.offsets[u+1] = m_graph.g.targets.size();
+		}
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the partitioning of a #csrGraph
+	 * @param	g	The graph, a symmetric #csrGraph
+	 * @param	w	The weights in slot order, e.g. from #csrGraph::slotProperty, of any type converting to weightType
+	 */
+	template <typename valueType>
+	graphPartition(const csrGraph& g, const propertyMap<valueType>& w)
+	{
+		init(g, w);
+	}
+
+	/**
+	 * @brief Constructor to set up the partitioning of a #csrGraph with every edge weighing 1
+	 * @param	g	The graph, a symmetric #csrGraph
+	 */
+	explicit graphPartition(const csrGraph& g)
+	{
+		init(g, propertyMap<weightType>(g.numSlots(), 1));
+	}
+
+	/**
+	 * @brief Constructor to set up the partitioning of a #graph
+	 * @param	g	The graph, a #graphTraits::bidirectional one, whose vertex indices are the ids of the partition
+	 * @param	w	The weights keyed by #edge::index, of any type converting to weightType
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer, typename valueType>
+	graphPartition(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<valueType>& w)
+	{
+		csrGraph csr(g);
+		init(csr, csr.slotProperty(w));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_graph.g.numVertices();}
+
+	///@brief Member function to get the number of edges, loops left out
+	size_t numEdges() const {return m_graph.g.numSlots() / 2;}
+
+	/**
+	 * @brief Member function to get the heaviest a part may be
+	 * @param	k			Number of parts
+	 * @param	imbalance	Largest excess of a part over the average, e.g. 0.03 for 3%
+	 */
+	size_t maxPartSize(size_t k, double imbalance) const
+	{
+		size_t average = (numVertices() + k - 1) / k;
+		return std::max<size_t>(average, size_t((1 + imbalance) * double(average)));
+	}
+
+	/**
+	 * @brief Member function to partition the graph
+	 * @param	k			Number of parts
+	 * @param	imbalance	Largest excess of a part over the average, e.g. 0.03 for 3%, see #maxPartSize
+	 * @param	seed		Seed of the random numbers, the same seed giving the same partition
+	 * @param	levels		Set to the number of graphs, the original one included, if not NULL
+	 * @return The part of every vertex, in 0..k-1, an empty map when k is 0
+	 */
+	partitionMap partition(size_t k, double imbalance = 0.03, unsigned long long seed = 1, size_t* levels = NULL) const
+	{
+		size_t n = numVertices();
+		if (NULL != levels) *levels = 1;
+		if (0 == k) return partitionMap();
+		partitionMap retVal(n, 0);
+		if (1 == k || 0 == n) return retVal;
+		std::mt19937_64 random(seed);
+		std::vector<size_t> maxSize(k, maxPartSize(k, imbalance));
+		// Pairs may weigh a quarter of a part, so that the coarsest graph still splits evenly
+		size_t limit = std::max<size_t>(2, (n + k - 1) / k / 4), target = std::max<size_t>(20 * k, 64);
+		std::vector<levelGraph> coarse;
+		std::vector<std::vector<vertexId> > maps;
+		coarse.reserve(maxLevels());
+		const levelGraph* lg = &m_graph;
+		while (lg->g.numVertices() > target && coarse.size() < maxLevels())
+		{
+			std::vector<vertexId> map;
+			levelGraph next = coarsen(*lg, limit, random, map);
+			if (next.g.numVertices() * 10 > lg->g.numVertices() * 9) break;
+			coarse.push_back(std::move(next));
+			maps.push_back(std::move(map));
+			lg = &coarse.back();
+		}
+		if (NULL != levels) *levels = coarse.size() + 1;
+		std::vector<vertexId> part;
+		bisect(*lg, k, 0, 1 + imbalance, random, part);
+		refine(*lg, part, maxSize);
+		for (size_t d = coarse.size(); d > 0; d--)
+		{
+			const levelGraph& finer = (1 == d) ? m_graph : coarse[d-2];
+			std::vector<vertexId> projected(finer.g.numVertices());
+			for (size_t v = 0; v < projected.size(); v++) projected[v] = part[maps[d-1][v]];
+			part.swap(projected);
+			refine(finer, part, maxSize);
+		}
+		for (size_t v = 0; v < n; v++) retVal[v] = part[v];
+		return retVal;
+	}
+
+	///@brief Member function to get the weight of the edges between different parts
+	weightType edgeCut(const partitionMap& part) const
+	{
+		std::vector<vertexId> p(part.data(), part.data() + part.size());
+		return cut(m_graph, p);
+	}
+
+	///@brief Member function to get the number of vertices of every part 0..k-1
+	std::vector<size_t> partSizes(const partitionMap& part, size_t k) const
+	{
+		std::vector<size_t> retVal(k, 0);
+		for (size_t v = 0; v < part.size(); v++) retVal[part[v]]++;
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to write the subgraph of a part to a binary stream
+	 * @param	os		The stream
+	 * @param	part	The partition
+	 * @param	k		Number of parts
+	 * @param	which	The part to write
+	 * @return false if the stream failed
+	 */
+	bool savePart(std::ostream& os, const partitionMap& part, size_t k, size_t which) const
+	{
+		const csrGraph& g = m_graph.g;
+		std::vector<vertexId> ids, local(g.numVertices(), vertexId(-1)), targets, cutSources, cutTargets;
+		std::vector<size_t> offsets(1, 0);
+		std::vector<weightType> weights, cutWeights;
+		for (vertexId v = 0; v < g.numVertices(); v++)
+			if (which == part[v])
+			{
+				local[v] = vertexId(ids.size());
+				ids.push_back(v);
+			}
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			for (size_t slot = g.offsets[ids[i]]; slot < g.offsets[ids[i]+1]; slot++)
+			{
+				vertexId u = g.targets[slot];
+				if (vertexId(-1) != local[u])
+				{
+					targets.push_back(local[u]);
+					weights.push_back(m_graph.weight[slot]);
+				}
+				else
+				{
+					cutSources.push_back(vertexId(i));
+					cutTargets.push_back(u);
+					cutWeights.push_back(m_graph.weight[slot]);
+				}
+			}
+			offsets.push_back(targets.size());
+		}
+		uint64_t header[5] = {magic(), sizeof(vertexId), sizeof(weightType), which, k};
+		os.write(reinterpret_cast<const char*>(header), sizeof(header));
+		binaryArrays::write(os, ids);
+		binaryArrays::write(os, offsets);
+		binaryArrays::write(os, targets);
+		binaryArrays::write(os, weights);
+		binaryArrays::write(os, cutSources);
+		binaryArrays::write(os, cutTargets);
+		binaryArrays::write(os, cutWeights);
+		return bool(os);
+	}
+
+	/**
+	 * @brief Function to read the subgraph of a part written by #savePart
+	 * @details The sizes of the types must match those of the writer and the arrays must be well formed, i.e. offsets growing,
+	 * local targets and sources in range and all the edge arrays as long as each other. The arrays are read with
+	 * #binaryArrays::read.
+	 * @return false if the stream failed or did not hold a part, which then leaves s empty
+	 */
+	static bool loadPart(std::istream& is, shard& s)
+	{
+		s = shard();
+		shard loaded;
+		uint64_t header[5];
+		if (false == bool(is.read(reinterpret_cast<char*>(header), sizeof(header)))) return false;
+		if (magic() != header[0] || sizeof(vertexId) != header[1] || sizeof(weightType) != header[2] || header[3] >= header[4]) return false;
+		if (false == binaryArrays::read(is, loaded.ids, std::numeric_limits<vertexId>::max())) return false;
+		size_t n = loaded.ids.size();
+		csrGraph& g = loaded.g;
+		if (false == binaryArrays::read(is, g.offsets, n + 1) || n + 1 != g.offsets.size() || 0 != g.offsets[0]) return false;
+		for (size_t v = 0; v < n; v++) if (g.offsets[v] > g.offsets[v+1]) return false;
+		uint64_t maxSlots = g.offsets.back();
+		std::vector<weightType> weights, cutWeights;
+		if (false == binaryArrays::read(is, g.targets, maxSlots) || g.targets.size() != maxSlots) return false;
+		if (false == binaryArrays::read(is, weights, maxSlots) || weights.size() != maxSlots) return false;
+		for (size_t slot = 0; slot < g.targets.size(); slot++) if (g.targets[slot] >= n) return false;
+		if (false == binaryArrays::read(is, loaded.cutSources, std::numeric_limits<uint64_t>::max())) return false;
+		size_t cuts = loaded.cutSources.size();
+		if (false == binaryArrays::read(is, loaded.cutTargets, cuts) || cuts != loaded.cutTargets.size()) return false;
+		if (false == binaryArrays::read(is, cutWeights, cuts) || cuts != cutWeights.size()) return false;
+		for (size_t i = 0; i < cuts; i++) if (loaded.cutSources[i] >= n) return false;
+		g.edgeIndex.resize(g.targets.size());
+		for (size_t slot = 0; slot < g.edgeIndex.size(); slot++) g.edgeIndex[slot] = slot;
+		loaded.weights = propertyMap<weightType>(weights.size());
+		for (size_t slot = 0; slot < weights.size(); slot++) loaded.weights[slot] = weights[slot];
+		loaded.cutWeights = propertyMap<weightType>(cuts);
+		for (size_t i = 0; i < cuts; i++) loaded.cutWeights[i] = cutWeights[i];
+		loaded.part = size_t(header[3]);
+		loaded.parts = size_t(header[4]);
+		s = loaded;
+		return true;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHPARTITION_HPP_ */
@@ -0,0 +1,403 @@
+/**
+ * @file GraphPointToPoint.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the point to point shortest path queries: Dijkstra stopping at the target, bidirectional Dijkstra,
+ *  A* with a user heuristic and A* with landmark bounds (ALT).
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHPOINTTOPOINT_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHPOINTTOPOINT_HPP_
+
+#include <vector>
+#include <algorithm>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphShortestPath.hpp"
+#include "heap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Point to point shortest path queries over a fixed graph with non-negative weights
+ * @tparam	weightType		Type of the edge weights, which must not be negative
+ * @tparam	distanceType	Type of the path lengths, wide enough for the longest path
+ * @tparam	stats			Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The graph is copied together with its transpose, which the backward searches walk. All the queries share per vertex
+ * arrays which are reset by a query counter instead of being cleared, so a query costs only the vertices it touches. The queries
+ * return #unreachable when there is no path, and #lastSettled tells how many vertices the last one settled.
+ *
+ * ALT needs landmarks, picked once by #selectLandmarks. The distances from and to every landmark bound d(v,t) from below by the
+ * triangle inequality, max over L of d(L,t) - d(L,v) and d(v,L) - d(t,L), which is a consistent A* heuristic.
+ */
+template <typename weightType = int, typename distanceType = long long, class stats = defaultStatsPolicy>
+class graphPointToPoint
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef graphShortestPath<weightType,distanceType,noStats> shortestPath;	///< Single source searches used for the landmarks
+
+	///@brief Ways of picking the landmarks
+	enum landmarkSelection
+	{
+		farthest,	///< Every landmark is the vertex farthest from the ones picked before
+		avoid		///< Goldberg and Harrelson's avoid: the landmark ends a subtree of a shortest path tree whose distances are bounded worst
+	};
+
+	///@brief Member function to get the distance of the vertices which are not reachable
+	static distanceType unreachable() {return shortestPath::unreachable();}
+
+private:
+	///@brief Vertex in the queue of a search, keyed by its tentative distance plus the heuristic
+	struct queuedVertex
+	{
+		distanceType key;	///< Member to hold the key
+		distanceType dist;	///< Member to hold the tentative distance, stale once it differs from the one of the search
+		vertexId v;	///< Member to hold the vertex
+		///@brief Member function to get the key required by heap.
+		static distanceType getKey(queuedVertex& a) {return a.key;}
+	};
+	typedef heap<queuedVertex,basic_heap_min_traits<queuedVertex>,noStats> queueType;	///< Type of the queue of a search
+
+	///@brief Heuristic which is zero everywhere, giving plain Dijkstra
+	struct zeroHeuristic
+	{
+		distanceType operator() (vertexId) const {return 0;}	///< Returns 0
+	};
+
+	///@brief Heuristic of ALT towards a fixed target
+	struct landmarkHeuristic
+	{
+		const graphPointToPoint& p;	///< Member to hold the query object with the landmark tables
+		vertexId t;	///< Member to hold the target
+		///@brief Member function to get the lower bound of the distance from v to t
+		distanceType operator() (vertexId v) const {return p.lowerBound(v, t);}
+	};
+
+	csrGraph m_graph;	///< Member to hold the graph
+	propertyMap<weightType> m_weights;	///< Member to hold the weights in slot order
+	csrGraph m_reverse;	///< Member to hold the transpose of the graph
+	propertyMap<weightType> m_reverseWeights;	///< Member to hold the weights in slot order of the transpose
+	std::vector<distanceType> m_dist[2];	///< Member to hold the tentative distances of the forward and backward searches
+	std::vector<size_t> m_seen[2];	///< Member to hold the query in which every distance was last set
+	size_t m_query;	///< Member to hold the number of queries run so far
+	size_t m_settled;	///< Member to hold the number of vertices settled by the last query
+	std::vector<vertexId> m_landmarks;	///< Member to hold the landmarks
+	std::vector<distanceType> m_landmarkDist;	///< Member to hold per vertex the distances from and to every landmark, side by side
+
+	///@brief Member function to build the transpose and the other per vertex arrays once the graph and weights are set
+	void init()
+	{
+		m_reverse = m_graph.transpose();
+		size_t noOfEdges = 0;
+		for (size_t slot = 0; slot < m_graph.numSlots(); slot++) noOfEdges = std::max(noOfEdges, m_graph.edgeIndex[slot] + 1);
+		propertyMap<weightType> byEdge(noOfEdges);
+		for (size_t slot = 0; slot < m_graph.numSlots(); slot++) byEdge[m_graph.edgeIndex[slot]] = m_weights[slot];
+		m_reverseWeights = m_reverse.slotProperty(byEdge);
+		for (size_t d = 0; d < 2; d++)
+		{
+			m_dist[d].assign(m_graph.numVertices(), unreachable());
+			m_seen[d].assign(m_graph.numVertices(), 0);
+		}
+	}
+
+	///@brief Member function to get the tentative distance of v in the search of the given direction, 0 forward and 1 backward
+	distanceType dist(size_t direction, vertexId v) const {return (m_query == m_seen[direction][v]) ? m_dist[direction][v] : unreachable();}
+
+	///@brief Member function to set the tentative distance of v in the search of the given direction
+	void setDist(size_t direction, vertexId v, distanceType d)
+	{
+		m_seen[direction][v] = m_query;
+		m_dist[direction][v] = d;
+	}
+
+	///@brief Member function to get the lower bound of the distance from v to t given by the landmarks
+	distanceType lowerBound(vertexId v, vertexId t) const
+	{
+		distanceType retVal = 0;
+		if (true == m_landmarks.empty()) return retVal;
+		const distanceType* dv = &m_landmarkDist[0] + 2 * m_landmarks.size() * v;
+		const distanceType* dt = &m_landmarkDist[0] + 2 * m_landmarks.size() * t;
+		for (size_t l = 0; l < 2 * m_landmarks.size(); l += 2)
+		{
+			if (unreachable() != dt[l] && unreachable() != dv[l] && dt[l] > dv[l]) retVal = std::max(retVal, dt[l] - dv[l]);
+			if (unreachable() != dv[l+1] && unreachable() != dt[l+1] && dv[l+1] > dt[l+1]) retVal = std::max(retVal, dv[l+1] - dt[l+1]);
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to run A* from s to t with the given heuristic, Dijkstra for #zeroHeuristic
+	 * @details The heuristic is evaluated once per reached vertex and kept in the arrays of the backward search, which a one
+	 * directional search does not use.
+	 */
+	template <class heuristicType>
+	distanceType search(vertexId s, vertexId t, const heuristicType& h)
+	{
+		m_query++;
+		m_settled = 0;
+		queueType queue;
+		setDist(0, s, 0);
+		setDist(1, s, h(s));
+		queuedVertex first = {dist(1, s), 0, s};
+		queue.insert(first);
+		while (0 != queue.getSize())
+		{
+			queuedVertex top = queue.extractTop();
+			if (top.dist != dist(0, top.v)) continue;
+			m_settled++;
+			if (top.v == t) return top.dist;
+			stats::edgeVisit(m_graph.degree(top.v));
+			for (size_t slot = m_graph.offsets[top.v]; slot < m_graph.offsets[top.v+1]; slot++)
+			{
+				vertexId v = m_graph.targets[slot];
+				distanceType dv = top.dist + m_weights[slot];
+				distanceType old = dist(0, v);
+				if (dv >= old) continue;
+				if (unreachable() == old) setDist(1, v, h(v));
+				setDist(0, v, dv);
+				queuedVertex next = {dv + dist(1, v), dv, v};
+				queue.insert(next);
+			}
+		}
+		return unreachable();
+	}
+
+	///@brief Member function to get the distances from a vertex and the order and tree in which a Dijkstra settled them
+	void shortestPathTree(vertexId root, std::vector<distanceType>& d, std::vector<vertexId>& parent, std::vector<vertexId>& order) const
+	{
+		d.assign(m_graph.numVertices(), unreachable());
+		parent.assign(m_graph.numVertices(), root);
+		order.clear();
+		queueType queue;
+		d[root] = 0;
+		queuedVertex first = {0, 0, root};
+		queue.insert(first);
+		while (0 != queue.getSize())
+		{
+			queuedVertex top = queue.extractTop();
+			if (top.key != d[top.v]) continue;
+			order.push_back(top.v);
+			for (size_t slot = m_graph.offsets[top.v]; slot < m_graph.offsets[top.v+1]; slot++)
+			{
+				queuedVertex next = {top.key + m_weights[slot], top.key + m_weights[slot], m_graph.targets[slot]};
+				if (next.key >= d[next.v]) continue;
+				d[next.v] = next.key;
+				parent[next.v] = top.v;
+				queue.insert(next);
+			}
+		}
+	}
+
+	///@brief Member function to add a landmark and widen the distance table with its distances
+	void addLandmark(vertexId l)
+	{
+		typename shortestPath::distanceMap from = shortestPath::dijkstra(m_graph, m_weights, l);
+		typename shortestPath::distanceMap to = shortestPath::dijkstra(m_reverse, m_reverseWeights, l);
+		size_t k = m_landmarks.size();
+		std::vector<distanceType> table(2 * (k + 1) * m_graph.numVertices());
+		for (size_t v = 0; v < m_graph.numVertices(); v++)
+		{
+			std::copy(m_landmarkDist.begin() + 2 * k * v, m_landmarkDist.begin() + 2 * k * (v + 1), table.begin() + 2 * (k + 1) * v);
+			table[2 * (k + 1) * v + 2 * k] = from[v];
+			table[2 * (k + 1) * v + 2 * k + 1] = to[v];
+		}
+		m_landmarkDist.swap(table);
+		m_landmarks.push_back(l);
+	}
+
+	///@brief Member function to drop the landmarks and their distance table
+	void clearLandmarks()
+	{
+		m_landmarks.clear();
+		m_landmarkDist.clear();
+	}
+
+	///@brief Member function to get the vertex farthest from all the landmarks, by the smallest distance to or from any of them
+	vertexId farthestFromLandmarks() const
+	{
+		vertexId retVal = 0;
+		distanceType best = -1;
+		for (vertexId v = 0; v < m_graph.numVertices(); v++)
+		{
+			distanceType nearest = unreachable();
+			bool isLandmark = false;
+			for (size_t l = 0; l < m_landmarks.size(); l++) isLandmark = isLandmark || (v == m_landmarks[l]);
+			for (size_t l = 0; l < 2 * m_landmarks.size(); l++)
+			{
+				distanceType d = m_landmarkDist[2 * m_landmarks.size() * v + l];
+				if (unreachable() != d) nearest = std::min(nearest, d);
+			}
+			// Vertices no landmark reaches have no bounds at all, but are left out to stay in the component of the landmarks
+			if (true == isLandmark || unreachable() == nearest) continue;
+			if (nearest > best)
+			{
+				best = nearest;
+				retVal = v;
+			}
+		}
+		return retVal;
+	}
+
+	///@brief Member function to pick the next landmark by avoid, growing a shortest path tree from root
+	vertexId avoidLandmark(vertexId root) const
+	{
+		std::vector<distanceType> d;
+		std::vector<vertexId> parent, order;
+		shortestPathTree(root, d, parent, order);
+		// The weight of v is how much the bounds underestimate d(root,v), the size of a subtree the sum of its weights, or zero
+		// once the subtree holds a landmark
+		std::vector<distanceType> size(m_graph.numVertices(), 0);
+		std::vector<bool> hasLandmark(m_graph.numVertices(), false);
+		for (size_t l = 0; l < m_landmarks.size(); l++) hasLandmark[m_landmarks[l]] = true;
+		for (size_t i = order.size(); i-- > 1; )
+		{
+			vertexId v = order[i];
+			if (true == hasLandmark[v]) size[v] = 0;
+			else size[v] += d[v] - lowerBound(root, v);
+			vertexId p = parent[v];
+			if (true == hasLandmark[v]) hasLandmark[p] = true;
+			else size[p] += size[v];
+		}
+		std::vector<size_t> childBegin(m_graph.numVertices() + 1, 0);
+		std::vector<vertexId> children(order.size());
+		for (size_t i = 1; i < order.size(); i++) childBegin[parent[order[i]] + 1]++;
+		for (size_t v = 0; v < m_graph.numVertices(); v++) childBegin[v+1] += childBegin[v];
+		std::vector<size_t> next(childBegin.begin(), childBegin.end() - 1);
+		for (size_t i = 1; i < order.size(); i++) children[next[parent[order[i]]]++] = order[i];
+		vertexId retVal = root;
+		for (;;)
+		{
+			vertexId best = retVal;
+			for (size_t c = childBegin[retVal]; c < childBegin[retVal+1]; c++)
+				if (false == hasLandmark[children[c]] && size[children[c]] > 0 && (best == retVal || size[children[c]] > size[best])) best = children[c];
+			if (best == retVal) return retVal;
+			retVal = best;
+		}
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the queries over a #csrGraph
+	 * @param	g	The graph
+	 * @param	w	The weights in slot order
+	 */
+	graphPointToPoint(const csrGraph& g, const propertyMap<weightType>& w) : m_graph(g),m_weights(w),m_query(0),m_settled(0)
+	{
+		init();
+	}
+
+	/**
+	 * @brief Constructor to set up the queries over a #graph
+	 * @param	g	The graph, whose vertex indices are the ids used by the queries
+	 * @param	w	The weights keyed by #edge::index
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	graphPointToPoint(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g, const propertyMap<weightType>& w)
+		: m_graph(g),m_query(0),m_settled(0)
+	{
+		m_weights = m_graph.slotProperty(w);
+		init();
+	}
+
+	///@brief Member function to get the number of vertices settled by the last query
+	size_t lastSettled() const {return m_settled;}
+
+	///@brief Member function to get the landmarks
+	const std::vector<vertexId>& landmarks() const {return m_landmarks;}
+
+	///@brief Member function to get the shortest distance from s to t with Dijkstra stopping at t
+	distanceType dijkstra(vertexId s, vertexId t) {return search(s, t, zeroHeuristic());}
+
+	/**
+	 * @brief Member function to get the shortest distance from s to t with A*
+	 * @param	s	The source
+	 * @param	t	The target
+	 * @param	h	Callable giving for a vertex a lower bound of its distance to t. With a consistent bound every vertex is settled
+	 * at most once, with one which is only a lower bound vertices may be settled again but the result stays exact.
+	 */
+	template <class heuristicType>
+	distanceType aStar(vertexId s, vertexId t, heuristicType h) {return search(s, t, h);}
+
+	/**
+	 * @brief Member function to get the shortest distance from s to t with bidirectional Dijkstra
+	 * @details The side whose queue has the smaller top is advanced. The best path seen so far is final once the two tops add up
+	 * to at least its length.
+	 */
+	distanceType bidirectional(vertexId s, vertexId t)
+	{
+		m_query++;
+		m_settled = 0;
+		queueType queues[2];
+		const csrGraph* graphs[2] = {&m_graph, &m_reverse};
+		const propertyMap<weightType>* weights[2] = {&m_weights, &m_reverseWeights};
+		setDist(0, s, 0);
+		setDist(1, t, 0);
+		queuedVertex first[2] = {{0, 0, s}, {0, 0, t}};
+		queues[0].insert(first[0]);
+		queues[1].insert(first[1]);
+		distanceType retVal = (s == t) ? 0 : unreachable();
+		while (0 != queues[0].getSize() && 0 != queues[1].getSize())
+		{
+			if (unreachable() != retVal && queues[0].top().key + queues[1].top().key >= retVal) break;
+			size_t d = (queues[0].top().key <= queues[1].top().key) ? 0 : 1;
+			queuedVertex top = queues[d].extractTop();
+			if (top.key != dist(d, top.v)) continue;
+			m_settled++;
+			const csrGraph& g = *graphs[d];
+			const propertyMap<weightType>& w = *weights[d];
+			stats::edgeVisit(g.degree(top.v));
+			for (size_t slot = g.offsets[top.v]; slot < g.offsets[top.v+1]; slot++)
+			{
+				vertexId v = g.targets[slot];
+				distanceType dv = top.key + w[slot];
+				if (dv < dist(d, v))
+				{
+					setDist(d, v, dv);
+					queuedVertex next = {dv, dv, v};
+					queues[d].insert(next);
+				}
+				distanceType other = dist(1 - d, v);
+				if (unreachable() != other && dist(d, v) + other < retVal) retVal = dist(d, v) + other;
+			}
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to pick the landmarks of ALT and compute their distance tables
+	 * @details Both ways start from the vertex farthest from vertex 0. farthest then keeps adding the vertex farthest from all
+	 * the landmarks so far. avoid grows a shortest path tree from a vertex far from the landmarks and walks down the subtree
+	 * where the current bounds are worst and which holds no landmark, taking the leaf it reaches. Each landmark costs two
+	 * Dijkstra runs for its tables, plus one for avoid.
+	 * @param	k		Number of landmarks, replacing any picked before
+	 * @param	method	#farthest or #avoid
+	 */
+	void selectLandmarks(size_t k, landmarkSelection method = avoid)
+	{
+		clearLandmarks();
+		if (0 == m_graph.numVertices() || 0 == k) return;
+		addLandmark(0);
+		vertexId first = farthestFromLandmarks();
+		clearLandmarks();
+		addLandmark(first);
+		while (m_landmarks.size() < std::min(k, m_graph.numVertices()))
+		{
+			vertexId next = farthestFromLandmarks();
+			if (avoid == method) next = avoidLandmark(next);
+			if (m_landmarks.end() != std::find(m_landmarks.begin(), m_landmarks.end(), next)) break;
+			addLandmark(next);
+		}
+	}
+
+	///@brief Member function to get the shortest distance from s to t with A* bounded by the landmarks, Dijkstra without them
+	distanceType alt(vertexId s, vertexId t)
+	{
+		landmarkHeuristic h = {*this, t};
+		return search(s, t, h);
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHPOINTTOPOINT_HPP_ */
@@ -0,0 +1,135 @@
+/**
+ * @file GraphProperty.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the dense property maps of #graph. A property map keeps a single property of all the vertices or
+ *  all the edges of a graph in one contiguous array keyed by #base_vertex::index or #edge::index, so that an algorithm which only
+ *  needs that property does not have to walk the vertex and edge objects.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHPROPERTY_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHPROPERTY_HPP_
+
+#include <vector>
+#include "graph.hpp"
+
+/**
+ * @brief Dense array of a single property keyed by the index of a vertex or an edge
+ * @tparam	valueType	Type of the property kept in the map
+ * @details The values are stored in a std::vector, so #data gives a plain pointer which the compiler can vectorize loops over.
+ */
+template <typename valueType>
+class propertyMap
+{
+	std::vector<valueType> m_values;	///< Member to hold the property of every vertex or edge
+public:
+	typedef typename std::vector<valueType>::iterator iterator;	///< Iterator over the values of the map
+	typedef typename std::vector<valueType>::const_iterator const_iterator;	///< Constant iterator over the values of the map
+
+	///@brief Default constructor
+	propertyMap(){}
+
+	/**
+	 * @brief Double argument constructor
+	 * @param	n		Number of vertices or edges to keep the property of
+	 * @param	init	Initial value of the property
+	 */
+	propertyMap(size_t n, const valueType& init = valueType()) : m_values(n,init){}
+
+	///@brief Operator[] to provide access to the property of the vertex or edge at dense index i
+	valueType& operator[] (size_t i) {return m_values[i];}
+
+	///@brief Operator[] to provide constant access to the property of the vertex or edge at dense index i
+	const valueType& operator[] (size_t i) const {return m_values[i];}
+
+	/**
+	 * @brief Member function to provide access to the property of a vertex or an edge through its descriptor
+	 * @param	d	#base_graph::vertexDescriptor or #base_graph::edgeDescriptor of the vertex or edge
+	 * @return Reference to the property
+	 */
+	template <class descriptorType>
+	valueType& get(const descriptorType& d) {return m_values[d->index];}
+
+	///@brief Member function to provide the contiguous storage of the map
+	valueType* data() {return m_values.empty() ? NULL : &m_values[0];}
+
+	///@brief Member function to provide constant access to the contiguous storage of the map
+	const valueType* data() const {return m_values.empty() ? NULL : &m_values[0];}
+
+	///@brief Member function to get the number of values in the map
+	size_t size() const {return m_values.size();}
+
+	///@brief Member function to change the number of values in the map
+	void resize(size_t n, const valueType& init = valueType()) {m_values.resize(n,init);}
+
+	/**
+	 * @brief Member function to move the values to the indices given out by #base_graph::compact
+	 * @param	map	#graphCompaction::vertexMap or #graphCompaction::edgeMap
+	 * @details The values of removed vertices or edges are dropped.
+	 */
+	void remap(const std::vector<size_t>& map)
+	{
+		std::vector<valueType> values;
+		for (size_t i = 0; i < map.size() && i < m_values.size(); i++)
+			if (graphCompaction::removed() != map[i])
+			{
+				if (values.size() <= map[i]) values.resize(map[i] + 1);
+				values[map[i]] = m_values[i];
+			}
+		m_values.swap(values);
+	}
+
+	///@brief Member function to set all the values of the map to v
+	void fill(const valueType& v) {m_values.assign(m_values.size(),v);}
+
+	iterator begin() {return m_values.begin();}	///< Member function to provide the iterator to the first value
+	iterator end() {return m_values.end();}	///< Member function to provide the iterator past the last value
+	const_iterator begin() const {return m_values.begin();}	///< @copybrief begin
+	const_iterator end() const {return m_values.end();}	///< @copybrief end
+};
+
+/**
+ * @brief Extraction of user defined properties of a #graph into #propertyMap
+ * @tparam	graphClass	Any of the #graph specializations
+ * @details The user defined node and edge properties can be of pointer or non-pointer types. Either way #base_vertex::properties and
+ * #edge::properties give a reference to the user defined object, from which a single member is copied into the map.
+ */
+template <class graphClass>
+class graphProperties
+{
+	typedef typename graphClass::vertexDescriptor vertexDescriptor;	///< @copybrief base_graph::vertexDescriptor
+	typedef typename graphClass::edgeDescriptor edgeDescriptor;	///< @copybrief base_graph::edgeDescriptor
+public:
+	/**
+	 * @brief Member function to copy a member of the user defined node properties of all the vertices into a dense map
+	 * @param	g		The graph of which the vertices are to be read
+	 * @param	member	Pointer to the member of the user defined node class, e.g. &node::m_id
+	 * @return Map keyed by #base_vertex::index
+	 */
+	template <typename valueType, typename nodeClass>
+	static propertyMap<valueType> vertexProperty(graphClass& g, valueType nodeClass::*member)
+	{
+		propertyMap<valueType> retVal(g.size());
+		for (vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++) retVal[v->index] = v->properties().*member;
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to copy a member of the user defined edge properties of all the edges into a dense map
+	 * @param	g		The graph of which the edges are to be read
+	 * @param	member	Pointer to the member of the user defined edge class, e.g. &edge::m_weight
+	 * @details Only out edges are walked. Both directions of a #graphTraits::bidirectional edge share their index and properties.
+	 * @return Map keyed by #edge::index
+	 */
+	template <typename valueType, typename edgeClass>
+	static propertyMap<valueType> edgeProperty(graphClass& g, valueType edgeClass::*member)
+	{
+		propertyMap<valueType> retVal(g.edgeCount);
+		for (vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++)
+			for (edgeDescriptor e = g.out_edges(v).first; e != g.out_edges(v).second; e++) retVal[e->index] = e->properties().*member;
+		return retVal;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHPROPERTY_HPP_ */
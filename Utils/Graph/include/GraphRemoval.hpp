@@ -0,0 +1,285 @@
+/**
+ * @file GraphRemoval.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the removal of edges and vertices from #graph. Edges are unlinked from both of their ends right
+ *  away. Vertices are only isolated and marked #base_vertex::removed, so that their descriptors and dense indices stay valid, and
+ *  are reclaimed in a batch by #base_graph::compact.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHREMOVAL_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHREMOVAL_HPP_
+
+#include <vector>
+#include <list>
+#include <utility>
+#include "GraphTraits.hpp"
+
+/**
+ * @brief Result of #base_graph::compact
+ * @details Any #propertyMap keyed by the old indices can be moved to the new ones with #propertyMap::remap.
+ */
+struct graphCompaction
+{
+	std::vector<size_t> vertexMap;	///< New #base_vertex::index of every old vertex index, #removed for the removed vertices
+	std::vector<size_t> edgeMap;	///< New #edge::index of every old edge index, #removed for the removed edges
+	///@brief Member function to get the value mapped to removed vertices and edges
+	static size_t removed() {return size_t(-1);}
+};
+
+/**
+ * @brief [General Template]: Removal of edges and vertices of #graph
+ * @tparam	graphType	To specify whether a graph is #graphTraits::directed or #graphTraits::bidirectional
+ * @details The functions work on the #vertex objects, so they are shared by all the pointer and non-pointer variants of #graph.
+ * Removing an edge costs the degree of its two ends, removing a vertex costs the sum of the degrees of its neighbors.@n
+ * @b Specializations @b available: @n
+ * #graphRemoval<graphTraits::bidirectional> @n
+ * #graphRemoval<graphTraits::directed> @n
+ */
+template <typename graphType> class graphRemoval{};
+
+/**
+ * @brief [Specialization]: #graphRemoval for bidirectional graph, where every edge is an out edge of both of its ends
+ */
+template <>
+class graphRemoval<graphTraits::bidirectional>
+{
+	///@brief Member function to remove the out edge of owner which has the given edge index
+	template <class nodeType>
+	static void removeOutEdge(nodeType* owner, size_t index)
+	{
+		for (typename nodeType::edgeDescriptor e = owner->outBegin(); e != owner->outEnd(); e++)
+			if (e->index == index)
+			{
+				owner->removeOutEdge(e);
+				return;
+			}
+	}
+public:
+	/**
+	 * @brief Member function to remove an edge from both of its ends
+	 * @param	source	The vertex owning e
+	 * @param	e		The edge to be removed, as found in the out edges of source
+	 */
+	template <class nodeType>
+	static void removeEdge(nodeType* source, typename nodeType::edgeDescriptor e)
+	{
+		size_t index = e->index;
+		nodeType* sink = e->sink;
+		source->removeOutEdge(e);
+		removeOutEdge(sink, index);
+	}
+
+	/**
+	 * @brief Member function to remove all the edges of a vertex
+	 * @param	v	The vertex to be isolated
+	 * @return The number of edges removed
+	 */
+	template <class nodeType>
+	static size_t isolate(nodeType* v)
+	{
+		size_t retVal = 0, selfLoops = 0;
+		for (typename nodeType::edgeDescriptor e = v->outBegin(); e != v->outEnd(); e++)
+		{
+			if (v == e->sink) selfLoops++;
+			else
+			{
+				removeOutEdge(e->sink, e->index);
+				retVal++;
+			}
+		}
+		v->clearEdges();
+		return retVal + selfLoops / 2;
+	}
+
+	/**
+	 * @brief Member function to point the edges of a vertex to the new location of their ends
+	 * @param	v			The vertex of which the edges are to be updated
+	 * @param	oldBase		Address of the first vertex before the vertices were moved
+	 * @param	newBase		Address of the first vertex after the vertices were moved
+	 * @param	positionMap	New position of every old position
+	 */
+	template <class nodeType>
+	static void relink(nodeType& v, const nodeType* oldBase, nodeType* newBase, const std::vector<size_t>& positionMap)
+	{
+		for (typename nodeType::edgeDescriptor e = v.outBegin(); e != v.outEnd(); e++)
+		{
+			e->source = newBase + positionMap[e->source - oldBase];
+			e->sink = newBase + positionMap[e->sink - oldBase];
+		}
+		for (size_t i = 0; i < v.adjVertexList.size(); i++) v.adjVertexList[i] = newBase + positionMap[v.adjVertexList[i] - oldBase];
+	}
+
+	/**
+	 * @brief Member function to give the edges of a vertex their new dense index
+	 * @param	v			The vertex of which the edges are to be renumbered
+	 * @param	edgeMap		New index of every old index, filled on the first visit of every edge
+	 * @param	edgeCount	The next new index to be given out
+	 */
+	template <class nodeType>
+	static void renumberEdges(nodeType& v, std::vector<size_t>& edgeMap, size_t& edgeCount)
+	{
+		for (typename nodeType::edgeDescriptor e = v.outBegin(); e != v.outEnd(); e++)
+		{
+			if (graphCompaction::removed() == edgeMap[e->index]) edgeMap[e->index] = edgeCount++;
+			e->index = edgeMap[e->index];
+		}
+	}
+};
+
+/**
+ * @brief [Specialization]: #graphRemoval for directed graph, where every edge is an out edge of its source and an in edge of its sink
+ */
+template <>
+class graphRemoval<graphTraits::directed>
+{
+	///@copydoc graphRemoval<graphTraits::bidirectional>::removeOutEdge
+	template <class nodeType>
+	static void removeOutEdge(nodeType* owner, size_t index)
+	{
+		for (typename nodeType::edgeDescriptor e = owner->outBegin(); e != owner->outEnd(); e++)
+			if (e->index == index)
+			{
+				owner->removeOutEdge(e);
+				return;
+			}
+	}
+
+	///@brief Member function to remove the in edge of owner which has the given edge index
+	template <class nodeType>
+	static void removeInEdge(nodeType* owner, size_t index)
+	{
+		for (typename nodeType::edgeDescriptor e = owner->inBegin(); e != owner->inEnd(); e++)
+			if (e->index == index)
+			{
+				owner->removeInEdge(e);
+				return;
+			}
+	}
+public:
+	///@copydoc graphRemoval<graphTraits::bidirectional>::removeEdge
+	template <class nodeType>
+	static void removeEdge(nodeType* source, typename nodeType::edgeDescriptor e)
+	{
+		size_t index = e->index;
+		nodeType* sink = e->sink;
+		source->removeOutEdge(e);
+		removeInEdge(sink, index);
+	}
+
+	///@copydoc graphRemoval<graphTraits::bidirectional>::isolate
+	template <class nodeType>
+	static size_t isolate(nodeType* v)
+	{
+		size_t retVal = 0;
+		for (typename nodeType::edgeDescriptor e = v->outBegin(); e != v->outEnd(); e++, retVal++)
+			if (v != e->sink) removeInEdge(e->sink, e->index);
+		for (typename nodeType::edgeDescriptor e = v->inBegin(); e != v->inEnd(); e++)
+			if (v != e->source)
+			{
+				removeOutEdge(e->source, e->index);
+				retVal++;
+			}
+		v->clearEdges();
+		return retVal;
+	}
+
+	///@copydoc graphRemoval<graphTraits::bidirectional>::relink
+	template <class nodeType>
+	static void relink(nodeType& v, const nodeType* oldBase, nodeType* newBase, const std::vector<size_t>& positionMap)
+	{
+		for (typename nodeType::edgeDescriptor e = v.outBegin(); e != v.outEnd(); e++)
+		{
+			e->source = newBase + positionMap[e->source - oldBase];
+			e->sink = newBase + positionMap[e->sink - oldBase];
+		}
+		for (typename nodeType::edgeDescriptor e = v.inBegin(); e != v.inEnd(); e++)
+		{
+			e->source = newBase + positionMap[e->source - oldBase];
+			e->sink = newBase + positionMap[e->sink - oldBase];
+		}
+		for (size_t i = 0; i < v.adjVertexList.size(); i++) v.adjVertexList[i] = newBase + positionMap[v.adjVertexList[i] - oldBase];
+	}
+
+	///@copydoc graphRemoval<graphTraits::bidirectional>::renumberEdges
+	template <class nodeType>
+	static void renumberEdges(nodeType& v, std::vector<size_t>& edgeMap, size_t& edgeCount)
+	{
+		for (typename nodeType::edgeDescriptor e = v.outBegin(); e != v.outEnd(); e++)
+		{
+			if (graphCompaction::removed() == edgeMap[e->index]) edgeMap[e->index] = edgeCount++;
+			e->index = edgeMap[e->index];
+		}
+		for (typename nodeType::edgeDescriptor e = v.inBegin(); e != v.inEnd(); e++)
+		{
+			if (graphCompaction::removed() == edgeMap[e->index]) edgeMap[e->index] = edgeCount++;
+			e->index = edgeMap[e->index];
+		}
+	}
+};
+
+/**
+ * @brief Function to drop the removed vertices from a std::list of vertices
+ * @details List nodes do not move, so the descriptors of the remaining vertices and the edges pointing at them stay valid.
+ */
+template <typename graphType, class nodeType>
+void eraseRemovedVertices(std::list<nodeType>& nodeList)
+{
+	for (typename std::list<nodeType>::iterator v = nodeList.begin(); v != nodeList.end(); )
+	{
+		if (v->removed) v = nodeList.erase(v);
+		else v++;
+	}
+}
+
+/**
+ * @brief Function to drop the removed vertices from a std::vector of vertices
+ * @details The remaining vertices are moved down in a single pass, which invalidates their descriptors, and the edges are then
+ * pointed at the new location of their ends.
+ */
+template <typename graphType, class nodeType>
+void eraseRemovedVertices(std::vector<nodeType>& nodeList)
+{
+	if (nodeList.empty()) return;
+	std::vector<size_t> positionMap(nodeList.size(), graphCompaction::removed());
+	size_t to = 0;
+	for (size_t from = 0; from < nodeList.size(); from++)
+	{
+		if (nodeList[from].removed) continue;
+		positionMap[from] = to;
+		if (to != from) nodeList[to] = std::move(nodeList[from]);
+		to++;
+	}
+	const nodeType* oldBase = &nodeList[0];
+	nodeList.erase(nodeList.begin() + to, nodeList.end());
+	for (size_t v = 0; v < nodeList.size(); v++) graphRemoval<graphType>::relink(nodeList[v], oldBase, &nodeList[0], positionMap);
+}
+
+/**
+ * @brief Function to reclaim the removed vertices and the indices of the removed edges of a #graph
+ * @param	nodeList	The vertices of the graph
+ * @param	edgeCount	The edge index bound of the graph, set to the number of remaining edges
+ * @details The remaining vertices and edges are given dense indices again, in their current order.
+ * @return The mapping from the old to the new indices
+ */
+template <typename graphType, class nodeListContainerType>
+graphCompaction compactGraph(nodeListContainerType& nodeList, size_t& edgeCount)
+{
+	graphCompaction retVal;
+	retVal.vertexMap.assign(nodeList.size(), graphCompaction::removed());
+	retVal.edgeMap.assign(edgeCount, graphCompaction::removed());
+	size_t next = 0;
+	for (typename nodeListContainerType::iterator v = nodeList.begin(); v != nodeList.end(); v++)
+		if (false == v->removed) retVal.vertexMap[v->index] = next++;
+	eraseRemovedVertices<graphType>(nodeList);
+	edgeCount = 0;
+	for (typename nodeListContainerType::iterator v = nodeList.begin(); v != nodeList.end(); v++)
+	{
+		v->index = retVal.vertexMap[v->index];
+		graphRemoval<graphType>::renumberEdges(*v, retVal.edgeMap, edgeCount);
+	}
+	return retVal;
+}
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHREMOVAL_HPP_ */
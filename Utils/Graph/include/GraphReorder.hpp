@@ -0,0 +1,386 @@
+/**
+ * @file GraphReorder.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains vertex reordering for cache locality. The orderings are computed on a #csrGraph and applied to the
+ *  #csrGraph and to the #graph it was built from, keeping the permutation so that results can be mapped back to the original ids.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHREORDER_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHREORDER_HPP_
+
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <cmath>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+
+/**
+ * @brief Permutation of the vertices of a graph
+ * @details newIndex[old] is the position given to the vertex with dense index old, and oldIndex[new] is its inverse.
+ */
+class vertexPermutation
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	std::vector<vertexId> newIndex;	///< Member to map an original vertex index to its new index
+	std::vector<vertexId> oldIndex;	///< Member to map a new vertex index back to the original one
+
+	///@brief Default constructor
+	vertexPermutation(){}
+
+	/**
+	 * @brief Single argument constructor
+	 * @param	order	The original vertex indices in the order they are to be placed. Must hold every vertex exactly once.
+	 */
+	explicit vertexPermutation(const std::vector<vertexId>& order) : newIndex(order.size()), oldIndex(order)
+	{
+		for (vertexId i = 0; i < order.size(); i++) newIndex[order[i]] = i;
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t size() const {return oldIndex.size();}
+
+	///@brief Member function to get a map keyed by the original indices out of one keyed by the new indices
+	template <typename valueType>
+	propertyMap<valueType> toOriginal(const propertyMap<valueType>& byNewIndex) const
+	{
+		propertyMap<valueType> retVal(size());
+		for (size_t i = 0; i < size(); i++) retVal[oldIndex[i]] = byNewIndex[i];
+		return retVal;
+	}
+
+	///@brief Member function to get a map keyed by the new indices out of one keyed by the original indices
+	template <typename valueType>
+	propertyMap<valueType> toNew(const propertyMap<valueType>& byOldIndex) const
+	{
+		propertyMap<valueType> retVal(size());
+		for (size_t i = 0; i < size(); i++) retVal[newIndex[i]] = byOldIndex[i];
+		return retVal;
+	}
+};
+
+/**
+ * @brief Vertex reordering algorithms over #csrGraph
+ * @details Every algorithm returns a #vertexPermutation. #apply relabels a #csrGraph with it and #relabel relabels a #graph.
+ * All orderings treat the adjacency as given, so for a #graphTraits::directed graph they follow the out edges only.
+ */
+class graphReorder
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+private:
+	/**
+	 * @brief Member function to run a breadth first search from root appending discovered vertices to order
+	 * @param	byDegree	Whether the neighbors of a vertex are to be enqueued in ascending order of their degree, as Cuthill-McKee does
+	 */
+	static void breadthFirst(const csrGraph& g, vertexId root, std::vector<bool>& visited, std::vector<vertexId>& order, bool byDegree)
+	{
+		size_t head = order.size();
+		visited[root] = true;
+		order.push_back(root);
+		while (head < order.size())
+		{
+			vertexId v = order[head++];
+			size_t firstNew = order.size();
+			for (const vertexId* u = g.neighborBegin(v); u != g.neighborEnd(v); u++)
+			{
+				if (true == visited[*u]) continue;
+				visited[*u] = true;
+				order.push_back(*u);
+			}
+			if (true == byDegree) std::stable_sort(order.begin() + firstNew, order.end(), degreeLess(g));
+		}
+	}
+
+	///@brief Comparator to sort vertices in ascending order of degree
+	struct degreeLess
+	{
+		const csrGraph& g;	///< Graph of which degrees are compared
+		degreeLess(const csrGraph& g) : g(g){}	///< Single argument constructor
+		bool operator()(vertexId a, vertexId b) const {return g.degree(a) < g.degree(b);}	///< Comparison operator
+	};
+
+	///@brief Comparator to sort vertices in descending order of degree
+	struct degreeGreater
+	{
+		const csrGraph& g;	///< Graph of which degrees are compared
+		degreeGreater(const csrGraph& g) : g(g){}	///< Single argument constructor
+		bool operator()(vertexId a, vertexId b) const {return g.degree(a) > g.degree(b);}	///< Comparison operator
+	};
+
+	/**
+	 * @brief Bucket priority queue where keys only move by one, used by #gorder
+	 * @details Every key has a doubly linked list of the vertices holding it, so increment, decrement and extracting the maximum are
+	 * all constant time amortized. This is the unit heap of the Gorder paper.
+	 */
+	class unitHeap
+	{
+		std::vector<size_t> m_key;	///< Member to hold the key of every vertex
+		std::vector<vertexId> m_next;	///< Member to hold the next vertex in the bucket list
+		std::vector<vertexId> m_prev;	///< Member to hold the previous vertex in the bucket list
+		std::vector<vertexId> m_head;	///< Member to hold the first vertex of every bucket
+		std::vector<bool> m_removed;	///< Member to mark vertices already extracted
+		size_t m_top;	///< Member to hold an upper bound of the largest non empty bucket
+		static vertexId none() {return vertexId(-1);}	///< Marker of an empty link
+
+		///@brief Member function to take v out of the list of its bucket
+		void unlink(vertexId v)
+		{
+			if (none() != m_prev[v]) m_next[m_prev[v]] = m_next[v];
+			else m_head[m_key[v]] = m_next[v];
+			if (none() != m_next[v]) m_prev[m_next[v]] = m_prev[v];
+		}
+		///@brief Member function to put v at the head of the list of its bucket
+		void link(vertexId v)
+		{
+			if (m_key[v] >= m_head.size()) m_head.resize(m_key[v] + 1, none());
+			m_prev[v] = none();
+			m_next[v] = m_head[m_key[v]];
+			if (none() != m_next[v]) m_prev[m_next[v]] = v;
+			m_head[m_key[v]] = v;
+			if (m_key[v] > m_top) m_top = m_key[v];
+		}
+	public:
+		///@brief Constructor to put all the n vertices in bucket zero, the first vertex is extracted first on ties
+		unitHeap(size_t n) : m_key(n,0),m_next(n,none()),m_prev(n,none()),m_head(1,none()),m_removed(n,false),m_top(0)
+		{
+			for (size_t v = n; v > 0; v--) link(vertexId(v-1));
+		}
+		///@brief Member function to increase the key of v by one
+		void increment(vertexId v)
+		{
+			if (true == m_removed[v]) return;
+			unlink(v);
+			m_key[v]++;
+			link(v);
+		}
+		///@brief Member function to decrease the key of v by one
+		void decrement(vertexId v)
+		{
+			if (true == m_removed[v] || 0 == m_key[v]) return;
+			unlink(v);
+			m_key[v]--;
+			link(v);
+		}
+		///@brief Member function to remove v from the heap
+		void remove(vertexId v)
+		{
+			if (true == m_removed[v]) return;
+			unlink(v);
+			m_removed[v] = true;
+		}
+		///@brief Member function to extract a vertex with the largest key
+		vertexId extractTop()
+		{
+			while (none() == m_head[m_top]) m_top--;
+			vertexId v = m_head[m_top];
+			remove(v);
+			return v;
+		}
+	};
+	/**
+	 * @brief Member function to update the Gorder scores for vertex v entering or leaving the window
+	 * @details Out and in neighbors of v get one for every arc they share with v, and every vertex sharing an in neighbor x with v
+	 * gets one for x, unless x is a hub of more than hubDegree out neighbors.
+	 */
+	static void updateScores(const csrGraph& g, const csrGraph& reverse, vertexId v, size_t hubDegree, unitHeap& scores,
+			void (unitHeap::*update)(vertexId))
+	{
+		for (const vertexId* u = g.neighborBegin(v); u != g.neighborEnd(v); u++) (scores.*update)(*u);
+		for (const vertexId* x = reverse.neighborBegin(v); x != reverse.neighborEnd(v); x++)
+		{
+			(scores.*update)(*x);
+			if (g.degree(*x) > hubDegree) continue;
+			for (const vertexId* w = g.neighborBegin(*x); w != g.neighborEnd(*x); w++) (scores.*update)(*w);
+		}
+	}
+public:
+	/**
+	 * @brief Member function to compute the reverse Cuthill-McKee ordering
+	 * @param	g	The graph to be reordered
+	 * @details Every connected component is started from an unvisited vertex of smallest degree, visited breadth first enqueuing
+	 * neighbors by ascending degree, and the whole order is reversed at the end. This keeps the bandwidth of the adjacency matrix
+	 * small, i.e. neighbors get nearby ids.
+	 * @return The permutation
+	 */
+	static vertexPermutation reverseCuthillMcKee(const csrGraph& g)
+	{
+		std::vector<vertexId> byDegree(g.numVertices());
+		for (vertexId v = 0; v < byDegree.size(); v++) byDegree[v] = v;
+		std::stable_sort(byDegree.begin(), byDegree.end(), degreeLess(g));
+		std::vector<bool> visited(g.numVertices(), false);
+		std::vector<vertexId> order;
+		order.reserve(g.numVertices());
+		for (size_t i = 0; i < byDegree.size(); i++)
+			if (false == visited[byDegree[i]]) breadthFirst(g, byDegree[i], visited, order, true);
+		std::reverse(order.begin(), order.end());
+		return vertexPermutation(order);
+	}
+
+	/**
+	 * @brief Member function to compute the degree descending ordering
+	 * @details Hub vertices are put first so that the most often touched entries of per vertex arrays share cache lines. Ties keep
+	 * the original order.
+	 * @return The permutation
+	 */
+	static vertexPermutation degreeSort(const csrGraph& g)
+	{
+		std::vector<vertexId> order(g.numVertices());
+		for (vertexId v = 0; v < order.size(); v++) order[v] = v;
+		std::stable_sort(order.begin(), order.end(), degreeGreater(g));
+		return vertexPermutation(order);
+	}
+
+	/**
+	 * @brief Member function to compute the breadth first ordering
+	 * @details Every vertex not yet discovered, in the original order, starts a new search.
+	 * @return The permutation
+	 */
+	static vertexPermutation breadthFirstOrder(const csrGraph& g)
+	{
+		std::vector<bool> visited(g.numVertices(), false);
+		std::vector<vertexId> order;
+		order.reserve(g.numVertices());
+		for (vertexId v = 0; v < g.numVertices(); v++)
+			if (false == visited[v]) breadthFirst(g, v, visited, order, false);
+		return vertexPermutation(order);
+	}
+
+	/**
+	 * @brief Member function to compute the depth first pre-order ordering
+	 * @details @copydetails breadthFirstOrder
+	 * @return The permutation
+	 */
+	static vertexPermutation depthFirstOrder(const csrGraph& g)
+	{
+		std::vector<bool> visited(g.numVertices(), false);
+		std::vector<vertexId> order;
+		std::vector<std::pair<vertexId,size_t> > stack;
+		order.reserve(g.numVertices());
+		for (vertexId root = 0; root < g.numVertices(); root++)
+		{
+			if (true == visited[root]) continue;
+			visited[root] = true;
+			order.push_back(root);
+			stack.push_back(std::make_pair(root, g.offsets[root]));
+			while (false == stack.empty())
+			{
+				vertexId v = stack.back().first;
+				size_t& slot = stack.back().second;
+				if (slot == g.offsets[v+1])
+				{
+					stack.pop_back();
+					continue;
+				}
+				vertexId u = g.targets[slot++];
+				if (true == visited[u]) continue;
+				visited[u] = true;
+				order.push_back(u);
+				stack.push_back(std::make_pair(u, g.offsets[u]));
+			}
+		}
+		return vertexPermutation(order);
+	}
+
+	/**
+	 * @brief Member function to compute the Gorder ordering
+	 * @param	g			The graph to be reordered
+	 * @param	window		Number of most recently placed vertices whose neighborhood is scored against the candidates
+	 * @param	hubDegree	Vertices with a larger degree are not expanded to their siblings, 0 means sqrt of the number of vertices
+	 * @details The next vertex placed is the one with the largest score against the sliding window of the last placed ones, where
+	 * the score of a pair is the number of arcs between them plus the number of in neighbors they share. Scores are kept in a
+	 * #unitHeap and updated when a vertex enters or leaves the window.
+	 * @return The permutation
+	 */
+	static vertexPermutation gorder(const csrGraph& g, size_t window = 5, size_t hubDegree = 0)
+	{
+		size_t n = g.numVertices();
+		std::vector<vertexId> order;
+		if (0 == n) return vertexPermutation(order);
+		if (0 == hubDegree) hubDegree = size_t(std::sqrt(double(n))) + 1;
+		order.reserve(n);
+		unitHeap scores(n);
+		vertexId first = 0;
+		for (vertexId v = 1; v < n; v++) if (g.degree(v) > g.degree(first)) first = v;
+		scores.remove(first);
+		order.push_back(first);
+		csrGraph reverse = g.transpose();
+		for (size_t placed = 1; placed <= n; placed++)
+		{
+			updateScores(g, reverse, order[placed-1], hubDegree, scores, &unitHeap::increment);
+			if (placed > window) updateScores(g, reverse, order[placed-1-window], hubDegree, scores, &unitHeap::decrement);
+			if (placed == n) break;
+			order.push_back(scores.extractTop());
+		}
+		return vertexPermutation(order);
+	}
+
+	/**
+	 * @brief Member function to relabel a #csrGraph
+	 * @param	g	The graph to be relabeled
+	 * @param	p	The permutation to apply
+	 * @details Vertex v of the result is vertex p.oldIndex[v] of g, and its adjacency is sorted by the new ids. The edge indices are
+	 * carried along, so edge property maps keep working through #csrGraph::slotProperty.
+	 * @return The relabeled graph
+	 */
+	static csrGraph apply(const csrGraph& g, const vertexPermutation& p)
+	{
+		csrGraph retVal;
+		size_t n = g.numVertices();
+		retVal.offsets.assign(n + 1, 0);
+		for (vertexId v = 0; v < n; v++) retVal.offsets[v+1] = retVal.offsets[v] + g.degree(p.oldIndex[v]);
+		retVal.targets.resize(g.numSlots());
+		retVal.edgeIndex.resize(g.numSlots());
+		std::vector<std::pair<vertexId,size_t> > row;
+		for (vertexId v = 0; v < n; v++)
+		{
+			vertexId old = p.oldIndex[v];
+			row.clear();
+			for (size_t slot = g.offsets[old]; slot < g.offsets[old+1]; slot++)
+				row.push_back(std::make_pair(p.newIndex[g.targets[slot]], g.edgeIndex[slot]));
+			std::sort(row.begin(), row.end());
+			for (size_t i = 0; i < row.size(); i++)
+			{
+				retVal.targets[retVal.offsets[v] + i] = row[i].first;
+				retVal.edgeIndex[retVal.offsets[v] + i] = row[i].second;
+			}
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to relabel a #graph
+	 * @param	g	The graph to be relabeled, whose #base_vertex::index were used to build the #csrGraph the permutation came from
+	 * @param	p	The permutation to apply
+	 * @details Every #base_vertex::index is replaced by its new index. With #graphTraits::listStorage the vertex list is also
+	 * relinked in the new order, which keeps every #base_graph::vertexDescriptor valid. With #graphTraits::vectorStorage the
+	 * vertices can not be moved without invalidating the adjacency, so only the indices change.
+	 * @return Nothing
+	 */
+	template <class graphClass>
+	static void relabel(graphClass& g, const vertexPermutation& p)
+	{
+		for (typename graphClass::vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++)
+			v->index = p.newIndex[v->index];
+		sortByIndex(g.nodeList);
+	}
+private:
+	///@brief Comparator to sort vertices by #base_vertex::index
+	struct indexLess
+	{
+		template <class nodeType>
+		bool operator()(const nodeType& a, const nodeType& b) const {return a.index < b.index;}	///< Comparison operator
+	};
+	///@brief Member function to relink a std::list of vertices in the order of their indices
+	template <class nodeType>
+	static void sortByIndex(std::list<nodeType>& nodes) {nodes.sort(indexLess());}
+	///@brief Member function to leave a std::vector of vertices in place
+	template <class nodeType>
+	static void sortByIndex(std::vector<nodeType>&) {}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHREORDER_HPP_ */
@@ -0,0 +1,139 @@
+/**
+ * @file GraphSearch.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the breadth first and depth first traversals of #graph.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHSEARCH_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHSEARCH_HPP_
+
+#include <vector>
+#include <iterator>
+#include <tr1/unordered_set>
+#include "graph.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Traversals over the adjacency of a #graph
+ * @tparam	graphClass	Any of the #graph specializations
+ * @tparam	stats		Stats policy which records the number of edges looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The traversals walk the adjacent vertex lists of the vertices, which for a #graphTraits::directed graph are the out
+ * edges and for a #graphTraits::bidirectional graph are the edges in both directions. The result of a traversal is the list of
+ * vertices in the order they were discovered.
+ */
+template <class graphClass, class stats = defaultStatsPolicy>
+class graphSearch
+{
+public:
+	typedef typename graphClass::vertexDescriptor vertexDescriptor;	///< @copybrief base_graph::vertexDescriptor
+	typedef typename graphClass::adjVertexDescriptor adjVertexDescriptor;	///< @copybrief base_graph::adjVertexDescriptor
+	typedef typename std::iterator_traits<adjVertexDescriptor>::value_type nodePointer;	///< Pointer to a vertex of the graph
+	typedef std::vector<nodePointer> orderType;	///< Type of the list of vertices in discovery order
+private:
+	typedef tr1::unordered_set<nodePointer> visitedSetType;	///< Type of the set of discovered vertices
+
+	///@brief Member function to run a breadth first search from a single root and append the discovered vertices to order
+	static void breadthFirst(nodePointer root, visitedSetType& visited, orderType& order)
+	{
+		size_t head = order.size();
+		visited.insert(root);
+		order.push_back(root);
+		while (head < order.size())
+		{
+			nodePointer v = order[head++];
+			for (adjVertexDescriptor adjV = v->adjVertexBegin(); adjV != v->adjVertexEnd(); adjV++)
+			{
+				stats::edgeVisit();
+				if (true == visited.insert(*adjV).second) order.push_back(*adjV);
+			}
+		}
+	}
+
+	///@brief Member function to run a depth first search from a single root and append the discovered vertices to order
+	static void depthFirst(nodePointer root, visitedSetType& visited, orderType& order)
+	{
+		std::vector<std::pair<nodePointer, adjVertexDescriptor> > stack;
+		visited.insert(root);
+		order.push_back(root);
+		stack.push_back(std::make_pair(root, root->adjVertexBegin()));
+		while (false == stack.empty())
+		{
+			nodePointer v = stack.back().first;
+			adjVertexDescriptor& adjV = stack.back().second;
+			if (adjV == v->adjVertexEnd())
+			{
+				stack.pop_back();
+				continue;
+			}
+			nodePointer next = *adjV;
+			adjV++;
+			stats::edgeVisit();
+			if (true == visited.insert(next).second)
+			{
+				order.push_back(next);
+				stack.push_back(std::make_pair(next, next->adjVertexBegin()));
+			}
+		}
+	}
+public:
+	/**
+	 * @brief Member function to get the vertices reachable from source in breadth first order
+	 * @param	source	The vertex descriptor of the vertex to start the search from
+	 * @return The reachable vertices in the order they were discovered
+	 */
+	static orderType breadthFirstOrder(vertexDescriptor source)
+	{
+		visitedSetType visited;
+		orderType order;
+		breadthFirst(&(*source), visited, order);
+		return order;
+	}
+
+	/**
+	 * @brief Member function to get all the vertices of the graph in breadth first order
+	 * @param	g	The graph to be traversed
+	 * @details Every vertex not yet discovered, taken in the order of the vertex list of the graph, starts a new search.
+	 * @return All the vertices of the graph in the order they were discovered
+	 */
+	static orderType breadthFirstOrder(graphClass& g)
+	{
+		visitedSetType visited;
+		orderType order;
+		for (vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++)
+			if (visited.end() == visited.find(&(*v))) breadthFirst(&(*v), visited, order);
+		return order;
+	}
+
+	/**
+	 * @brief Member function to get the vertices reachable from source in depth first pre-order
+	 * @param	source	The vertex descriptor of the vertex to start the search from
+	 * @return The reachable vertices in the order they were discovered
+	 */
+	static orderType depthFirstOrder(vertexDescriptor source)
+	{
+		visitedSetType visited;
+		orderType order;
+		depthFirst(&(*source), visited, order);
+		return order;
+	}
+
+	/**
+	 * @brief Member function to get all the vertices of the graph in depth first pre-order
+	 * @param	g	The graph to be traversed
+	 * @details @copydetails breadthFirstOrder(graphClass& g)
+	 * @return All the vertices of the graph in the order they were discovered
+	 */
+	static orderType depthFirstOrder(graphClass& g)
+	{
+		visitedSetType visited;
+		orderType order;
+		for (vertexDescriptor v = g.vertices().first; v != g.vertices().second; v++)
+			if (visited.end() == visited.find(&(*v))) depthFirst(&(*v), visited, order);
+		return order;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHSEARCH_HPP_ */
@@ -0,0 +1,344 @@
+/**
+ * @file GraphShortestPath.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the single source shortest paths over non-negative edge weights: sequential Dijkstra and parallel
+ *  delta-stepping.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHSHORTESTPATH_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHSHORTESTPATH_HPP_
+
+#include <vector>
+#include <limits>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphThreads.hpp"
+#include "heap.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Single source shortest paths over a #csrGraph or any #graph specialization
+ * @tparam	weightType		Type of the edge weights, which must not be negative
+ * @tparam	distanceType	Type of the path lengths, wide enough for the longest path
+ * @tparam	stats			Stats policy which records the number of edges looked at by #dijkstra and #deltaStepping. #noStats or
+ * #countingStats, selected by ALGOPP_STATS when not given.
+ * @details The algorithms run on a #csrGraph with the weights gathered in slot order by #csrGraph::slotProperty. The overloads
+ * taking a #graph flatten it first and take the weights keyed by #edge::index, as given by #graphProperties::edgeProperty. For a
+ * #graphTraits::directed graph the paths follow the out edges, for a #graphTraits::bidirectional graph the edges in both directions.
+ * The distances are returned keyed by vertex index, with #unreachable for the vertices not reached from the source.
+ */
+template <typename weightType = int, typename distanceType = long long, class stats = defaultStatsPolicy>
+class graphShortestPath
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef propertyMap<distanceType> distanceMap;	///< Type of the distances keyed by vertex index
+
+	///@brief Member function to get the distance of the vertices which are not reachable
+	static distanceType unreachable() {return std::numeric_limits<distanceType>::max();}
+
+private:
+	///@brief Tentative distance of a vertex, as kept in the heap of #dijkstra
+	struct queuedVertex
+	{
+		distanceType dist;	///< Member to hold the tentative distance
+		vertexId v;	///< Member to hold the vertex
+		///@brief Member function to get the key required by heap.
+		static distanceType getKey(queuedVertex& a) {return a.dist;}
+	};
+
+	/**
+	 * @brief State shared by the threads of #deltaStepping
+	 * @details Between two barriers every thread relaxes its share of frontier and collects the vertices it improved. The main
+	 * thread alone files them into buckets and builds the next frontier while the others wait at the barrier.
+	 */
+	struct deltaState
+	{
+		const csrGraph& g;	///< Member to hold the graph
+		const propertyMap<weightType>& w;	///< Member to hold the weights in slot order
+		weightType delta;	///< Member to hold the width of a bucket
+		std::vector<std::atomic<distanceType> > dist;	///< Member to hold the tentative distances
+		std::vector<vertexId> frontier;	///< Member to hold the vertices whose edges are relaxed in this phase
+		std::vector<std::vector<vertexId> > improved;	///< Member to hold the vertices improved by every thread in this phase
+		std::vector<size_t> visited;	///< Member to hold the edges every thread looked at in this phase
+		bool light;	///< Member to hold whether this phase relaxes the edges up to delta or the longer ones
+
+		///@brief Constructor to initialize all the distances as unreachable
+		deltaState(const csrGraph& g, const propertyMap<weightType>& w, weightType delta, size_t noOfThreads) :
+			g(g),w(w),delta(delta),dist(g.numVertices()),improved(noOfThreads),visited(noOfThreads, 0),light(true)
+		{
+			for (size_t v = 0; v < dist.size(); v++) dist[v].store(unreachable(), std::memory_order_relaxed);
+		}
+	};
+
+	///@brief Member function to relax the light or heavy edges of thread t's share of the frontier, keeping the edges it looked at
+	///in visited
+	static void relaxShare(deltaState& s, size_t t, size_t noOfThreads)
+	{
+		size_t begin = s.frontier.size() * t / noOfThreads, end = s.frontier.size() * (t + 1) / noOfThreads, visited = 0;
+		std::vector<vertexId>& improved = s.improved[t];
+		for (size_t i = begin; i < end; i++)
+		{
+			vertexId u = s.frontier[i];
+			distanceType du = s.dist[u].load(std::memory_order_relaxed);
+			visited += s.g.degree(u);
+			for (size_t slot = s.g.offsets[u]; slot < s.g.offsets[u+1]; slot++)
+			{
+				weightType w = s.w[slot];
+				if ((w <= s.delta) != s.light) continue;
+				distanceType candidate = du + w;
+				vertexId v = s.g.targets[slot];
+				distanceType old = s.dist[v].load(std::memory_order_relaxed);
+				while (candidate < old && false == s.dist[v].compare_exchange_weak(old, candidate, std::memory_order_relaxed));
+				if (candidate < old) improved.push_back(v);
+			}
+		}
+		s.visited[t] = visited;
+	}
+
+	///@brief Member function to get the bucket of a distance
+	static size_t bucketOf(distanceType d, weightType delta) {return size_t(d / delta);}
+
+public:
+	/**
+	 * @brief Member function to run Dijkstra from a source
+	 * @details The binary #heap has no decreaseKey, so a vertex is inserted again whenever its distance improves and the stale
+	 * entries are skipped when extracted.
+	 * @param	g		The graph
+	 * @param	w		The weights in slot order
+	 * @param	source	The source vertex
+	 * @return The distances keyed by vertex index
+	 */
+	static distanceMap dijkstra(const csrGraph& g, const propertyMap<weightType>& w, vertexId source)
+	{
+		distanceMap retVal(g.numVertices(), unreachable());
+		heap<queuedVertex,basic_heap_min_traits<queuedVertex>,noStats> queue;
+		queuedVertex s = {0, source};
+		retVal[source] = 0;
+		queue.insert(s);
+		while (0 != queue.getSize())
+		{
+			queuedVertex top = queue.extractTop();
+			if (top.dist != retVal[top.v]) continue;
+			stats::edgeVisit(g.degree(top.v));
+			for (size_t slot = g.offsets[top.v]; slot < g.offsets[top.v+1]; slot++)
+			{
+				queuedVertex next = {distanceType(top.dist + w[slot]), g.targets[slot]};
+				if (next.dist >= retVal[next.v]) continue;
+				retVal[next.v] = next.dist;
+				queue.insert(next);
+			}
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to suggest the width of the buckets of #deltaStepping
+	 * @details Meyer and Sanders show that a width of about the largest weight over the average degree keeps both the number of
+	 * buckets and the number of repeated relaxations in a bucket small. The result is never below the smallest positive weight,
+	 * so that a bucket is never narrower than an edge.
+	 */
+	static weightType suggestDelta(const csrGraph& g, const propertyMap<weightType>& w)
+	{
+		if (0 == g.numSlots() || 0 == g.numVertices()) return weightType(1);
+		weightType maxWeight = weightType(0), minWeight = std::numeric_limits<weightType>::max();
+		for (size_t slot = 0; slot < g.numSlots(); slot++)
+		{
+			maxWeight = std::max(maxWeight, w[slot]);
+			if (w[slot] > weightType(0)) minWeight = std::min(minWeight, w[slot]);
+		}
+		if (weightType(0) == maxWeight) return weightType(1);
+		double averageDegree = double(g.numSlots()) / g.numVertices();
+		weightType retVal = weightType(maxWeight / std::max(1.0, averageDegree));
+		return std::max(retVal, minWeight);
+	}
+
+	/**
+	 * @brief Member function to run delta-stepping from a source over several threads
+	 * @details The vertices are kept in buckets of distances [i*delta, (i+1)*delta), of which only the largest weight over delta
+	 * plus two are kept and reused cyclically, as no relaxation reaches further ahead. For a small delta that count is capped at
+	 * the number of vertices plus two, so a bucket can then also hold vertices of a later round of the cycle, which are left in it
+	 * until their round comes, and after a whole round with nothing to settle the search jumps to the nearest bucket in use. The
+	 * smallest bucket which is not empty is
+	 * settled in phases: its vertices relax their edges up to delta, which may put vertices back into the same bucket, until it
+	 * stays empty, and then all the vertices it held relax their longer edges once. Within a phase the vertices are split over the
+	 * threads and the distances are lowered with compare and swap, so the result is exact whatever the number of threads. Every
+	 * thread counts the edges it looks at, and the stats get the total after each phase.
+	 * @param	g				The graph
+	 * @param	w				The weights in slot order
+	 * @param	source			The source vertex
+	 * @param	noOfThreads		Number of threads, including the calling one
+	 * @param	delta			Width of the buckets. When not positive, #suggestDelta is used.
+	 * @return The distances keyed by vertex index
+	 */
+	static distanceMap deltaStepping(const csrGraph& g, const propertyMap<weightType>& w, vertexId source, size_t noOfThreads = 1,
+			weightType delta = weightType(0))
+	{
+		if (false == (delta > weightType(0))) delta = suggestDelta(g, w);
+		noOfThreads = std::max(size_t(1), noOfThreads);
+		deltaState s(g, w, delta, noOfThreads);
+		phaseThreads<deltaState> threads(s, relaxShare, noOfThreads);
+		// A relaxation from bucket i lands at most the largest weight above it, so the buckets in use always fit in a cycle of
+		// that many widths plus two, or share the capped cycle with later rounds
+		weightType maxWeight = weightType(0);
+		for (size_t slot = 0; slot < g.numSlots(); slot++) maxWeight = std::max(maxWeight, w[slot]);
+		double span = std::min(double(maxWeight) / double(delta), double(g.numVertices()));
+		std::vector<std::vector<vertexId> > buckets(size_t(span) + 2);
+		size_t pending = 1, idle = 0;
+		// inFrontier holds the last phase a vertex was put in the frontier, inSettled the last bucket (plus one) it was settled in
+		std::vector<size_t> inFrontier(g.numVertices(), 0), inSettled(g.numVertices(), 0);
+		std::vector<vertexId> settled;
+		size_t phase = 0;
+		s.dist[source].store(0);
+		buckets[0].push_back(source);
+		std::vector<vertexId> later;
+		for (size_t current = 0; pending > 0; current++)
+		{
+			if (buckets.size() == idle)
+			{
+				current = nearestBucket(s, buckets);
+				idle = 0;
+			}
+			std::vector<vertexId>& bucket = buckets[current % buckets.size()];
+			settled.clear();
+			s.light = true;
+			while (false == bucket.empty())
+			{
+				phase++;
+				s.frontier.clear();
+				later.clear();
+				for (size_t i = 0; i < bucket.size(); i++)
+				{
+					vertexId v = bucket[i];
+					size_t b = bucketOf(s.dist[v].load(), delta);
+					if (current < b) later.push_back(v);
+					if (phase == inFrontier[v] || current != b) continue;
+					inFrontier[v] = phase;
+					s.frontier.push_back(v);
+					if (current + 1 == inSettled[v]) continue;
+					inSettled[v] = current + 1;
+					settled.push_back(v);
+				}
+				pending -= bucket.size() - later.size();
+				bucket.swap(later);
+				if (true == s.frontier.empty()) break;
+				pending += runPhase(s, threads, buckets);
+			}
+			idle = (true == settled.empty()) ? idle + 1 : 0;
+			if (true == settled.empty()) continue;
+			s.frontier.swap(settled);
+			s.light = false;
+			pending += runPhase(s, threads, buckets);
+		}
+		threads.stop();
+		distanceMap retVal(g.numVertices());
+		for (size_t v = 0; v < g.numVertices(); v++) retVal[v] = s.dist[v].load();
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to pick the bucket width by timing #deltaStepping
+	 * @details The widths tried are the #suggestDelta times 1/8, 1/4 .. 8, each once from the given source. Worth it when many
+	 * searches are run on the same graph.
+	 * @return The fastest width
+	 */
+	static weightType tuneDelta(const csrGraph& g, const propertyMap<weightType>& w, vertexId source, size_t noOfThreads = 1)
+	{
+		weightType suggested = suggestDelta(g, w), retVal = suggested;
+		double best = std::numeric_limits<double>::max();
+		for (int shift = -3; shift <= 3; shift++)
+		{
+			// Scaled in the distance type and skipped when the width would not fit in the weight type
+			distanceType scaled = (shift < 0) ? distanceType(suggested) / distanceType(1 << -shift) : distanceType(suggested) * distanceType(1 << shift);
+			if (scaled > distanceType(std::numeric_limits<weightType>::max())) continue;
+			weightType delta = weightType(scaled);
+			if (false == (delta > weightType(0))) continue;
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			deltaStepping(g, w, source, noOfThreads, delta);
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			if (elapsed < best)
+			{
+				best = elapsed;
+				retVal = delta;
+			}
+		}
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to run Dijkstra on a #graph
+	 * @param	g		The graph
+	 * @param	w		The weights keyed by #edge::index
+	 * @param	source	The source vertex
+	 * @return @copydoc dijkstra
+	 */
+	template <class graphClass>
+	static distanceMap dijkstra(graphClass& g, const propertyMap<weightType>& w, typename graphClass::vertexDescriptor source)
+	{
+		csrGraph csr(g);
+		return dijkstra(csr, csr.slotProperty(w), vertexId(source->index));
+	}
+
+	/**
+	 * @brief Member function to run delta-stepping on a #graph
+	 * @param	g				The graph
+	 * @param	w				The weights keyed by #edge::index
+	 * @param	source			The source vertex
+	 * @param	noOfThreads		Number of threads, including the calling one
+	 * @param	delta			Width of the buckets. When not positive, #suggestDelta is used.
+	 * @return @copydoc deltaStepping
+	 */
+	template <class graphClass>
+	static distanceMap deltaStepping(graphClass& g, const propertyMap<weightType>& w, typename graphClass::vertexDescriptor source,
+			size_t noOfThreads = 1, weightType delta = weightType(0))
+	{
+		csrGraph csr(g);
+		return deltaStepping(csr, csr.slotProperty(w), vertexId(source->index), noOfThreads, delta);
+	}
+
+private:
+	/**
+	 * @brief Member function to run one phase on all the threads and file the vertices they improved into the cyclic buckets of
+	 * their new distances
+	 * @details The edges looked at are reported to the stats here, once per phase, since the threads share the stats.
+	 * @return The number of vertices filed
+	 */
+	static size_t runPhase(deltaState& s, phaseThreads<deltaState>& threads, std::vector<std::vector<vertexId> >& buckets)
+	{
+		threads.run();
+		size_t visited = 0;
+		for (size_t t = 0; t < s.visited.size(); t++) visited += s.visited[t];
+		stats::edgeVisit(visited);
+		size_t retVal = 0;
+		for (size_t t = 0; t < s.improved.size(); t++)
+		{
+			for (size_t i = 0; i < s.improved[t].size(); i++)
+			{
+				vertexId v = s.improved[t][i];
+				buckets[bucketOf(s.dist[v].load(), s.delta) % buckets.size()].push_back(v);
+			}
+			retVal += s.improved[t].size();
+			s.improved[t].clear();
+		}
+		return retVal;
+	}
+
+	///@brief Member function to get the nearest bucket of the vertices left in the buckets, when all are in later rounds
+	static size_t nearestBucket(deltaState& s, std::vector<std::vector<vertexId> >& buckets)
+	{
+		size_t retVal = std::numeric_limits<size_t>::max();
+		for (size_t i = 0; i < buckets.size(); i++)
+		{
+			for (size_t j = 0; j < buckets[i].size(); j++) retVal = std::min(retVal, bucketOf(s.dist[buckets[i][j]].load(), s.delta));
+		}
+		return retVal;
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHSHORTESTPATH_HPP_ */
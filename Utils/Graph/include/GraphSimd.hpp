@@ -0,0 +1,52 @@
+/**
+ * @file GraphSimd.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the SIMD block compare shared by the merges of sorted lists of vertex ids.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHSIMD_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHSIMD_HPP_
+
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Compare of a block of four 32 bit ids of one sorted list with a block of four of another
+ * @details A merge compares the blocks at its two cursors and then moves past the block whose last id is not above the other's,
+ * or past both if those are equal, so that no common id is missed. #matches exists only when SSE2 does, so the merges guard their
+ * block loops with __SSE2__ and finish the ends shorter than a block with a scalar merge.
+ */
+class sortedBlocks
+{
+public:
+	///@brief Function to tell if #matches really uses SIMD instructions in this build
+	static bool available()
+	{
+#ifdef __SSE2__
+		return true;
+#else
+		return false;
+#endif
+	}
+
+#ifdef __SSE2__
+	///@brief Function to compare the four ids at a with the four at b, giving bit i for every a[i] found among those of b
+	static int matches(const uint32_t* a, const uint32_t* b)
+	{
+		__m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+		__m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+		// Every rotation of the block of b lines each of its elements up once with every element of the block of a
+		__m128i equal = _mm_cmpeq_epi32(va, vb);
+		equal = _mm_or_si128(equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1))));
+		equal = _mm_or_si128(equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1,0,3,2))));
+		equal = _mm_or_si128(equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2,1,0,3))));
+		return _mm_movemask_ps(_mm_castsi128_ps(equal));
+	}
+#endif
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHSIMD_HPP_ */
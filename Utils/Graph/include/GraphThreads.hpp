@@ -0,0 +1,130 @@
+/**
+ * @file GraphThreads.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the running of work on several threads shared by the graph algorithms: the barrier and the
+ *  phase runner of the ones which split every phase of their work among threads, and the fork and join of the others.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHTHREADS_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHTHREADS_HPP_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @brief Barrier which a fixed number of threads meet at between phases
+ */
+class phaseBarrier
+{
+	std::mutex m_lock;	///< Member to hold the lock of the counters
+	std::condition_variable m_released;	///< Member to wake the threads when the last one arrives
+	size_t m_threads;	///< Member to hold the number of threads which meet
+	size_t m_waiting;	///< Member to hold the number of threads arrived in this round
+	size_t m_round;	///< Member to hold the number of rounds completed
+public:
+	///@brief Single argument constructor
+	explicit phaseBarrier(size_t noOfThreads) : m_threads(noOfThreads),m_waiting(0),m_round(0){}
+	///@brief Member function to wait until all the threads have arrived
+	void wait()
+	{
+		std::unique_lock<std::mutex> guard(m_lock);
+		size_t round = m_round;
+		if (++m_waiting == m_threads)
+		{
+			m_waiting = 0;
+			m_round++;
+			m_released.notify_all();
+			return;
+		}
+		while (round == m_round) m_released.wait(guard);
+	}
+};
+
+/**
+ * @brief Threads which run their shares of a sequence of phases, the calling thread taking share 0
+ * @tparam	stateType	Type of the state the shares work on
+ * @details The helper threads are started once and wait at a #phaseBarrier between the phases, so between two calls of #run the
+ * calling thread alone may read and change the state, e.g. to join what the threads found and set up the next phase.
+ */
+template <class stateType>
+class phaseThreads
+{
+public:
+	typedef void (*shareFunction)(stateType& s, size_t t, size_t noOfThreads);	///< Function running share t of a phase
+
+private:
+	stateType& m_state;	///< Member to hold the state
+	shareFunction m_share;	///< Member to hold the function running a share
+	size_t m_threads;	///< Member to hold the number of threads, the calling one included
+	bool m_done;	///< Member to hold whether the helpers are told to return
+	phaseBarrier m_barrier;	///< Member to hold the barrier between phases
+	std::vector<std::thread> m_helpers;	///< Member to hold the helper threads
+
+	///@brief Function run by the helper threads, which only run their shares of the phases
+	static void helperLoop(phaseThreads* p, size_t t)
+	{
+		for (;;)
+		{
+			p->m_barrier.wait();
+			if (true == p->m_done) return;
+			p->m_share(p->m_state, t, p->m_threads);
+			p->m_barrier.wait();
+		}
+	}
+
+public:
+	/**
+	 * @brief Constructor to start the helper threads
+	 * @param	s			The state
+	 * @param	share		Function running a share of a phase
+	 * @param	noOfThreads	Number of threads, the calling one included
+	 */
+	phaseThreads(stateType& s, shareFunction share, size_t noOfThreads) : m_state(s),m_share(share),m_threads(noOfThreads),
+		m_done(false),m_barrier(noOfThreads)
+	{
+		for (size_t t = 1; t < m_threads; t++) m_helpers.push_back(std::thread(helperLoop, this, t));
+	}
+
+	///@brief Destructor, stops the helper threads
+	~phaseThreads()
+	{
+		stop();
+	}
+
+	///@brief Member function to run one phase on all the threads and return once all the shares are done
+	void run()
+	{
+		if (m_threads > 1) m_barrier.wait();
+		m_share(m_state, 0, m_threads);
+		if (m_threads > 1) m_barrier.wait();
+	}
+
+	///@brief Member function to let the helper threads return and join them
+	void stop()
+	{
+		if (true == m_done) return;
+		m_done = true;
+		if (m_threads > 1) m_barrier.wait();
+		for (size_t t = 0; t < m_helpers.size(); t++) m_helpers[t].join();
+	}
+};
+
+/**
+ * @brief Function to run work(s, t) on every thread t = 0..noOfThreads-1 and return once they are all done
+ * @details Thread 0 is the calling one, the others are started for the call and joined before it returns. What the threads
+ * count or find is best kept per thread in the state and joined by the caller afterwards.
+ */
+template <class stateType>
+void forkJoin(size_t noOfThreads, void (*work)(stateType*, size_t), stateType* s)
+{
+	std::vector<std::thread> helpers;
+	for (size_t t = 1; t < noOfThreads; t++) helpers.push_back(std::thread(work, s, t));
+	work(s, 0);
+	for (size_t t = 0; t < helpers.size(); t++) helpers[t].join();
+}
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHTHREADS_HPP_ */
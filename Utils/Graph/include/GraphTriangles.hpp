@@ -0,0 +1,376 @@
+/**
+ * @file GraphTriangles.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains triangle counting and the clustering coefficients of undirected graphs, with several kernels for
+ *  intersecting sorted adjacency lists.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHTRIANGLES_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHTRIANGLES_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include "graph.hpp"
+#include "GraphCSR.hpp"
+#include "GraphProperty.hpp"
+#include "GraphSimd.hpp"
+#include "GraphThreads.hpp"
+#include "OpStats.hpp"
+
+/**
+ * @brief Triangles of an undirected graph
+ * @tparam	stats	Stats policy which records the number of list elements looked at. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The graph is read as undirected, from a #graphTraits::bidirectional #graph or a symmetric #csrGraph.
+ * Self loops and parallel edges are dropped. Every edge is then oriented from the endpoint of lower degree to the
+ * one of higher degree, ties broken by index, and the out lists are sorted. Every triangle u, v, w then shows up exactly once, as
+ * the w in both the out lists of u and v for its oriented edge u->v, and no out list is longer than the square root of twice the
+ * number of edges, which bounds the work by O(m^1.5) however skewed the degrees.
+ *
+ * The intersection of the two out lists is done by one of the #kernel. #merge walks both lists; #galloping looks every element
+ * of the shorter list up in the longer one by exponential search, which wins when one is much longer; #simd compares blocks of
+ * four against four with SSE2, which every x86-64 compiler enables, and falls back to #merge elsewhere. #adaptive gallops when one
+ * list is over 32 times the other and uses #simd otherwise.
+ *
+ * The vertices are handed out to the threads in chunks from a shared counter, so that the expensive ones do not pile up on one
+ * thread. For the triangles of every vertex each thread keeps its own counts, which are added up at the end.
+ */
+template <class stats = defaultStatsPolicy>
+class graphTriangles
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+	typedef unsigned long long countType;	///< Type of the triangle and wedge counts
+	typedef propertyMap<countType> countMap;	///< Triangles of every vertex
+
+	///@brief Kernels to intersect two sorted lists
+	enum kernel
+	{
+		merge,		///< Walk both lists together
+		galloping,	///< Exponential search of the shorter list in the longer one
+		simd,		///< Compare blocks of four against four, #merge where SSE2 is missing
+		adaptive	///< #galloping for lists of very different lengths, #simd otherwise
+	};
+
+private:
+	csrGraph m_oriented;	///< Member to hold the edges oriented towards the higher degree, sorted by target
+	std::vector<size_t> m_degree;	///< Member to hold the degree of every vertex once loops and parallel edges are dropped
+
+	///@brief Member function to orient the edges of a graph holding both their directions
+	void init(const csrGraph& g)
+	{
+		size_t n = g.numVertices();
+		std::vector<std::vector<vertexId> > adjacency(n);
+		for (vertexId u = 0; u < n; u++)
+		{
+			for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				if (g.targets[slot] != u) adjacency[u].push_back(g.targets[slot]);
+			std::sort(adjacency[u].begin(), adjacency[u].end());
+			adjacency[u].erase(std::unique(adjacency[u].begin(), adjacency[u].end()), adjacency[u].end());
+		}
+		m_degree.resize(n);
+		for (vertexId u = 0; u < n; u++) m_degree[u] = adjacency[u].size();
+		m_oriented.offsets.assign(n + 1, 0);
+		for (vertexId u = 0; u < n; u++)
+		{
+			for (size_t i = 0; i < adjacency[u].size(); i++)
+				if (true == before(u, adjacency[u][i])) m_oriented.targets.push_back(adjacency[u][i]);
+			m_oriented.offsets[u+1] = m_oriented.targets.size();
+			std::vector<vertexId>().swap(adjacency[u]);
+		}
+		m_oriented.edgeIndex.assign(m_oriented.targets.size(), 0);
+	}
+
+	///@brief Member function to tell if the edge u-v is oriented from u to v
+	bool before(vertexId u, vertexId v) const
+	{
+		return (m_degree[u] != m_degree[v]) ? (m_degree[u] < m_degree[v]) : (u < v);
+	}
+
+	///@brief Visitor of the common elements which only counts them
+	struct countOnly
+	{
+		///@brief Member function called on every common element
+		void operator() (vertexId) {}
+	};
+
+	///@brief Visitor of the common elements which counts a triangle for each of them
+	struct creditThird
+	{
+		countType* counts;	///< Member to hold the counts of the thread
+		///@brief Member function called on every common element, the third vertex of a triangle
+		void operator() (vertexId w) {counts[w]++;}
+	};
+
+	///@brief Function to intersect by walking both lists, adding the elements it steps over to visited
+	template <class visitor>
+	static countType mergeKernel(const vertexId* a, size_t na, const vertexId* b, size_t nb, visitor& visit, size_t& visited)
+	{
+		countType retVal = 0;
+		size_t i = 0, j = 0;
+		while (i < na && j < nb)
+		{
+			if (a[i] == b[j])
+			{
+				visit(a[i]);
+				retVal++;
+				i++;
+				j++;
+			}
+			else if (a[i] < b[j]) i++;
+			else j++;
+		}
+		visited += i + j;
+		return retVal;
+	}
+
+	///@brief Function to intersect by exponential search of every element of the shorter list a in the longer list b
+	template <class visitor>
+	static countType gallopingKernel(const vertexId* a, size_t na, const vertexId* b, size_t nb, visitor& visit, size_t& visited)
+	{
+		countType retVal = 0;
+		size_t j = 0;
+		for (size_t i = 0; i < na && j < nb; i++)
+		{
+			// Doubles the step until b[j + step] is not below a[i], then searches the last step
+			size_t step = 1;
+			while (j + step < nb && b[j + step] < a[i]) step *= 2;
+			j = std::lower_bound(b + j + step / 2, b + std::min(j + step + 1, nb), a[i]) - b;
+			if (j < nb && b[j] == a[i])
+			{
+				visit(a[i]);
+				retVal++;
+				j++;
+			}
+		}
+		visited += na;
+		return retVal;
+	}
+
+	///@brief Function to intersect by comparing blocks of four elements of each list, finishing with #mergeKernel
+	template <class visitor>
+	static countType simdKernel(const vertexId* a, size_t na, const vertexId* b, size_t nb, visitor& visit, size_t& visited)
+	{
+		countType retVal = 0;
+		size_t i = 0, j = 0;
+#ifdef __SSE2__
+		while (i + 4 <= na && j + 4 <= nb)
+		{
+			for (int mask = sortedBlocks::matches(a + i, b + j); 0 != mask; mask &= mask - 1)
+			{
+				visit(a[i + __builtin_ctz(mask)]);
+				retVal++;
+			}
+			vertexId lastA = a[i + 3], lastB = b[j + 3];
+			i += (lastA <= lastB) ? 4 : 0;
+			j += (lastB <= lastA) ? 4 : 0;
+		}
+		visited += i + j;
+#endif
+		return retVal + mergeKernel(a + i, na - i, b + j, nb - j, visit, visited);
+	}
+
+	/**
+	 * @brief Function to intersect two sorted lists with the given kernel, calling the visitor on every common element
+	 * @details The elements stepped over are added to visited instead of the stats, since the threads of a count share the stats.
+	 */
+	template <class visitor>
+	static countType intersect(kernel k, const vertexId* a, size_t na, const vertexId* b, size_t nb, visitor& visit, size_t& visited)
+	{
+		if (na > nb)
+		{
+			std::swap(a, b);
+			std::swap(na, nb);
+		}
+		if (0 == na) return 0;
+		if (galloping == k || (adaptive == k && na * 32 < nb)) return gallopingKernel(a, na, b, nb, visit, visited);
+		if (merge == k) return mergeKernel(a, na, b, nb, visit, visited);
+		return simdKernel(a, na, b, nb, visit, visited);
+	}
+
+	/**
+	 * @brief State shared by the threads of a count
+	 */
+	struct countState
+	{
+		const graphTriangles* p;	///< Member to hold the triangles
+		kernel k;	///< Member to hold the kernel
+		std::atomic<size_t> next;	///< Member to hold the first vertex of the next chunk
+		std::vector<countType> total;	///< Member to hold the triangles found by every thread
+		std::vector<size_t> visited;	///< Member to hold the list elements stepped over by every thread
+		std::vector<std::vector<countType> > local;	///< Member to hold the triangles of every vertex counted by every thread, if wanted
+	};
+
+	///@brief Function run by every thread of a count
+	static void countRange(countState* s, size_t thread)
+	{
+		const csrGraph& g = s->p->m_oriented;
+		const size_t chunk = 64, n = g.numVertices();
+		bool wantLocal = (false == s->local.empty());
+		countType* counts = (true == wantLocal) ? &s->local[thread][0] : NULL;
+		countOnly countVisitor;
+		creditThird creditVisitor = {counts};
+		countType total = 0;
+		size_t visited = 0;
+		for (size_t begin = s->next.fetch_add(chunk); begin < n; begin = s->next.fetch_add(chunk))
+			for (vertexId u = vertexId(begin); u < std::min(begin + chunk, n); u++)
+				for (size_t slot = g.offsets[u]; slot < g.offsets[u+1]; slot++)
+				{
+					vertexId v = g.targets[slot];
+					if (false == wantLocal)
+					{
+						total += intersect(s->k, g.neighborBegin(u), g.degree(u), g.neighborBegin(v), g.degree(v), countVisitor, visited);
+						continue;
+					}
+					countType found = intersect(s->k, g.neighborBegin(u), g.degree(u), g.neighborBegin(v), g.degree(v), creditVisitor, visited);
+					counts[u] += found;
+					counts[v] += found;
+					total += found;
+				}
+		s->total[thread] = total;
+		s->visited[thread] = visited;
+	}
+
+	///@brief Member function to run a count on the given threads, with the triangles of every vertex if local is not NULL
+	countType run(kernel k, size_t noOfThreads, countMap* local) const
+	{
+		size_t n = m_oriented.numVertices();
+		if (NULL != local) *local = countMap(n, 0);
+		if (0 == n) return 0;
+		noOfThreads = std::max<size_t>(1, noOfThreads);
+		countState s;
+		s.p = this;
+		s.k = k;
+		s.next = 0;
+		s.total.assign(noOfThreads, 0);
+		s.visited.assign(noOfThreads, 0);
+		if (NULL != local) s.local.assign(noOfThreads, std::vector<countType>(n, 0));
+		forkJoin(noOfThreads, countRange, &s);
+		countType retVal = 0;
+		for (size_t t = 0; t < noOfThreads; t++)
+		{
+			retVal += s.total[t];
+			stats::edgeVisit(s.visited[t]);
+		}
+		if (NULL != local)
+		{
+			for (size_t t = 0; t < noOfThreads; t++)
+				for (size_t v = 0; v < n; v++) (*local)[v] += s.local[t][v];
+		}
+		return retVal;
+	}
+
+public:
+	/**
+	 * @brief Constructor to set up the counting on a #csrGraph
+	 * @param	g	The graph, a symmetric #csrGraph
+	 */
+	explicit graphTriangles(const csrGraph& g)
+	{
+		init(g);
+	}
+
+	/**
+	 * @brief Constructor to set up the counting on a #graph
+	 * @param	g	The graph, a #graphTraits::bidirectional one, whose vertex indices are the ids of the counts
+	 */
+	template <typename nodeProperties, typename edgeProperties, typename graphType, typename nodeContainer, typename edgeContainer>
+	explicit graphTriangles(graph<nodeProperties,edgeProperties,graphType,nodeContainer,edgeContainer>& g)
+	{
+		init(csrGraph(g));
+	}
+
+	///@brief Member function to get the number of vertices
+	size_t numVertices() const {return m_degree.size();}
+
+	///@brief Member function to get the number of edges, without loops and parallel edges
+	size_t numEdges() const {return m_oriented.numSlots();}
+
+	///@brief Member function to get the degree of v, without loops and parallel edges
+	size_t degree(vertexId v) const {return m_degree[v];}
+
+	///@brief Function to tell if the #simd kernel really uses SIMD instructions in this build
+	static bool simdAvailable() {return sortedBlocks::available();}
+
+	/**
+	 * @brief Member function to count the triangles of the graph
+	 * @param	k			Kernel intersecting the lists
+	 * @param	noOfThreads	Number of threads sharing the vertices
+	 * @return The number of triangles
+	 */
+	countType count(kernel k = adaptive, size_t noOfThreads = 1) const
+	{
+		return run(k, noOfThreads, NULL);
+	}
+
+	/**
+	 * @brief Member function to count the triangles of every vertex
+	 * @copydetails count
+	 * @param	total	Set to the number of triangles of the graph
+	 * @return The triangles every vertex is a corner of
+	 */
+	countMap local(kernel k = adaptive, size_t noOfThreads = 1, countType* total = NULL) const
+	{
+		countMap retVal;
+		countType triangles = run(k, noOfThreads, &retVal);
+		if (NULL != total) *total = triangles;
+		return retVal;
+	}
+
+	///@brief Member function to get the number of wedges, the paths of two edges, which is the sum of d(d-1)/2 over the vertices
+	countType wedges() const
+	{
+		countType retVal = 0;
+		for (size_t v = 0; v < m_degree.size(); v++) retVal += countType(m_degree[v]) * (m_degree[v] - 1) / 2;
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to get the global clustering coefficient, the fraction of wedges closed into a triangle
+	 * @param	triangles	The number of triangles, as given by #count
+	 * @return 3 triangles / wedges, 0 without wedges
+	 */
+	double globalClustering(countType triangles) const
+	{
+		countType w = wedges();
+		return (0 == w) ? 0 : 3.0 * double(triangles) / double(w);
+	}
+
+	/**
+	 * @brief Member function to get the local clustering coefficient of every vertex, the fraction of the pairs of its neighbors
+	 * which are adjacent
+	 * @param	triangles	The triangles of every vertex, as given by #local
+	 * @return The coefficient of every vertex, 0 for the vertices with less than two neighbors
+	 */
+	propertyMap<double> localClustering(const countMap& triangles) const
+	{
+		propertyMap<double> retVal(m_degree.size(), 0);
+		for (size_t v = 0; v < m_degree.size(); v++)
+			if (m_degree[v] > 1) retVal[v] = 2.0 * double(triangles[v]) / (double(m_degree[v]) * double(m_degree[v] - 1));
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to get the average of the local clustering coefficients
+	 * @param	triangles	The triangles of every vertex, as given by #local
+	 * @return The average over the vertices with at least two neighbors, 0 if there are none
+	 */
+	double averageClustering(const countMap& triangles) const
+	{
+		propertyMap<double> coefficient = localClustering(triangles);
+		double sum = 0;
+		size_t counted = 0;
+		for (size_t v = 0; v < m_degree.size(); v++)
+			if (m_degree[v] > 1)
+			{
+				sum += coefficient[v];
+				counted++;
+			}
+		return (0 == counted) ? 0 : sum / double(counted);
+	}
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHTRIANGLES_HPP_ */
@@ -0,0 +1,309 @@
+/**
+ * @file GraphVersioned.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains a multi-version adjacency which takes batches of edge insertions and deletions while readers keep
+ *  querying immutable snapshots of it. Versions share the vertex blocks they did not change and retired versions are reclaimed
+ *  with epoch based reclamation, so readers never take a lock nor touch a reference count.
+ */
+
+#ifndef UTILS_GRAPH_INCLUDE_GRAPHVERSIONED_HPP_
+#define UTILS_GRAPH_INCLUDE_GRAPHVERSIONED_HPP_
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <stdint.h>
+#include "GraphCSR.hpp"
+
+/**
+ * @brief Versioned adjacency with snapshot isolation for readers
+ * @details The vertices are split in blocks of 2^blockBits consecutive ids, every block holding the sorted rows of its vertices
+ * like a small #csrGraph. A version is an array of pointers to immutable blocks. #applyBatch builds the next version by copying
+ * that array and rebuilding only the blocks touched by the batch, then publishes it with a single atomic store. @n
+ * A #reader pins the current version by announcing the global epoch in its own slot. The version replaced by a batch is retired
+ * with the epoch at that time and freed once every pinned reader has announced a later epoch, i.e. once no reader can still see
+ * it. Blocks are reference counted, but only the writer creates and destroys versions, so readers never touch the counts. @n
+ * Batches are applied by one writer at a time, concurrent calls of #applyBatch are serialized.
+ */
+class versionedGraph
+{
+public:
+	typedef csrGraph::vertexId vertexId;	///< @copybrief csrGraph::vertexId
+
+	///@brief Insertion or deletion of the arc source->sink
+	struct edgeUpdate
+	{
+		vertexId source;	///< Member to hold the source of the arc
+		vertexId sink;	///< Member to hold the sink of the arc
+		bool insert;	///< Member to hold whether the arc is inserted or deleted
+		///@brief Triple argument constructor
+		edgeUpdate(vertexId source, vertexId sink, bool insert = true) : source(source),sink(sink),insert(insert){}
+	};
+
+private:
+	///@brief Immutable rows of 2^blockBits consecutive vertices
+	struct vertexBlock
+	{
+		std::vector<size_t> offsets;	///< Member to hold the first position in targets of every row, plus the end
+		std::vector<vertexId> targets;	///< Member to hold the rows
+	};
+
+public:
+	/**
+	 * @brief Immutable version of the graph
+	 * @details It provides the same read interface as #csrGraph, so the graph algorithms templated on the graph type run on it.
+	 */
+	class snapshot
+	{
+		friend class versionedGraph;
+		std::vector<std::shared_ptr<const vertexBlock> > m_blocks;	///< Member to hold the blocks of this version
+		size_t m_vertices;	///< Member to hold the number of vertices
+		size_t m_slots;	///< Member to hold the number of arcs
+		uint64_t m_version;	///< Member to hold the number of batches applied before this version
+		unsigned int m_blockBits;	///< Member to hold the log2 of the vertices per block
+	public:
+		typedef const vertexId* neighborIterator;	///< @copybrief csrGraph::neighborIterator
+		///@brief Constructor of an empty version
+		explicit snapshot(unsigned int blockBits) : m_vertices(0),m_slots(0),m_version(0),m_blockBits(blockBits){}
+		///@copydoc csrGraph::numVertices
+		size_t numVertices() const {return m_vertices;}
+		///@copydoc csrGraph::numSlots
+		size_t numSlots() const {return m_slots;}
+		///@brief Member function to get the number of batches applied before this version
+		uint64_t version() const {return m_version;}
+		///@copydoc csrGraph::degree
+		size_t degree(vertexId v) const
+		{
+			const vertexBlock& b = *m_blocks[v >> m_blockBits];
+			size_t row = v & ((1u << m_blockBits) - 1);
+			return b.offsets[row+1] - b.offsets[row];
+		}
+		///@copydoc csrGraph::neighborBegin
+		neighborIterator neighborBegin(vertexId v) const
+		{
+			const vertexBlock& b = *m_blocks[v >> m_blockBits];
+			return b.targets.empty() ? NULL : &b.targets[0] + b.offsets[v & ((1u << m_blockBits) - 1)];
+		}
+		///@copydoc csrGraph::neighborEnd
+		neighborIterator neighborEnd(vertexId v) const
+		{
+			const vertexBlock& b = *m_blocks[v >> m_blockBits];
+			return b.targets.empty() ? NULL : &b.targets[0] + b.offsets[(v & ((1u << m_blockBits) - 1)) + 1];
+		}
+		///@brief Member function to get the number of blocks shared with another version
+		size_t sharedBlocks(const snapshot& that) const
+		{
+			size_t retVal = 0;
+			for (size_t b = 0; b < m_blocks.size() && b < that.m_blocks.size(); b++) retVal += (m_blocks[b] == that.m_blocks[b]);
+			return retVal;
+		}
+	};
+
+private:
+	///@brief Epoch announced by a reader, padded to a cache line so that readers do not share lines
+	struct readerSlot
+	{
+		std::atomic<uint64_t> epoch;	///< Member to hold the epoch the reader pinned, #idle when not pinned
+		std::atomic<bool> used;	///< Member to hold whether a #reader owns the slot
+		char padding[64 - sizeof(std::atomic<uint64_t>) - sizeof(std::atomic<bool>)];	///< Padding to a cache line
+		readerSlot() : epoch(idle()),used(false){}	///< Default constructor
+	};
+
+	std::atomic<const snapshot*> m_current;	///< Member to hold the latest version
+	std::atomic<uint64_t> m_epoch;	///< Member to hold the global epoch
+	std::vector<readerSlot> m_readers;	///< Member to hold the slots of the readers
+	std::deque<std::pair<uint64_t, const snapshot*> > m_retired;	///< Member to hold the replaced versions with their retire epoch
+	std::shared_ptr<const vertexBlock> m_emptyBlock;	///< Member to hold the block of vertices without arcs
+	std::mutex m_writer;	///< Member to serialize the writers
+	size_t m_reclaimed;	///< Member to hold the number of versions freed so far
+
+	///@brief Member function to get the epoch of a slot which is not pinned
+	static uint64_t idle() {return ~uint64_t(0);}
+
+	///@brief Member function to make the block array of s cover all of its vertices
+	void coverVertices(snapshot& s) const
+	{
+		size_t noOfBlocks = (s.m_vertices + (size_t(1) << s.m_blockBits) - 1) >> s.m_blockBits;
+		if (s.m_blocks.size() < noOfBlocks) s.m_blocks.resize(noOfBlocks, m_emptyBlock);
+	}
+
+	/**
+	 * @brief Member function to free the retired versions no reader can see anymore
+	 * @details A version retired at epoch r may still be in use by a reader which announced an epoch up to r, as such a reader
+	 * may have loaded the current version before it was replaced.
+	 */
+	void reclaim()
+	{
+		uint64_t oldest = idle();
+		for (size_t i = 0; i < m_readers.size(); i++) oldest = std::min(oldest, m_readers[i].epoch.load());
+		while (false == m_retired.empty() && m_retired.front().first < oldest)
+		{
+			delete m_retired.front().second;
+			m_retired.pop_front();
+			m_reclaimed++;
+		}
+	}
+
+	versionedGraph(const versionedGraph&);	///< Not copyable
+	versionedGraph& operator= (const versionedGraph&);	///< Not assignable
+
+public:
+	/**
+	 * @brief Constructor to make the first version out of a #csrGraph
+	 * @param	g			The initial graph
+	 * @param	blockBits	Log2 of the number of vertices per block. Smaller blocks copy less per batch but make a version larger.
+	 * @param	maxReaders	Number of #reader objects which can exist at once
+	 */
+	explicit versionedGraph(const csrGraph& g, unsigned int blockBits = 6, size_t maxReaders = 64) :
+		m_current(NULL),m_epoch(0),m_readers(maxReaders),m_emptyBlock(new vertexBlock()),m_reclaimed(0)
+	{
+		std::shared_ptr<vertexBlock> empty = std::const_pointer_cast<vertexBlock>(m_emptyBlock);
+		empty->offsets.assign((size_t(1) << blockBits) + 1, 0);
+		snapshot* first = new snapshot(blockBits);
+		first->m_vertices = g.numVertices();
+		first->m_slots = g.numSlots();
+		size_t blockSize = size_t(1) << blockBits;
+		for (size_t start = 0; start < g.numVertices(); start += blockSize)
+		{
+			std::shared_ptr<vertexBlock> b(new vertexBlock());
+			b->offsets.assign(blockSize + 1, 0);
+			for (size_t row = 0; row < blockSize; row++)
+			{
+				vertexId v = vertexId(start + row);
+				if (v < g.numVertices())
+				{
+					b->targets.insert(b->targets.end(), g.neighborBegin(v), g.neighborEnd(v));
+					std::sort(b->targets.begin() + b->offsets[row], b->targets.end());
+				}
+				b->offsets[row+1] = b->targets.size();
+			}
+			first->m_blocks.push_back(b);
+		}
+		m_current.store(first);
+	}
+
+	///@brief Destructor, no #reader may be alive
+	~versionedGraph()
+	{
+		for (size_t i = 0; i < m_retired.size(); i++) delete m_retired[i].second;
+		delete m_current.load();
+	}
+
+	/**
+	 * @brief Member function to apply a batch of updates as a new version
+	 * @param	batch	The updates, applied in order. Ids past the last vertex add vertices. Deleting an arc which does not exist
+	 * is ignored, deleting one of parallel arcs removes only one of them.
+	 * @details Only the blocks holding a source of the batch are copied, the others are shared with the previous version.
+	 * Readers pinned on the previous version keep seeing it unchanged.
+	 * @return The number of updates which changed the graph
+	 */
+	size_t applyBatch(const std::vector<edgeUpdate>& batch)
+	{
+		std::lock_guard<std::mutex> lock(m_writer);
+		const snapshot* current = m_current.load();
+		snapshot* next = new snapshot(*current);
+		next->m_version++;
+		unsigned int bits = next->m_blockBits;
+		size_t blockSize = size_t(1) << bits;
+		for (size_t i = 0; i < batch.size(); i++)
+			next->m_vertices = std::max(next->m_vertices, size_t(std::max(batch[i].source, batch[i].sink)) + 1);
+		coverVertices(*next);
+		std::vector<std::pair<size_t,size_t> > order(batch.size());
+		for (size_t i = 0; i < order.size(); i++) order[i] = std::make_pair(size_t(batch[i].source >> bits), i);
+		std::sort(order.begin(), order.end());
+		std::vector<std::vector<vertexId> > rows(blockSize);
+		size_t retVal = 0;
+		for (size_t i = 0; i < order.size(); )
+		{
+			size_t block = order[i].first;
+			const vertexBlock& old = *next->m_blocks[block];
+			for (size_t row = 0; row < blockSize; row++) rows[row].assign(old.targets.begin() + old.offsets[row], old.targets.begin() + old.offsets[row+1]);
+			for (; i < order.size() && order[i].first == block; i++)
+			{
+				const edgeUpdate& u = batch[order[i].second];
+				std::vector<vertexId>& row = rows[u.source & (blockSize - 1)];
+				std::vector<vertexId>::iterator at = std::lower_bound(row.begin(), row.end(), u.sink);
+				if (u.insert) row.insert(at, u.sink);
+				else if (at != row.end() && *at == u.sink) row.erase(at);
+				else continue;
+				next->m_slots = u.insert ? next->m_slots + 1 : next->m_slots - 1;
+				retVal++;
+			}
+			std::shared_ptr<vertexBlock> b(new vertexBlock());
+			b->offsets.assign(blockSize + 1, 0);
+			for (size_t row = 0; row < blockSize; row++)
+			{
+				b->targets.insert(b->targets.end(), rows[row].begin(), rows[row].end());
+				b->offsets[row+1] = b->targets.size();
+			}
+			next->m_blocks[block] = b;
+		}
+		m_current.store(next);
+		m_retired.push_back(std::make_pair(m_epoch.fetch_add(1), current));
+		reclaim();
+		return retVal;
+	}
+
+	///@brief Member function to get the latest version, only to be read by a pinned #reader or when no batch is being applied
+	const snapshot& current() const {return *m_current.load();}
+
+	///@brief Member function to get the number of replaced versions not freed yet
+	size_t retiredVersions()
+	{
+		std::lock_guard<std::mutex> lock(m_writer);
+		return m_retired.size();
+	}
+
+	///@brief Member function to get the number of replaced versions freed so far
+	size_t reclaimedVersions()
+	{
+		std::lock_guard<std::mutex> lock(m_writer);
+		return m_reclaimed;
+	}
+
+	/**
+	 * @brief Reader of a #versionedGraph, one per thread
+	 * @details The constructor takes one of the reader slots, waiting while all of them are taken. Between #pin and #unpin the
+	 * pinned version stays alive and unchanged whatever batches are applied meanwhile. Pins do not nest.
+	 */
+	class reader
+	{
+		versionedGraph& m_graph;	///< Member to hold the graph being read
+		size_t m_slot;	///< Member to hold the slot owned by this reader
+		reader(const reader&);	///< Not copyable
+		reader& operator= (const reader&);	///< Not assignable
+	public:
+		///@brief Constructor to take a reader slot of g
+		explicit reader(versionedGraph& g) : m_graph(g),m_slot(0)
+		{
+			for (;; std::this_thread::yield())
+				for (m_slot = 0; m_slot < g.m_readers.size(); m_slot++)
+				{
+					bool expected = false;
+					if (g.m_readers[m_slot].used.compare_exchange_strong(expected, true)) return;
+				}
+		}
+		///@brief Destructor to give the slot back
+		~reader()
+		{
+			unpin();
+			m_graph.m_readers[m_slot].used.store(false);
+		}
+		///@brief Member function to pin the latest version
+		const snapshot& pin()
+		{
+			m_graph.m_readers[m_slot].epoch.store(m_graph.m_epoch.load());
+			return *m_graph.m_current.load();
+		}
+		///@brief Member function to release the pinned version
+		void unpin() {m_graph.m_readers[m_slot].epoch.store(idle());}
+	};
+};
+
+#endif /* UTILS_GRAPH_INCLUDE_GRAPHVERSIONED_HPP_ */
@@ -12,6 +12,7 @@
 #include <vector>
 #include <list>
 #include "GraphTraits.hpp"
+#include "GraphRemoval.hpp"
 
 using namespace std;
 /**
@@ -65,6 +66,12 @@ protected:
 public:
 	decompileFlavor decompileType;	///< Varaible to keep the decompile flavor of this graph
 	nodeListContainerType nodeList;	///< The list of vertices in this graph
+	size_t edgeCount;	///< Bound of the dense #edge::index given out so far, the next index to be given out
+	size_t removedVertices;	///< Number of vertices removed since the last #compact, still kept in nodeList
+	size_t removedEdges;	///< Number of edges removed since the last #compact, whose indices are not reused until then
+
+	///@brief Default constructor
+	base_graph() : decompileType(graphTraits::Nodes),edgeCount(0),removedVertices(0),removedEdges(0){}
 
 	/**
 	 * @brief Operator[] to provide access to user defined node properties of a vertex of this graph
@@ -95,14 +102,67 @@ public:
 	{
 		this->nodeList.push_back(v);
 		vertexDescriptor retval = (this->nodeList.end());
-		return --retval;
+		(--retval)->index = this->nodeList.size() - 1;
+		return retval;
 	}
 	///@brief Member function to set the decompile flavor of the graph
 	void setDecompileFlavor (decompileFlavor e) { this->decompileType = e;}
 	///@brief Member function to get the decompile flavor of the graph
 	decompileFlavor getDecompileFlavor () { return this->decompileType;}
-	///@brief Member function to get the size of the graph
+	///@brief Member function to get the size of the graph, i.e. the bound of the vertex indices, including removed vertices until #compact
 	size_t size() {return nodeList.size();}
+	///@brief Member function to get the number of vertices of the graph which are not removed
+	size_t numLiveVertices() {return nodeList.size() - removedVertices;}
+	///@brief Member function to get the number of edges of the graph. A #graphTraits::bidirectional edge is counted once.
+	size_t numEdges() {return edgeCount - removedEdges;}
+
+	/**
+	 * @brief Member function to remove an edge from this graph
+	 * @param	source	The vertex descriptor of the vertex owning e
+	 * @param	e		The edge descriptor of the edge to be removed, taken from the out edges of source
+	 * @details The edge is unlinked from both of its ends at a cost proportional to their degrees. For a #graphTraits::bidirectional
+	 * graph e can be taken from either end. Descriptors of the other edges stay valid with #graphTraits::listStorage edges.
+	 */
+	void removeEdge(vertexDescriptor& source, edgeDescriptor e)
+	{
+		graphRemoval<graphType>::removeEdge(&(*source), e);
+		removedEdges++;
+	}
+
+	/**
+	 * @brief Member function to remove a vertex from this graph
+	 * @param	v	The vertex descriptor of the vertex to be removed
+	 * @details All the edges of v are removed, at a cost proportional to the degrees of v and of its neighbors, and v is marked
+	 * #base_vertex::removed. The vertex itself stays in nodeList with its index, isolated, until #compact, so the descriptors and
+	 * indices of all the other vertices stay valid and #propertyMap and #csrGraph keep working.
+	 */
+	void removeVertex(vertexDescriptor& v)
+	{
+		if (v->removed) return;
+		removedEdges += graphRemoval<graphType>::isolate(&(*v));
+		v->removed = true;
+		removedVertices++;
+	}
+
+	///@brief Member function to remove all the vertices and edges of this graph
+	void clear()
+	{
+		nodeList.clear();
+		edgeCount = removedVertices = removedEdges = 0;
+	}
+
+	/**
+	 * @brief Member function to reclaim the removed vertices and the indices of the removed edges
+	 * @details The removed vertices are erased and the remaining vertices and edges get dense indices again in their current order.
+	 * With #graphTraits::listStorage vertices the descriptors of the remaining vertices stay valid, with #graphTraits::vectorStorage
+	 * they are invalidated.
+	 * @return The mapping from the old to the new indices, see #propertyMap::remap
+	 */
+	graphCompaction compact()
+	{
+		removedVertices = removedEdges = 0;
+		return compactGraph<graphType>(nodeList, edgeCount);
+	}
 };
 
 /**
@@ -127,6 +187,10 @@ protected:
 public:
 	decompileFlavor decompileType;	///<@copybrief base_graph::decompileType
 	nodeListContainerType nodeList;	///<@copybrief base_graph::nodeList
+	size_t edgeCount;	///<@copybrief base_graph::edgeCount
+	size_t removedVertices;	///<@copybrief base_graph::removedVertices
+	size_t removedEdges;	///<@copybrief base_graph::removedEdges
+	base_graph() : decompileType(graphTraits::Nodes),edgeCount(0),removedVertices(0),removedEdges(0){}	///<@copybrief base_graph::base_graph
 	///@copydoc base_graph::operator[](vertexDescriptor& v)
 	nodeProperties* operator[] (vertexDescriptor& v) {return *v;}
 	///@copydoc base_graph::operator[](edgeDescriptor& e)
@@ -138,7 +202,8 @@ public:
 	{
 		this->nodeList.push_back(v);
 		vertexDescriptor retval = (this->nodeList.end());
-		return --retval;
+		(--retval)->index = this->nodeList.size() - 1;
+		return retval;
 	}
 	///@copydoc base_graph::setDecompileFlavor
 	void setDecompileFlavor (decompileFlavor e) { this->decompileType = e;}
@@ -146,6 +211,36 @@ public:
 	decompileFlavor getDecompileFlavor () { return this->decompileType;}
 	///@copydoc base_graph::size
 	size_t size() {return nodeList.size();}
+	///@copydoc base_graph::numLiveVertices
+	size_t numLiveVertices() {return nodeList.size() - removedVertices;}
+	///@copydoc base_graph::numEdges
+	size_t numEdges() {return edgeCount - removedEdges;}
+	///@copydoc base_graph::removeEdge
+	void removeEdge(vertexDescriptor& source, edgeDescriptor e)
+	{
+		graphRemoval<graphType>::removeEdge(&(*source), e);
+		removedEdges++;
+	}
+	///@copydoc base_graph::removeVertex
+	void removeVertex(vertexDescriptor& v)
+	{
+		if (v->removed) return;
+		removedEdges += graphRemoval<graphType>::isolate(&(*v));
+		v->removed = true;
+		removedVertices++;
+	}
+	///@copydoc base_graph::clear
+	void clear()
+	{
+		nodeList.clear();
+		edgeCount = removedVertices = removedEdges = 0;
+	}
+	///@copydoc base_graph::compact
+	graphCompaction compact()
+	{
+		removedVertices = removedEdges = 0;
+		return compactGraph<graphType>(nodeList, edgeCount);
+	}
 };
 
 /**
@@ -170,6 +265,10 @@ protected:
 public:
 	decompileFlavor decompileType;	///<@copybrief base_graph::decompileType
 	nodeListContainerType nodeList;	///<@copybrief base_graph::nodeList
+	size_t edgeCount;	///<@copybrief base_graph::edgeCount
+	size_t removedVertices;	///<@copybrief base_graph::removedVertices
+	size_t removedEdges;	///<@copybrief base_graph::removedEdges
+	base_graph() : decompileType(graphTraits::Nodes),edgeCount(0),removedVertices(0),removedEdges(0){}	///<@copybrief base_graph::base_graph
 	///@copydoc base_graph::operator[](vertexDescriptor& v)
 	nodeProperties* operator[] (vertexDescriptor& v) {return *v;}
 	///@copydoc base_graph::operator[](edgeDescriptor& e)
@@ -181,7 +280,8 @@ public:
 	{
 		this->nodeList.push_back(v);
 		vertexDescriptor retval = (this->nodeList.end());
-		return --retval;
+		(--retval)->index = this->nodeList.size() - 1;
+		return retval;
 	}
 	///@copydoc base_graph::setDecompileFlavor
 	void setDecompileFlavor (decompileFlavor e) { this->decompileType = e;}
@@ -189,6 +289,36 @@ public:
 	decompileFlavor getDecompileFlavor () { return this->decompileType;}
 	///@copydoc base_graph::size
 	size_t size() {return nodeList.size();}
+	///@copydoc base_graph::numLiveVertices
+	size_t numLiveVertices() {return nodeList.size() - removedVertices;}
+	///@copydoc base_graph::numEdges
+	size_t numEdges() {return edgeCount - removedEdges;}
+	///@copydoc base_graph::removeEdge
+	void removeEdge(vertexDescriptor& source, edgeDescriptor e)
+	{
+		graphRemoval<graphType>::removeEdge(&(*source), e);
+		removedEdges++;
+	}
+	///@copydoc base_graph::removeVertex
+	void removeVertex(vertexDescriptor& v)
+	{
+		if (v->removed) return;
+		removedEdges += graphRemoval<graphType>::isolate(&(*v));
+		v->removed = true;
+		removedVertices++;
+	}
+	///@copydoc base_graph::clear
+	void clear()
+	{
+		nodeList.clear();
+		edgeCount = removedVertices = removedEdges = 0;
+	}
+	///@copydoc base_graph::compact
+	graphCompaction compact()
+	{
+		removedVertices = removedEdges = 0;
+		return compactGraph<graphType>(nodeList, edgeCount);
+	}
 };
 
 /**
@@ -213,6 +343,10 @@ protected:
 public:
 	decompileFlavor decompileType;	///<@copybrief base_graph::decompileType
 	nodeListContainerType nodeList;	///<@copybrief base_graph::nodeList
+	size_t edgeCount;	///<@copybrief base_graph::edgeCount
+	size_t removedVertices;	///<@copybrief base_graph::removedVertices
+	size_t removedEdges;	///<@copybrief base_graph::removedEdges
+	base_graph() : decompileType(graphTraits::Nodes),edgeCount(0),removedVertices(0),removedEdges(0){}	///<@copybrief base_graph::base_graph
 	///@copydoc base_graph::operator[](vertexDescriptor& v)
 	nodeProperties& operator[] (vertexDescriptor& v) {return *v;}
 	///@copydoc base_graph::operator[](edgeDescriptor& e)
@@ -224,7 +358,8 @@ public:
 	{
 		this->nodeList.push_back(v);
 		vertexDescriptor retval = (this->nodeList.end());
-		return --retval;
+		(--retval)->index = this->nodeList.size() - 1;
+		return retval;
 	}
 	///@copydoc base_graph::setDecompileFlavor
 	void setDecompileFlavor (decompileFlavor e) { this->decompileType = e;}
@@ -232,6 +367,36 @@ public:
 	decompileFlavor getDecompileFlavor () { return this->decompileType;}
 	///@copydoc base_graph::size
 	size_t size() {return nodeList.size();}
+	///@copydoc base_graph::numLiveVertices
+	size_t numLiveVertices() {return nodeList.size() - removedVertices;}
+	///@copydoc base_graph::numEdges
+	size_t numEdges() {return edgeCount - removedEdges;}
+	///@copydoc base_graph::removeEdge
+	void removeEdge(vertexDescriptor& source, edgeDescriptor e)
+	{
+		graphRemoval<graphType>::removeEdge(&(*source), e);
+		removedEdges++;
+	}
+	///@copydoc base_graph::removeVertex
+	void removeVertex(vertexDescriptor& v)
+	{
+		if (v->removed) return;
+		removedEdges += graphRemoval<graphType>::isolate(&(*v));
+		v->removed = true;
+		removedVertices++;
+	}
+	///@copydoc base_graph::clear
+	void clear()
+	{
+		nodeList.clear();
+		edgeCount = removedVertices = removedEdges = 0;
+	}
+	///@copydoc base_graph::compact
+	graphCompaction compact()
+	{
+		removedVertices = removedEdges = 0;
+		return compactGraph<graphType>(nodeList, edgeCount);
+	}
 };
 
 /**
@@ -266,12 +431,13 @@ public:
 	 * @param	sink	The vertex descriptor of the sink vertex of the edge to be added
 	 * @param	e		The user defined edge properties of the edge to be added
 	 * @details Since this edge is added to a bidirectional graph, both source and sink receive a outgoing edge with reverse information
-	 * The edge properties are the same for both edges
+	 * The edge properties and the dense edge index are the same for both edges
 	 */
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties& e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addOutEdge(edgeType(&(*sink),&(*source),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addOutEdge(edgeType(&(*sink),&(*source),e,index));
 	}
 
 	/**
@@ -291,6 +457,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -339,8 +506,9 @@ public:
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::addEdge
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties *e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addOutEdge(edgeType(&(*sink),&(*source),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addOutEdge(edgeType(&(*sink),&(*source),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -353,6 +521,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -401,8 +570,9 @@ public:
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::addEdge
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties& e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addOutEdge(edgeType(&(*sink),&(*source),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addOutEdge(edgeType(&(*sink),&(*source),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -415,6 +585,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -463,8 +634,9 @@ public:
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::addEdge
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties *e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addOutEdge(edgeType(&(*sink),&(*source),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addOutEdge(edgeType(&(*sink),&(*source),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -477,6 +649,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -539,8 +712,9 @@ public:
 	 */
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties& e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addInEdge(edgeType(&(*source),&(*sink),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addInEdge(edgeType(&(*source),&(*sink),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -553,6 +727,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -626,8 +801,9 @@ public:
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::directed,nodeContainer,edgeContainer>::addEdge
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties *e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addInEdge(edgeType(&(*source),&(*sink),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addInEdge(edgeType(&(*source),&(*sink),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -640,6 +816,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -713,8 +890,9 @@ public:
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::directed,nodeContainer,edgeContainer>::addEdge
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties& e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addInEdge(edgeType(&(*source),&(*sink),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addInEdge(edgeType(&(*source),&(*sink),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -727,6 +905,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -800,8 +979,9 @@ public:
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::directed,nodeContainer,edgeContainer>::addEdge
 	void addEdge (vertexDescriptor& source, vertexDescriptor& sink, edgeProperties *e)
 	{
-		source->addOutEdge(edgeType(&(*source),&(*sink),e));
-		sink->addInEdge(edgeType(&(*source),&(*sink),e));
+		size_t index = this->edgeCount++;
+		source->addOutEdge(edgeType(&(*source),&(*sink),e,index));
+		sink->addInEdge(edgeType(&(*source),&(*sink),e,index));
 	}
 	///@copydoc graph<nodeProperties,edgeProperties,graphTraits::bidirectional,nodeContainer,edgeContainer>::operator<<
 	friend ostream& operator<< (ostream& out, thisClass& g)
@@ -814,6 +994,7 @@ public:
 			vertexDescriptor v = g.vertices().first;
 			for ( ; v != g.vertices().second ; v++)
 			{
+				if (v->removed) continue;
 				out << *v;
 				for (adjVertexDescriptor adjV = v->adjVertexBegin() ; adjV != v->adjVertexEnd() ; adjV++) out <<" "<< *(*adjV);
 				out << endl;
@@ -0,0 +1,251 @@
+/**
+ *  @file FibonacciHeap.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains implementation of the Fibonacci heap, a meldable heap with O(1) amortized decreaseKey.
+ */
+#ifndef UTILS_HEAP_INCLUDE_FIBONACCIHEAP_HPP_
+#define UTILS_HEAP_INCLUDE_FIBONACCIHEAP_HPP_
+
+#include "heap.hpp"
+#include "HeapNodePool.hpp"
+
+/**
+ * @brief #fibonacciHeap provides a meldable heap with handles to its nodes
+ * @tparam T 		Type of nodes to be kept in heap.
+ * @tparam traits 	Traits of nodes which is to kept in heap, #basic_heap_min_traits or #basic_heap_max_traits.
+ * @tparam stats	Stats policy which records inserts, extracts and comparisons. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The heap is a circular list of trees. #insert and #meld only splice lists, and #decreaseKey cuts the node off its parent,
+ * cutting a parent as well once it has lost a second child, all in O(1) amortized. #extractTop moves the children of the old top
+ * to the root list and links roots of equal degree until all degrees differ, in O(log n) amortized. Nodes come from a #heapNodePool
+ * owned by the heap, and a #handle returned by #insert stays valid until its node is extracted.
+ */
+template <class T, class traits = basic_heap_min_traits<T>, class stats = defaultStatsPolicy >
+class fibonacciHeap
+{
+	///@brief Node of the heap
+	struct node
+	{
+		T value;	///< Member to hold the value of the node
+		node* parent;	///< Member to hold the parent, NULL for roots
+		node* child;	///< Member to hold any one of the children
+		node* next;	///< Member to hold the next sibling in the circular list, or the next released node while in the pool
+		node* prev;	///< Member to hold the previous sibling in the circular list
+		unsigned int degree;	///< Member to hold the number of children
+		bool marked;	///< Member to hold whether the node lost a child since it got its parent
+	};
+	node* m_top;	///< Member to hold the top of the heap, which is one of the roots
+	size_t m_size;	///< Member to hold the number of nodes in the heap
+	heapNodePool<node> m_pool;	///< Member to hold the nodes
+	std::vector<node*> m_roots;	///< Member to hold the roots while they are consolidated, kept to avoid allocating per extract
+	std::vector<node*> m_byDegree;	///< Member to hold the root of every degree while they are consolidated
+
+	fibonacciHeap(const fibonacciHeap&);	///< Heaps hand out pointers to their nodes and are not copied
+	fibonacciHeap& operator= (const fibonacciHeap&);	///< Heaps hand out pointers to their nodes and are not copied
+
+	///@brief Member function to join the circular list starting at b after a, returning a if it exists
+	static node* splice(node* a, node* b)
+	{
+		if (NULL == a) return b;
+		if (NULL == b) return a;
+		node* aNext = a->next;
+		node* bLast = b->prev;
+		a->next = b;
+		b->prev = a;
+		bLast->next = aNext;
+		aNext->prev = bLast;
+		return a;
+	}
+
+	///@brief Member function to take a node out of its circular list
+	static void unlink(node* n)
+	{
+		n->prev->next = n->next;
+		n->next->prev = n->prev;
+		n->next = n->prev = n;
+	}
+
+	///@brief Member function to make n a root, updating the top if needed
+	void addRoot(node* n)
+	{
+		n->parent = NULL;
+		n->marked = false;
+		m_top = splice(m_top, n);
+		stats::comparison();
+		if (true == traits::lt(n->value, m_top->value)) m_top = n;
+	}
+
+	///@brief Member function to cut n off its parent p and make it a root
+	void cut(node* n, node* p)
+	{
+		if (n->next == n) p->child = NULL;
+		else if (p->child == n) p->child = n->next;
+		unlink(n);
+		p->degree--;
+		addRoot(n);
+	}
+
+	///@brief Member function to link roots of equal degree until all degrees differ and find the new top
+	void consolidate()
+	{
+		m_roots.clear();
+		node* r = m_top;
+		do
+		{
+			m_roots.push_back(r);
+			r = r->next;
+		} while (r != m_top);
+		for (size_t i = 0; i < m_roots.size(); i++)
+		{
+			node* x = m_roots[i];
+			unsigned int d = x->degree;
+			while (d < m_byDegree.size() && NULL != m_byDegree[d])
+			{
+				node* y = m_byDegree[d];
+				m_byDegree[d] = NULL;
+				stats::comparison();
+				if (true == traits::lt(y->value, x->value)) std::swap(x, y);
+				unlink(y);
+				y->parent = x;
+				y->marked = false;
+				x->child = splice(x->child, y);
+				x->degree++;
+				d++;
+			}
+			if (d >= m_byDegree.size()) m_byDegree.resize(d + 1, NULL);
+			m_byDegree[d] = x;
+		}
+		m_top = NULL;
+		for (size_t d = 0; d < m_byDegree.size(); d++)
+		{
+			if (NULL == m_byDegree[d]) continue;
+			if (NULL == m_top) m_top = m_byDegree[d];
+			else
+			{
+				stats::comparison();
+				if (true == traits::lt(m_byDegree[d]->value, m_top->value)) m_top = m_byDegree[d];
+			}
+			m_byDegree[d] = NULL;
+		}
+	}
+
+public:
+	typedef node* handle;	///< Handle of a node, to be given to #decreaseKey
+
+	///@brief Constructor to initialize heap members.
+	fibonacciHeap() : m_top(NULL),m_size(0){}
+
+	///@brief Member function to get the current number of nodes
+	size_t getSize() const {return m_size;}
+
+	///@brief Member function to check whether the heap is empty
+	bool empty() const {return 0 == m_size;}
+
+	///@brief Member function to get the top element without removing it. The heap must not be empty.
+	T& top() {return m_top->value;}
+
+	///@brief Member function to get the value of a node
+	static const T& value(handle h) {return h->value;}
+
+	///@brief Member function to insert a node into the heap, returning its handle
+	handle insert(T value)
+	{
+		stats::heapInsert();
+		node* n = m_pool.allocate();
+		n->value = value;
+		n->child = NULL;
+		n->next = n->prev = n;
+		n->degree = 0;
+		addRoot(n);
+		m_size++;
+		return n;
+	}
+
+	///@brief Member function to extract the top element from the heap. Largest in case of max and smallest in case of min.
+	T extractTop()
+	{
+		stats::heapExtract();
+		node* top = m_top;
+		T retVal = top->value;
+		if (NULL != top->child)
+		{
+			node* c = top->child;
+			do
+			{
+				c->parent = NULL;
+				c->marked = false;
+				c = c->next;
+			} while (c != top->child);
+			splice(top, top->child);
+		}
+		if (top->next == top) m_top = NULL;
+		else
+		{
+			m_top = top->next;
+			unlink(top);
+			consolidate();
+		}
+		m_pool.release(top);
+		m_size--;
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to move a node towards the top by giving it a new value
+	 * @param	h		Handle of the node, still in the heap
+	 * @param	value	The new value, which must not be further from the top than the current one
+	 * @return false if the new value is further from the top, in which case nothing is changed
+	 */
+	bool decreaseKey(handle h, T value)
+	{
+		stats::comparison();
+		if (true == traits::lt(h->value, value)) return false;
+		h->value = value;
+		node* p = h->parent;
+		if (NULL == p)
+		{
+			stats::comparison();
+			if (true == traits::lt(h->value, m_top->value)) m_top = h;
+			return true;
+		}
+		stats::comparison();
+		if (false == traits::lt(h->value, p->value)) return true;
+		cut(h, p);
+		for (node* gp = p->parent; NULL != gp; gp = p->parent)
+		{
+			if (false == p->marked)
+			{
+				p->marked = true;
+				break;
+			}
+			cut(p, gp);
+			p = gp;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Member function to move all the nodes of another heap into this one
+	 * @details The handles of the nodes of other stay valid and now belong to this heap. other is left empty.
+	 */
+	void meld(fibonacciHeap& other)
+	{
+		if (&other == this || NULL == other.m_top) return;
+		node* otherTop = other.m_top;
+		if (NULL == m_top) m_top = otherTop;
+		else
+		{
+			splice(m_top, otherTop);
+			stats::comparison();
+			if (true == traits::lt(otherTop->value, m_top->value)) m_top = otherTop;
+		}
+		m_size += other.m_size;
+		m_pool.splice(other.m_pool);
+		other.m_top = NULL;
+		other.m_size = 0;
+	}
+};
+
+#endif /* UTILS_HEAP_INCLUDE_FIBONACCIHEAP_HPP_ */
@@ -0,0 +1,98 @@
+/**
+ *  @file HeapNodePool.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the block allocator of the nodes of the pointer based heaps.
+ */
+#ifndef UTILS_HEAP_INCLUDE_HEAPNODEPOOL_HPP_
+#define UTILS_HEAP_INCLUDE_HEAPNODEPOOL_HPP_
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Pool of heap nodes allocated in blocks
+ * @tparam nodeType	Node of the heap. Must be default constructible and have a member nodeType* next, which the pool uses to chain
+ * the released nodes.
+ * @details Nodes are handed out from blocks of doubling size and released nodes are reused before a new block is touched, so
+ * a heap does one allocation per doubling of its peak size instead of one per insert. Nodes never move, so pointers to them stay
+ * valid as handles. Two pools can be spliced, which lets two heaps meld without copying their nodes.
+ */
+template <class nodeType>
+class heapNodePool
+{
+	std::vector<nodeType*> m_blocks;	///< Member to hold the blocks owned by the pool
+	nodeType* m_free;	///< Member to hold the chain of released nodes
+	nodeType* m_freeTail;	///< Member to hold the last node of the chain of released nodes, so that chains splice in O(1)
+	nodeType* m_next;	///< Member to hold the next untouched node of the latest block
+	nodeType* m_end;	///< Member to hold the end of the latest block
+	size_t m_nextBlockSize;	///< Member to hold the number of nodes in the next block
+
+	heapNodePool(const heapNodePool&);	///< Pools own their blocks and are not copied
+	heapNodePool& operator= (const heapNodePool&);	///< Pools own their blocks and are not copied
+public:
+	///@brief Constructor to initialize an empty pool
+	heapNodePool() : m_free(NULL),m_freeTail(NULL),m_next(NULL),m_end(NULL),m_nextBlockSize(64){}
+
+	///@brief Destructor which frees all the blocks, whether their nodes were released or not
+	~heapNodePool()
+	{
+		for (size_t i = 0; i < m_blocks.size(); i++) delete[] m_blocks[i];
+	}
+
+	///@brief Member function to get a node, with the fields left as they were when it was released
+	nodeType* allocate()
+	{
+		if (NULL != m_free)
+		{
+			nodeType* retVal = m_free;
+			m_free = m_free->next;
+			if (NULL == m_free) m_freeTail = NULL;
+			return retVal;
+		}
+		if (m_next == m_end)
+		{
+			m_blocks.push_back(new nodeType[m_nextBlockSize]);
+			m_next = m_blocks.back();
+			m_end = m_next + m_nextBlockSize;
+			m_nextBlockSize *= 2;
+		}
+		return m_next++;
+	}
+
+	///@brief Member function to give a node back for reuse
+	void release(nodeType* n)
+	{
+		n->next = m_free;
+		m_free = n;
+		if (NULL == m_freeTail) m_freeTail = n;
+	}
+
+	/**
+	 * @brief Member function to take over all the blocks of another pool
+	 * @details Of the untouched rests of the latest blocks of both pools the larger one is kept for further allocations, the other
+	 * one is not used until the blocks are freed.
+	 */
+	void splice(heapNodePool& other)
+	{
+		m_blocks.insert(m_blocks.end(), other.m_blocks.begin(), other.m_blocks.end());
+		if (NULL != other.m_free)
+		{
+			other.m_freeTail->next = m_free;
+			if (NULL == m_freeTail) m_freeTail = other.m_freeTail;
+			m_free = other.m_free;
+		}
+		if (other.m_end - other.m_next > m_end - m_next)
+		{
+			m_next = other.m_next;
+			m_end = other.m_end;
+		}
+		if (m_nextBlockSize < other.m_nextBlockSize) m_nextBlockSize = other.m_nextBlockSize;
+		other.m_blocks.clear();
+		other.m_free = other.m_freeTail = other.m_next = other.m_end = NULL;
+		other.m_nextBlockSize = 64;
+	}
+};
+
+#endif /* UTILS_HEAP_INCLUDE_HEAPNODEPOOL_HPP_ */
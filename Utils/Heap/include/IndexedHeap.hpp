@@ -0,0 +1,180 @@
+/**
+ *  @file IndexedHeap.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains implementation of the indexed heap, a binary heap over dense ids whose keys can be changed in place.
+ */
+#ifndef UTILS_HEAP_INCLUDE_INDEXEDHEAP_HPP_
+#define UTILS_HEAP_INCLUDE_INDEXEDHEAP_HPP_
+
+#include "heap.hpp"
+
+/**
+ * @brief #indexedHeap provides a binary heap of the ids 0..n-1, each with a key which can be changed while it is in the heap
+ * @tparam keyType 	Type of the keys, a fundamental type.
+ * @tparam traits 	Traits of the keys, #basic_heap_min_traits or #basic_heap_max_traits.
+ * @tparam stats	Stats policy which records inserts, extracts, comparisons, swaps and sift depths. #noStats or #countingStats,
+ * selected by ALGOPP_STATS when not given.
+ * @details Besides the heap of ids, the keys and the heap positions are kept in arrays indexed by id, so #contains and #key are O(1)
+ * and #changeKey and #remove find the id without a search. A changed key is sifted up or down as needed, so it may get better or
+ * worse, which lazy updates of priorities rely on.
+ */
+template <class keyType, class traits = basic_heap_min_traits<keyType>, class stats = defaultStatsPolicy >
+class indexedHeap
+{
+	std::vector<size_t> m_heap;	///< Member to hold the ids in heap order
+	std::vector<keyType> m_keys;	///< Member to hold the key of every id
+	std::vector<size_t> m_position;	///< Member to hold the position of every id in m_heap, #absent() when not in the heap
+
+	///@brief Member function to get the position of the ids not in the heap
+	static size_t absent() {return size_t(-1);}
+
+	///@brief Member function to tell if the id at position a must be above the one at position b
+	bool above(size_t a, size_t b)
+	{
+		stats::comparison();
+		return traits::lt(m_keys[m_heap[a]], m_keys[m_heap[b]]);
+	}
+
+	///@brief Member function to swap the ids at two positions
+	void exchange(size_t a, size_t b)
+	{
+		stats::swap();
+		std::swap(m_heap[a], m_heap[b]);
+		m_position[m_heap[a]] = a;
+		m_position[m_heap[b]] = b;
+	}
+
+	///@brief Member function to move the id at a position up until its parent is not worse
+	void siftUp(size_t pos)
+	{
+		size_t depth = 0;
+		for (; pos > 0 && true == above(pos, (pos - 1) / 2); pos = (pos - 1) / 2, depth++) exchange(pos, (pos - 1) / 2);
+		stats::sift(depth);
+	}
+
+	///@brief Member function to move the id at a position down until no child is better
+	void siftDown(size_t pos)
+	{
+		size_t depth = 0;
+		for (;;)
+		{
+			size_t best = pos, child = 2 * pos + 1;
+			if (child < m_heap.size() && true == above(child, best)) best = child;
+			if (child + 1 < m_heap.size() && true == above(child + 1, best)) best = child + 1;
+			if (best == pos) break;
+			exchange(pos, best);
+			pos = best;
+			depth++;
+		}
+		stats::sift(depth);
+	}
+
+public:
+	///@brief Constructor for the ids 0..n-1, all of them out of the heap
+	explicit indexedHeap(size_t n = 0) : m_keys(n),m_position(n, absent()){}
+
+	///@brief Member function to empty the heap and allow the ids 0..n-1
+	void reset(size_t n)
+	{
+		m_heap.clear();
+		m_keys.assign(n, keyType());
+		m_position.assign(n, absent());
+	}
+
+	///@brief Member function to empty the heap, in time proportional to the ids it holds
+	void clear()
+	{
+		for (size_t i = 0; i < m_heap.size(); i++) m_position[m_heap[i]] = absent();
+		m_heap.clear();
+	}
+
+	///@brief Member function to get the number of ids in the heap
+	size_t getSize() const {return m_heap.size();}
+
+	///@brief Member function to tell if the heap is empty
+	bool empty() const {return m_heap.empty();}
+
+	///@brief Member function to tell if an id is in the heap
+	bool contains(size_t id) const {return absent() != m_position[id];}
+
+	///@brief Member function to get the key of an id, which is only meaningful while it is in the heap
+	keyType key(size_t id) const {return m_keys[id];}
+
+	///@brief Member function to get the id at the top, the heap must not be empty
+	size_t top() const {return m_heap[0];}
+
+	///@brief Member function to get the key of the id at the top, the heap must not be empty
+	keyType topKey() const {return m_keys[m_heap[0]];}
+
+	/**
+	 * @brief Member function to insert an id with its key
+	 * @return false if the id is already in the heap, which is then left unchanged
+	 */
+	bool insert(size_t id, keyType k)
+	{
+		if (true == contains(id)) return false;
+		stats::heapInsert();
+		m_keys[id] = k;
+		m_position[id] = m_heap.size();
+		m_heap.push_back(id);
+		siftUp(m_heap.size() - 1);
+		return true;
+	}
+
+	/**
+	 * @brief Member function to change the key of an id in the heap, to a better or a worse one
+	 * @return false if the id is not in the heap
+	 */
+	bool changeKey(size_t id, keyType k)
+	{
+		if (false == contains(id)) return false;
+		keyType old = m_keys[id];
+		m_keys[id] = k;
+		if (true == traits::lt(k, old)) siftUp(m_position[id]);
+		else siftDown(m_position[id]);
+		return true;
+	}
+
+	///@brief Member function to insert an id, or change its key if it is already in the heap
+	void push(size_t id, keyType k)
+	{
+		if (false == insert(id, k)) changeKey(id, k);
+	}
+
+	/**
+	 * @brief Member function to remove an id from the heap
+	 * @return false if the id is not in the heap
+	 */
+	bool remove(size_t id)
+	{
+		if (false == contains(id)) return false;
+		size_t pos = m_position[id];
+		exchange(pos, m_heap.size() - 1);
+		m_heap.pop_back();
+		m_position[id] = absent();
+		if (pos < m_heap.size())
+		{
+			// The last id took the place of the removed one and may need to go either way
+			size_t moved = m_heap[pos];
+			siftUp(pos);
+			siftDown(m_position[moved]);
+		}
+		return true;
+	}
+
+	///@brief Member function to remove the id at the top and return it, the heap must not be empty
+	size_t extractTop()
+	{
+		stats::heapExtract();
+		size_t retVal = m_heap[0];
+		exchange(0, m_heap.size() - 1);
+		m_heap.pop_back();
+		m_position[retVal] = absent();
+		if (false == m_heap.empty()) siftDown(0);
+		return retVal;
+	}
+};
+
+#endif /* UTILS_HEAP_INCLUDE_INDEXEDHEAP_HPP_ */
@@ -0,0 +1,121 @@
+/**
+ *  @file MultiQueue.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the MultiQueue, a relaxed priority queue shared by many threads.
+ */
+#ifndef UTILS_HEAP_INCLUDE_MULTIQUEUE_HPP_
+#define UTILS_HEAP_INCLUDE_MULTIQUEUE_HPP_
+
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <stdint.h>
+#include "heap.hpp"
+
+/**
+ * @brief #multiQueue provides a relaxed priority queue for concurrent inserts and extracts
+ * @tparam T 		Type of nodes to be kept in the queue.
+ * @tparam traits 	Traits of nodes which is to kept in the queue, #basic_heap_min_traits or #basic_heap_max_traits.
+ * @tparam stats	Stats policy of the internal heaps. The policies count in plain statics, so only #noStats gives exact results
+ * when several threads use the queue.
+ * @details The queue is made of c*p binary #heap, each behind its own lock, for p threads and a relaxation factor c. #insert puts
+ * the node into a random heap. #tryExtractTop locks two random heaps and takes the better of their tops. Locks are only ever tried,
+ * a thread finding one taken picks other heaps, so threads rarely wait on each other. The extracted node is not always the top
+ * of the whole queue but it is among the best O(c*p) in expectation, and a larger c trades more of this rank error for less
+ * contention.
+ */
+template <class T, class traits = basic_heap_min_traits<T>, class stats = noStats >
+class multiQueue
+{
+	///@brief One of the internal heaps with its lock, padded so that two locks never share a cache line
+	struct subQueue
+	{
+		std::mutex lock;	///< Member to hold the lock of the heap
+		heap<T,traits,stats> h;	///< Member to hold the heap
+		char padding[64];	///< Padding to keep the next lock off this cache line
+	};
+	std::vector<subQueue> m_queues;	///< Member to hold the internal heaps
+	std::atomic<size_t> m_size;	///< Member to hold the number of nodes over all the heaps
+
+	multiQueue(const multiQueue&);	///< Queues own their locks and are not copied
+	multiQueue& operator= (const multiQueue&);	///< Queues own their locks and are not copied
+
+	///@brief Member function to get a random number in 0..n-1 from a generator private to the calling thread
+	static size_t pick(size_t n)
+	{
+		static thread_local uint64_t state = 0;
+		if (0 == state) state = uint64_t(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return size_t(state >> 16) % n;
+	}
+
+public:
+	/**
+	 * @brief Constructor to create the internal heaps
+	 * @param	noOfThreads		Number of threads expected to use the queue
+	 * @param	relaxation		Number of heaps per thread, the c of the c*p heaps. At least two heaps are created in total.
+	 */
+	explicit multiQueue(size_t noOfThreads, size_t relaxation = 2) : m_queues(std::max(size_t(2), noOfThreads * relaxation)),m_size(0){}
+
+	///@brief Member function to get the number of internal heaps
+	size_t numQueues() const {return m_queues.size();}
+
+	///@brief Member function to get the number of nodes, exact only while no other thread uses the queue
+	size_t getSize() const {return m_size.load();}
+
+	///@brief Member function to insert a node into a random internal heap
+	void insert(T node)
+	{
+		for (;;)
+		{
+			subQueue& q = m_queues[pick(m_queues.size())];
+			if (false == q.lock.try_lock()) continue;
+			q.h.insert(node);
+			m_size.fetch_add(1);
+			q.lock.unlock();
+			return;
+		}
+	}
+
+	/**
+	 * @brief Member function to extract the better of the tops of two random internal heaps
+	 * @param	node	Output, the extracted node
+	 * @return false if the queue was seen empty, in which case node is untouched
+	 */
+	bool tryExtractTop(T& node)
+	{
+		while (0 != m_size.load())
+		{
+			size_t i = pick(m_queues.size()), j = pick(m_queues.size() - 1);
+			if (j >= i) j++;
+			subQueue& a = m_queues[i];
+			subQueue& b = m_queues[j];
+			if (false == a.lock.try_lock()) continue;
+			if (false == b.lock.try_lock())
+			{
+				a.lock.unlock();
+				continue;
+			}
+			subQueue* best = NULL;
+			if (0 != a.h.getSize()) best = &a;
+			if (0 != b.h.getSize() && (NULL == best || true == traits::lt(b.h.top(), a.h.top()))) best = &b;
+			if (NULL != best)
+			{
+				node = best->h.extractTop();
+				m_size.fetch_sub(1);
+			}
+			b.lock.unlock();
+			a.lock.unlock();
+			if (NULL != best) return true;
+		}
+		return false;
+	}
+};
+
+#endif /* UTILS_HEAP_INCLUDE_MULTIQUEUE_HPP_ */
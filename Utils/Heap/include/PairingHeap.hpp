@@ -0,0 +1,163 @@
+/**
+ *  @file PairingHeap.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains implementation of the pairing heap, a meldable heap with handles.
+ */
+#ifndef UTILS_HEAP_INCLUDE_PAIRINGHEAP_HPP_
+#define UTILS_HEAP_INCLUDE_PAIRINGHEAP_HPP_
+
+#include "heap.hpp"
+#include "HeapNodePool.hpp"
+
+/**
+ * @brief #pairingHeap provides a meldable heap with handles to its nodes
+ * @tparam T 		Type of nodes to be kept in heap.
+ * @tparam traits 	Traits of nodes which is to kept in heap, #basic_heap_min_traits or #basic_heap_max_traits.
+ * @tparam stats	Stats policy which records inserts, extracts and comparisons. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
+ * @details The heap is a single tree whose nodes keep their children in a list. #insert, #meld and #decreaseKey link two trees with
+ * one comparison, the loser becoming the first child of the winner. #extractTop combines the children of the old top in two passes,
+ * pairing them left to right and then linking the pairs right to left, which gives O(log n) amortized per extract. Nodes come from a
+ * #heapNodePool owned by the heap, and a #handle returned by #insert stays valid until its node is extracted.
+ */
+template <class T, class traits = basic_heap_min_traits<T>, class stats = defaultStatsPolicy >
+class pairingHeap
+{
+	///@brief Node of the heap
+	struct node
+	{
+		T value;	///< Member to hold the value of the node
+		node* child;	///< Member to hold the first child
+		node* next;	///< Member to hold the next sibling, or the next released node while in the pool
+		node* prev;	///< Member to hold the previous sibling, or the parent for the first child
+	};
+	node* m_root;	///< Member to hold the top of the heap
+	size_t m_size;	///< Member to hold the number of nodes in the heap
+	heapNodePool<node> m_pool;	///< Member to hold the nodes
+
+	pairingHeap(const pairingHeap&);	///< Heaps hand out pointers to their nodes and are not copied
+	pairingHeap& operator= (const pairingHeap&);	///< Heaps hand out pointers to their nodes and are not copied
+
+	///@brief Member function to link two trees, returning the root of the result
+	node* link(node* a, node* b)
+	{
+		stats::comparison();
+		if (true == traits::lt(b->value, a->value)) std::swap(a, b);
+		b->prev = a;
+		b->next = a->child;
+		if (NULL != a->child) a->child->prev = b;
+		a->child = b;
+		return a;
+	}
+
+	///@brief Member function to combine a list of siblings into a single tree in two passes
+	node* combine(node* first)
+	{
+		if (NULL == first) return NULL;
+		node* pairs = NULL;
+		while (NULL != first)
+		{
+			node* a = first;
+			node* b = first->next;
+			if (NULL == b)
+			{
+				a->next = pairs;
+				pairs = a;
+				break;
+			}
+			first = b->next;
+			node* merged = link(a, b);
+			merged->next = pairs;
+			pairs = merged;
+		}
+		node* retVal = pairs;
+		for (pairs = pairs->next; NULL != pairs; )
+		{
+			node* n = pairs;
+			pairs = pairs->next;
+			retVal = link(retVal, n);
+		}
+		retVal->next = retVal->prev = NULL;
+		return retVal;
+	}
+
+public:
+	typedef node* handle;	///< Handle of a node, to be given to #decreaseKey
+
+	///@brief Constructor to initialize heap members.
+	pairingHeap() : m_root(NULL),m_size(0){}
+
+	///@brief Member function to get the current number of nodes
+	size_t getSize() const {return m_size;}
+
+	///@brief Member function to check whether the heap is empty
+	bool empty() const {return 0 == m_size;}
+
+	///@brief Member function to get the top element without removing it. The heap must not be empty.
+	T& top() {return m_root->value;}
+
+	///@brief Member function to get the value of a node
+	static const T& value(handle h) {return h->value;}
+
+	///@brief Member function to insert a node into the heap, returning its handle
+	handle insert(T value)
+	{
+		stats::heapInsert();
+		node* n = m_pool.allocate();
+		n->value = value;
+		n->child = n->next = n->prev = NULL;
+		m_root = (NULL == m_root) ? n : link(m_root, n);
+		m_size++;
+		return n;
+	}
+
+	///@brief Member function to extract the top element from the heap. Largest in case of max and smallest in case of min.
+	T extractTop()
+	{
+		stats::heapExtract();
+		node* top = m_root;
+		T retVal = top->value;
+		m_root = combine(top->child);
+		m_pool.release(top);
+		m_size--;
+		return retVal;
+	}
+
+	/**
+	 * @brief Member function to move a node towards the top by giving it a new value
+	 * @param	h		Handle of the node, still in the heap
+	 * @param	value	The new value, which must not be further from the top than the current one
+	 * @return false if the new value is further from the top, in which case nothing is changed
+	 */
+	bool decreaseKey(handle h, T value)
+	{
+		stats::comparison();
+		if (true == traits::lt(h->value, value)) return false;
+		h->value = value;
+		if (h == m_root) return true;
+		if (h->prev->child == h) h->prev->child = h->next;
+		else h->prev->next = h->next;
+		if (NULL != h->next) h->next->prev = h->prev;
+		h->next = h->prev = NULL;
+		m_root = link(m_root, h);
+		return true;
+	}
+
+	/**
+	 * @brief Member function to move all the nodes of another heap into this one
+	 * @details The handles of the nodes of other stay valid and now belong to this heap. other is left empty.
+	 */
+	void meld(pairingHeap& other)
+	{
+		if (&other == this || NULL == other.m_root) return;
+		m_root = (NULL == m_root) ? other.m_root : link(m_root, other.m_root);
+		m_size += other.m_size;
+		m_pool.splice(other.m_pool);
+		other.m_root = NULL;
+		other.m_size = 0;
+	}
+};
+
+#endif /* UTILS_HEAP_INCLUDE_PAIRINGHEAP_HPP_ */
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <vector>
 #include <type_traits>
+#include "OpStats.hpp"
 using namespace std;
 
 /**
@@ -254,10 +255,12 @@ public:
  * @brief [General Template]: #heap provides a data structure for efficient extractTop queries
  * @tparam T 		Type of nodes to be kept in heap.
  * @tparam traits 	Traits of nodes which is to kept in heap. Traits provide comparator functions.
+ * @tparam stats	Stats policy which records comparisons, swaps and sift depths. #noStats or #countingStats, selected by
+ * ALGOPP_STATS when not given.
  * @details  * @b Specializations @b available: @n
- * #heap< T* , traits >	// Pointer types @n
+ * #heap< T* , traits, stats >	// Pointer types @n
  */
-template <class T, class traits = basic_heap_traits<T> >
+template <class T, class traits = basic_heap_traits<T>, class stats = defaultStatsPolicy >
 class heap
 {
 	vector<T> m_heap;		///< Member to hold all the nodes in the heap
@@ -272,6 +275,9 @@ public:
 	///@brief Member function to extract the top element from the heap. Largest in case of max and smallest in case of min.
 	T extractTop();
 
+	///@brief Member function to get the top element without removing it. The heap must not be empty.
+	T& top() {return m_heap[0];}
+
 	///@brief Member function to decompile the contents of the heap.
 	void decompile();
 
@@ -288,37 +294,43 @@ public:
  *
  * @return Nothing
  */
-template <class T, class traits>
-void heap<T,traits>::insert(T node)
+template <class T, class traits, class stats>
+void heap<T,traits,stats>::insert(T node)
 {
-	size_t parent,child;
+	size_t parent,child,depth = 0;
 	T tempNode;
+	stats::heapInsert();
 	m_heap.push_back(node);
 	m_size++;
 	child = m_size;
 	parent = (child)/2;
-	while((parent >=1) && (false == traits::lt(m_heap[parent-1],m_heap[child-1])))
+	while(parent >=1)
 	{
+		stats::comparison();
+		if (true == traits::lt(m_heap[parent-1],m_heap[child-1])) break;
 		tempNode = m_heap[child-1];
 		m_heap[child-1] = m_heap[parent-1];
 		m_heap[parent-1] = tempNode;
+		stats::swap();
+		depth++;
 		child = parent;
 		parent = parent/2;
 	}
+	stats::sift(depth);
 }
 
 /**
  * @details The function extracts the top most node from the heap. The top most element is swapped with the last element of the vector.
  * Then the last element is erased which breaks the heap property. To restore the heap property, the top most element is bubbled down to
- * its correct place in the heap. This node would have two children at position 2*P and 2*P + 1. The one which is smaller of the two would be
- * swapped with the parent node. This loop would break when the smallest of the two children is greater than the parent, which means that the
+ * its correct place in the heap. This node would have two children at position 2*P and 2*P + 1, or only the first one at the end of
+ * the heap. The one which is smaller of the two would be swapped with the parent node. This loop would break when the smallest of the two children is greater than the parent, which means that the
  * heap property is restored. The parent is smaller than both the children.
  *
  * @retval "Smallest Node" in case of min-heap
  * @retval "Largest Node" in case of max-heap
  */
-template <class T, class traits>
-T heap<T,traits>::extractTop(void)
+template <class T, class traits, class stats>
+T heap<T,traits,stats>::extractTop(void)
 {
 	T retVal = m_heap[0],tempNode;
 	tempNode = m_heap[0];
@@ -328,21 +340,32 @@ T heap<T,traits>::extractTop(void)
 	itr = itr + m_size -1;
 	m_heap.erase(itr);
 	m_size--;
-	int parent = 1;
-	int child = parent;
-	while(2*parent < m_size)
+	stats::heapExtract();
+	size_t parent = 1;
+	size_t child = parent;
+	size_t depth = 0;
+	while(2*parent <= m_size)
 	{
-		child = (true == traits::lte(m_heap[(2*parent)-1],m_heap[(2*parent)])) ? 2*parent : 2*parent + 1;
+		child = 2*parent;
+		if (child < m_size)
+		{
+			stats::comparison();
+			if (false == traits::lte(m_heap[child-1],m_heap[child])) child++;
+		}
+		stats::comparison();
 		if(false == traits::lt(m_heap[parent-1],m_heap[child-1]))
 		{
 			tempNode = m_heap[child -1];
 			m_heap[child - 1] = m_heap[parent - 1];
 			m_heap[parent - 1] = tempNode;
+			stats::swap();
+			depth++;
 			parent = child;
 		}
 		else
 			break;
 	}
+	stats::sift(depth);
 	return retVal;
 }
 
@@ -350,8 +373,8 @@ T heap<T,traits>::extractTop(void)
  * @details Decompile member function for the heap which prints out the vector serially.
  * @returns Nothing
  */
-template <class T, class traits>
-void heap<T,traits>::decompile()
+template <class T, class traits, class stats>
+void heap<T,traits,stats>::decompile()
 {
 	for(typename vector<T>::iterator itr = m_heap.begin(); itr != m_heap.end() ;itr++) cout<< *itr <<" ";
 	cout<<endl;
@@ -361,9 +384,10 @@ void heap<T,traits>::decompile()
  * @brief [Partial specialization]: #heap provides a data structure for efficient extractTop queries
  * @tparam T 		Pointer type of nodes to be kept in heap.
  * @tparam traits 	Traits of nodes which is to kept in heap. Traits provide comparator functions.
+ * @tparam stats	Stats policy which records comparisons, swaps and sift depths.
  */
-template <class T, class traits>
-class heap<T*,traits>
+template <class T, class traits, class stats>
+class heap<T*,traits,stats>
 {
 	vector<T*> m_heap;		///< Member to hold all the nodes in the heap
 	size_t m_size;			///< Member to hold the size of m_heap
@@ -377,6 +401,9 @@ public:
 	///@brief Member function to extract the top element from the heap. Largest in case of max and smallest in case of min.
 	T* extractTop();
 
+	///@brief Member function to get the top element without removing it. The heap must not be empty.
+	T*& top() {return m_heap[0];}
+
 	///@brief Member function to decompile the contents of the heap.
 	void decompile();
 
@@ -393,37 +420,43 @@ public:
  *
  * @return Nothing
  */
-template <class T, class traits>
-void heap<T*,traits>::insert(T* node)
+template <class T, class traits, class stats>
+void heap<T*,traits,stats>::insert(T* node)
 {
-	size_t parent,child;
+	size_t parent,child,depth = 0;
 	T* tempNode;
+	stats::heapInsert();
 	m_heap.push_back(node);
 	m_size++;
 	child = m_size;
 	parent = (child)/2;
-	while((parent >=1) && (false == traits::lt(m_heap[parent-1],m_heap[child-1])))
+	while(parent >=1)
 	{
+		stats::comparison();
+		if (true == traits::lt(m_heap[parent-1],m_heap[child-1])) break;
 		tempNode = m_heap[child-1];
 		m_heap[child-1] = m_heap[parent-1];
 		m_heap[parent-1] = tempNode;
+		stats::swap();
+		depth++;
 		child = parent;
 		parent = parent/2;
 	}
+	stats::sift(depth);
 }
 
 /**
  * @details The function extracts the top most node from the heap. The top most element is swapped with the last element of the vector.
  * Then the last element is erased which breaks the heap property. To restore the heap property, the top most element is bubbled down to
- * its correct place in the heap. This node would have two children at position 2*P and 2*P + 1. The one which is smaller of the two would be
- * swapped with the parent node. This loop would break when the smallest of the two children is greater than the parent, which means that the
+ * its correct place in the heap. This node would have two children at position 2*P and 2*P + 1, or only the first one at the end of
+ * the heap. The one which is smaller of the two would be swapped with the parent node. This loop would break when the smallest of the two children is greater than the parent, which means that the
  * heap property is restored. The parent is smaller than both the children.
  *
  * @retval "Smallest Node" in case of min-heap
  * @retval "Largest Node" in case of max-heap
  */
-template <class T, class traits>
-T* heap<T*,traits>::extractTop(void)
+template <class T, class traits, class stats>
+T* heap<T*,traits,stats>::extractTop(void)
 {
 	T* retVal = m_heap[0],*tempNode;
 	tempNode = m_heap[0];
@@ -433,21 +466,32 @@ T* heap<T*,traits>::extractTop(void)
 	itr = itr + m_size -1;
 	m_heap.erase(itr);
 	m_size--;
-	int parent = 1;
-	int child = parent;
-	while(2*parent < m_size)
+	stats::heapExtract();
+	size_t parent = 1;
+	size_t child = parent;
+	size_t depth = 0;
+	while(2*parent <= m_size)
 	{
-		child = (true == traits::lte(m_heap[(2*parent)-1],m_heap[(2*parent)])) ? 2*parent : 2*parent + 1;
+		child = 2*parent;
+		if (child < m_size)
+		{
+			stats::comparison();
+			if (false == traits::lte(m_heap[child-1],m_heap[child])) child++;
+		}
+		stats::comparison();
 		if(false == traits::lt(m_heap[parent-1],m_heap[child-1]))
 		{
 			tempNode = m_heap[child -1];
 			m_heap[child - 1] = m_heap[parent - 1];
 			m_heap[parent - 1] = tempNode;
+			stats::swap();
+			depth++;
 			parent = child;
 		}
 		else
 			break;
 	}
+	stats::sift(depth);
 	return retVal;
 }
 
@@ -455,8 +499,8 @@ T* heap<T*,traits>::extractTop(void)
  * @details Decompile member function for the heap which prints out the vector serially.
  * @returns Nothing
  */
-template <class T, class traits>
-void heap<T*,traits>::decompile()
+template <class T, class traits, class stats>
+void heap<T*,traits,stats>::decompile()
 {
 	for(typename vector<T*>::iterator itr = m_heap.begin(); itr != m_heap.end() ;itr++) cout<< *(*itr) <<" ";
 	cout<<endl;
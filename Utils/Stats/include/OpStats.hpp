@@ -0,0 +1,159 @@
+/**
+ * @file OpStats.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the operation counting policies used by #heap, #UnionFind and the #graph traversals.
+ *  The counting is selected at compile time. When ALGOPP_STATS is not defined, #defaultStatsPolicy is #noStats whose member
+ *  functions are empty inline functions, so the instrumented code compiles to exactly what it was without them.
+ */
+
+#ifndef UTILS_STATS_INCLUDE_OPSTATS_HPP_
+#define UTILS_STATS_INCLUDE_OPSTATS_HPP_
+
+#include <iostream>
+#include <cstddef>
+
+using namespace std;
+
+/**
+ * @brief Snapshot of all the operation counters.
+ * @details The snapshot is a plain struct so that it can be copied, stored and subtracted from a later snapshot to get the cost
+ * of a single phase of an application.
+ */
+struct opStatsSnapshot
+{
+	size_t heapInserts;			///< Number of #heap::insert calls
+	size_t heapExtracts;		///< Number of #heap::extractTop calls
+	size_t comparisons;			///< Number of comparator calls made by the heap traits
+	size_t swaps;				///< Number of element swaps made while sifting
+	size_t siftDepth;			///< Total number of levels moved by all sift up / sift down operations
+	size_t maxSiftDepth;		///< Largest number of levels moved by a single sift operation
+	size_t finds;				///< Number of #UnionFind::Find calls
+	size_t findPathLength;		///< Total number of links walked by Find before path compression
+	size_t maxFindPathLength;	///< Longest path walked by a single Find before path compression
+	size_t unions;				///< Number of #UnionFind::Union merges
+	size_t followerCopies;		///< Total number of followers copied from the smaller cluster into the leader's follower set
+	size_t edgeVisits;			///< Number of edges looked at by graph traversals
+
+	///@brief Default constructor, all counters start at zero
+	opStatsSnapshot() : heapInserts(0),heapExtracts(0),comparisons(0),swaps(0),siftDepth(0),maxSiftDepth(0),finds(0),
+			findPathLength(0),maxFindPathLength(0),unions(0),followerCopies(0),edgeVisits(0){}
+
+	/**
+	 * @brief Operator- to get the counters of the operations done between two snapshots
+	 * @param	that	The earlier snapshot
+	 * @details Maximum counters can not be subtracted, the ones of this snapshot are kept.
+	 * @return Snapshot with the difference of the counters
+	 */
+	opStatsSnapshot operator- (const opStatsSnapshot& that) const
+	{
+		opStatsSnapshot retVal(*this);
+		retVal.heapInserts -= that.heapInserts;
+		retVal.heapExtracts -= that.heapExtracts;
+		retVal.comparisons -= that.comparisons;
+		retVal.swaps -= that.swaps;
+		retVal.siftDepth -= that.siftDepth;
+		retVal.finds -= that.finds;
+		retVal.findPathLength -= that.findPathLength;
+		retVal.unions -= that.unions;
+		retVal.followerCopies -= that.followerCopies;
+		retVal.edgeVisits -= that.edgeVisits;
+		return retVal;
+	}
+
+	/**
+	 * @brief Decompilation support for the snapshot
+	 * @param	out	ostream variable in which the output is piped.
+	 * @param	s	The snapshot to be decompiled
+	 * @details Along with the raw counters the per operation averages which are used for capacity planning are printed.
+	 * @return Reference to out input argument with filled decompilation data of the input object
+	 */
+	friend ostream& operator<< (ostream& out, const opStatsSnapshot& s)
+	{
+		size_t heapOps = s.heapInserts + s.heapExtracts;
+		out << "Heap      : inserts " << s.heapInserts << " extracts " << s.heapExtracts << " comparisons " << s.comparisons
+			<< " swaps " << s.swaps << " sift depth " << s.siftDepth << " (max " << s.maxSiftDepth << ")" << endl;
+		if (0 != heapOps) out << "            comparisons/op " << double(s.comparisons)/heapOps << " sift depth/op "
+			<< double(s.siftDepth)/heapOps << endl;
+		out << "UnionFind : finds " << s.finds << " path length " << s.findPathLength << " (max " << s.maxFindPathLength << ")"
+			<< " unions " << s.unions << " follower copies " << s.followerCopies << endl;
+		if (0 != s.finds) out << "            path length/find " << double(s.findPathLength)/s.finds << endl;
+		out << "Graph     : edge visits " << s.edgeVisits << endl;
+		return out;
+	}
+};
+
+/**
+ * @brief Stats policy which counts nothing.
+ * @details All the member functions are empty and get inlined away. This is the policy used unless ALGOPP_STATS is defined.
+ */
+class noStats
+{
+public:
+	static const bool enabled = false;	///< Whether this policy records anything
+	static void heapInsert() {}	///< Records a heap insert
+	static void heapExtract() {}	///< Records a heap extractTop
+	static void comparison() {}	///< Records a single comparator call
+	static void swap() {}	///< Records a single element swap
+	static void sift(size_t) {}	///< Records the levels moved by one sift operation
+	static void find(size_t) {}	///< Records the path length walked by one Find
+	static void unionMerge(size_t) {}	///< Records one Union and the number of followers copied by it
+	static void edgeVisit(size_t = 1) {}	///< Records edges looked at by a traversal
+	///@brief Member function to get the current counters, always zero for this policy
+	static opStatsSnapshot snapshot() { return opStatsSnapshot(); }
+	///@brief Member function to reset the counters
+	static void reset() {}
+};
+
+/**
+ * @brief Stats policy which counts every operation in a process wide #opStatsSnapshot.
+ * @details The counters are plain integers, so concurrent users of the instrumented data structures will get approximate numbers.
+ */
+class countingStats
+{
+	///@brief Member function to provide the process wide counters
+	static opStatsSnapshot& counters()
+	{
+		static opStatsSnapshot c;
+		return c;
+	}
+public:
+	static const bool enabled = true;	///< @copybrief noStats::enabled
+	static void heapInsert() { counters().heapInserts++; }	///< @copybrief noStats::heapInsert
+	static void heapExtract() { counters().heapExtracts++; }	///< @copybrief noStats::heapExtract
+	static void comparison() { counters().comparisons++; }	///< @copybrief noStats::comparison
+	static void swap() { counters().swaps++; }	///< @copybrief noStats::swap
+	///@copybrief noStats::sift
+	static void sift(size_t depth)
+	{
+		counters().siftDepth += depth;
+		if (depth > counters().maxSiftDepth) counters().maxSiftDepth = depth;
+	}
+	///@copybrief noStats::find
+	static void find(size_t pathLength)
+	{
+		counters().finds++;
+		counters().findPathLength += pathLength;
+		if (pathLength > counters().maxFindPathLength) counters().maxFindPathLength = pathLength;
+	}
+	///@copybrief noStats::unionMerge
+	static void unionMerge(size_t followersCopied)
+	{
+		counters().unions++;
+		counters().followerCopies += followersCopied;
+	}
+	static void edgeVisit(size_t n = 1) { counters().edgeVisits += n; }	///< @copybrief noStats::edgeVisit
+	///@brief Member function to get a copy of the current counters
+	static opStatsSnapshot snapshot() { return counters(); }
+	///@brief Member function to reset all the counters to zero
+	static void reset() { counters() = opStatsSnapshot(); }
+};
+
+#ifdef ALGOPP_STATS
+typedef countingStats defaultStatsPolicy;	///< Stats policy used by default, selected by the ALGOPP_STATS compile flag
+#else
+typedef noStats defaultStatsPolicy;	///< Stats policy used by default, selected by the ALGOPP_STATS compile flag
+#endif
+
+#endif /* UTILS_STATS_INCLUDE_OPSTATS_HPP_ */
@@ -0,0 +1,155 @@
+/**
+ * @file DynamicConnectivity.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains the offline dynamic connectivity solver built on #rollbackUnionFind.
+ */
+
+#ifndef UTILS_UNIONFIND_INCLUDE_DYNAMICCONNECTIVITY_HPP_
+#define UTILS_UNIONFIND_INCLUDE_DYNAMICCONNECTIVITY_HPP_
+
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include "RollbackUnionFind.hpp"
+
+/**
+ * @brief Offline connectivity queries interleaved with edge insertions and deletions
+ * @tparam	stats	Stats policy of the #rollbackUnionFind used to answer the queries
+ * @details The operations are recorded first and answered together by #solve. Every operation takes one time step, and every
+ * copy of an edge is alive over the interval of time steps from its insertion to its deletion. The intervals are put in a segment
+ * tree over time, where each lands in O(log T) nodes. A depth first walk of the tree unites the edges of a node on entry and rolls
+ * them back on exit, so at a leaf the union-find holds exactly the edges alive at that time step. With union by rank every find
+ * costs O(log n), giving O((E + Q) log T log n) in total.
+ */
+template <typename stats = defaultStatsPolicy>
+class offlineDynamicConnectivity
+{
+	typedef std::pair<size_t,size_t> edgeKey;	///< Type of an undirected edge, smaller end first
+	///@brief Time steps over which a copy of an edge is alive
+	struct liveInterval
+	{
+		size_t begin;	///< Member to hold the first time step
+		size_t end;	///< Member to hold the time step past the last one
+		edgeKey e;	///< Member to hold the edge
+	};
+	size_t m_vertices;	///< Member to hold the number of vertices
+	size_t m_time;	///< Member to hold the number of operations recorded so far
+	std::map<edgeKey, std::vector<size_t> > m_open;	///< Member to hold the insertion times of the alive copies of every edge
+	std::vector<liveInterval> m_intervals;	///< Member to hold the intervals of the deleted copies
+	std::vector<edgeKey> m_queries;	///< Member to hold the vertices of every query
+	std::vector<size_t> m_queryAt;	///< Member to hold the query asked at every time step, #noQuery for other operations
+
+	///@brief Member function to get the value of #m_queryAt for time steps which are not queries
+	static size_t noQuery() {return size_t(-1);}
+
+	///@brief Member function to get the key of the edge u-v
+	static edgeKey key(size_t u, size_t v) {return (u < v) ? edgeKey(u, v) : edgeKey(v, u);}
+
+	///@brief Member function to add an interval to the nodes of the segment tree covering it
+	static void insert(std::vector<std::vector<edgeKey> >& tree, size_t node, size_t lo, size_t hi, const liveInterval& i)
+	{
+		if (i.end <= lo || hi <= i.begin) return;
+		if (i.begin <= lo && hi <= i.end)
+		{
+			tree[node].push_back(i.e);
+			return;
+		}
+		size_t mid = (lo + hi) / 2;
+		insert(tree, 2 * node, lo, mid, i);
+		insert(tree, 2 * node + 1, mid, hi, i);
+	}
+
+	///@brief Member function to walk the segment tree, answering the queries at its leaves
+	void walk(const std::vector<std::vector<edgeKey> >& tree, const std::vector<size_t>& queriesBefore, size_t node, size_t lo,
+			size_t hi, rollbackUnionFind<stats>& uf, std::vector<bool>& answers) const
+	{
+		if (queriesBefore[hi] == queriesBefore[lo]) return;
+		size_t checkpoint = uf.checkpoint();
+		for (size_t i = 0; i < tree[node].size(); i++) uf.unite(tree[node][i].first, tree[node][i].second);
+		if (hi - lo == 1)
+		{
+			size_t q = m_queryAt[lo];
+			answers[q] = uf.connected(m_queries[q].first, m_queries[q].second);
+		}
+		else
+		{
+			size_t mid = (lo + hi) / 2;
+			walk(tree, queriesBefore, 2 * node, lo, mid, uf, answers);
+			walk(tree, queriesBefore, 2 * node + 1, mid, hi, uf, answers);
+		}
+		uf.rollback(checkpoint);
+	}
+
+public:
+	/**
+	 * @brief Single argument constructor
+	 * @param	n	Number of vertices, 0..n-1, starting without edges
+	 */
+	explicit offlineDynamicConnectivity(size_t n) : m_vertices(n),m_time(0){}
+
+	///@brief Member function to record the insertion of the undirected edge u-v. Parallel edges are kept as separate copies.
+	void addEdge(size_t u, size_t v)
+	{
+		m_open[key(u, v)].push_back(m_time++);
+		m_queryAt.push_back(noQuery());
+	}
+
+	/**
+	 * @brief Member function to record the deletion of the undirected edge u-v
+	 * @return false if no copy of the edge is alive, in which case nothing is recorded
+	 */
+	bool removeEdge(size_t u, size_t v)
+	{
+		typename std::map<edgeKey, std::vector<size_t> >::iterator e = m_open.find(key(u, v));
+		if (e == m_open.end()) return false;
+		liveInterval i = {e->second.back(), m_time++, e->first};
+		m_intervals.push_back(i);
+		e->second.pop_back();
+		if (e->second.empty()) m_open.erase(e);
+		m_queryAt.push_back(noQuery());
+		return true;
+	}
+
+	/**
+	 * @brief Member function to record the query whether u and v are connected at this point
+	 * @return The position of the answer in the result of #solve
+	 */
+	size_t query(size_t u, size_t v)
+	{
+		m_queryAt.push_back(m_queries.size());
+		m_queries.push_back(edgeKey(u, v));
+		m_time++;
+		return m_queries.size() - 1;
+	}
+
+	///@brief Member function to get the number of queries recorded
+	size_t numQueries() const {return m_queries.size();}
+
+	/**
+	 * @brief Member function to answer all the recorded queries
+	 * @return For every query, in the order they were recorded, whether its vertices were connected
+	 */
+	std::vector<bool> solve() const
+	{
+		std::vector<bool> retVal(m_queries.size());
+		if (m_queries.empty()) return retVal;
+		std::vector<std::vector<edgeKey> > tree(4 * m_time);
+		for (size_t i = 0; i < m_intervals.size(); i++) insert(tree, 1, 0, m_time, m_intervals[i]);
+		for (typename std::map<edgeKey, std::vector<size_t> >::const_iterator e = m_open.begin(); e != m_open.end(); e++)
+			for (size_t c = 0; c < e->second.size(); c++)
+			{
+				liveInterval i = {e->second[c], m_time, e->first};
+				insert(tree, 1, 0, m_time, i);
+			}
+		std::vector<size_t> queriesBefore(m_time + 1, 0);
+		for (size_t t = 0; t < m_time; t++) queriesBefore[t+1] = queriesBefore[t] + (noQuery() != m_queryAt[t]);
+		rollbackUnionFind<stats> uf(m_vertices);
+		walk(tree, queriesBefore, 1, 0, m_time, uf, retVal);
+		return retVal;
+	}
+};
+
+#endif /* UTILS_UNIONFIND_INCLUDE_DYNAMICCONNECTIVITY_HPP_ */
@@ -0,0 +1,124 @@
+/**
+ * @file PersistentUnionFind.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains a dense union-find which answers connectivity queries about any earlier point in time.
+ */
+
+#ifndef UTILS_UNIONFIND_INCLUDE_PERSISTENTUNIONFIND_HPP_
+#define UTILS_UNIONFIND_INCLUDE_PERSISTENTUNIONFIND_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+#include "OpStats.hpp"
+
+/**
+ * @brief Partially persistent union-find over the elements 0..n-1
+ * @tparam	stats	Stats policy which records find path lengths and merges. #noStats or #countingStats, selected by ALGOPP_STATS
+ * when not given.
+ * @details Unions are made with union by rank and without path compression, so parent links are never changed once set. Every
+ * link remembers the time it was set, and the links set after time t are simply not followed by #find(x,t). This answers
+ * "were u and v connected as of time t" for all the past times in O(log n), using O(n) memory in total instead of a copy per time.
+ * Times are given by the caller, e.g. batch numbers, and must not decrease from one #unite to the next.
+ */
+template <typename stats = defaultStatsPolicy>
+class persistentUnionFind
+{
+	std::vector<size_t> m_parent;	///< Member to hold the parent of every element, roots are their own parent
+	std::vector<size_t> m_linkTime;	///< Member to hold the time every element was linked to its parent, #never for roots
+	std::vector<uint8_t> m_rank;	///< Member to hold the rank of every root
+	std::vector<std::pair<size_t,size_t> > m_components;	///< Member to hold the number of sets after every time a union happened
+	size_t m_latest;	///< Member to hold the time of the latest union
+public:
+	///@brief Member function to get the time returned for elements which never got connected
+	static size_t never() {return size_t(-1);}
+
+	/**
+	 * @brief Single argument constructor
+	 * @param	n	Number of elements, each in its own set
+	 */
+	explicit persistentUnionFind(size_t n = 0) : m_parent(n),m_linkTime(n,never()),m_rank(n,0),m_components(1,std::make_pair(size_t(0),n)),m_latest(0)
+	{
+		for (size_t i = 0; i < n; i++) m_parent[i] = i;
+	}
+
+	///@brief Member function to get the number of elements
+	size_t size() const {return m_parent.size();}
+
+	///@brief Member function to get the root of the set of x as of time t, i.e. after all the unions made at times up to t
+	size_t find(size_t x, size_t t) const
+	{
+		size_t pathLength = 0;
+		for (; m_parent[x] != x && m_linkTime[x] <= t; pathLength++) x = m_parent[x];
+		stats::find(pathLength);
+		return x;
+	}
+
+	///@brief Member function to get the current root of the set of x
+	size_t find(size_t x) const {return find(x, never() - 1);}
+
+	///@brief Member function to check whether a and b were in the same set as of time t
+	bool connected(size_t a, size_t b, size_t t) const {return find(a, t) == find(b, t);}
+
+	/**
+	 * @brief Member function to get the first time at which a and b were in the same set
+	 * @details The two elements get connected by the latest link on their paths up to the first common ancestor.
+	 * @return The time, or #never if they are not connected now
+	 */
+	size_t connectedSince(size_t a, size_t b) const
+	{
+		if (a == b) return 0;
+		size_t retVal = 0;
+		while (a != b)
+		{
+			if (m_parent[a] == a && m_parent[b] == b) return never();
+			// Link times grow towards the root, as a parent was still a root when its child got linked
+			if (m_linkTime[a] <= m_linkTime[b])
+			{
+				retVal = std::max(retVal, m_linkTime[a]);
+				a = m_parent[a];
+			}
+			else
+			{
+				retVal = std::max(retVal, m_linkTime[b]);
+				b = m_parent[b];
+			}
+		}
+		return retVal;
+	}
+
+	///@brief Member function to get the number of sets as of time t
+	size_t components(size_t t) const
+	{
+		return (std::upper_bound(m_components.begin(), m_components.end(), std::make_pair(t, never())) - 1)->second;
+	}
+
+	/**
+	 * @brief Member function to merge the sets of a and b at time t
+	 * @param	a	Element of the first set
+	 * @param	b	Element of the second set
+	 * @param	t	Time of the union, not smaller than the time of the previous union. Smaller times are raised to it.
+	 * @return true if two different sets were merged
+	 */
+	bool unite(size_t a, size_t b, size_t t)
+	{
+		t = std::max(t, m_latest);
+		a = find(a);
+		b = find(b);
+		if (a == b) return false;
+		if (m_rank[a] > m_rank[b]) std::swap(a, b);
+		m_parent[a] = b;
+		m_linkTime[a] = t;
+		if (m_rank[a] == m_rank[b]) m_rank[b]++;
+		m_latest = t;
+		size_t remaining = m_components.back().second - 1;
+		if (m_components.back().first == t) m_components.back().second = remaining;
+		else m_components.push_back(std::make_pair(t, remaining));
+		stats::unionMerge(1);
+		return true;
+	}
+};
+
+#endif /* UTILS_UNIONFIND_INCLUDE_PERSISTENTUNIONFIND_HPP_ */
@@ -0,0 +1,112 @@
+/**
+ * @file RollbackUnionFind.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains a dense union-find whose unions can be undone in LIFO order.
+ */
+
+#ifndef UTILS_UNIONFIND_INCLUDE_ROLLBACKUNIONFIND_HPP_
+#define UTILS_UNIONFIND_INCLUDE_ROLLBACKUNIONFIND_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+#include "OpStats.hpp"
+
+/**
+ * @brief Union-find over the elements 0..n-1 with undo
+ * @tparam	stats	Stats policy which records find path lengths and merges. #noStats or #countingStats, selected by ALGOPP_STATS
+ * when not given.
+ * @details Union by rank without path compression, so a union changes at most two words which are kept on a history stack and
+ * #find walks at most log2(n) links. #checkpoint gives the current height of the stack and #rollback pops unions back to it.
+ */
+template <typename stats = defaultStatsPolicy>
+class rollbackUnionFind
+{
+	///@brief Record of one union, enough to undo it
+	struct unionRecord
+	{
+		size_t child;	///< Member to hold the root which was linked under another
+		bool rankIncreased;	///< Member to hold whether the rank of the new root was incremented
+	};
+	std::vector<size_t> m_parent;	///< Member to hold the parent of every element, roots are their own parent
+	std::vector<uint8_t> m_rank;	///< Member to hold the rank of every root
+	std::vector<unionRecord> m_history;	///< Member to hold the unions not rolled back yet
+	size_t m_components;	///< Member to hold the number of sets
+public:
+	/**
+	 * @brief Single argument constructor
+	 * @param	n	Number of elements, each in its own set
+	 */
+	explicit rollbackUnionFind(size_t n = 0) : m_parent(n),m_rank(n,0),m_components(n)
+	{
+		for (size_t i = 0; i < n; i++) m_parent[i] = i;
+	}
+
+	///@brief Member function to get the number of elements
+	size_t size() const {return m_parent.size();}
+
+	///@brief Member function to get the number of sets
+	size_t components() const {return m_components;}
+
+	///@brief Member function to get the root of the set of x
+	size_t find(size_t x) const
+	{
+		size_t pathLength = 0;
+		for (; m_parent[x] != x; pathLength++) x = m_parent[x];
+		stats::find(pathLength);
+		return x;
+	}
+
+	///@brief Member function to check whether a and b are in the same set
+	bool connected(size_t a, size_t b) const {return find(a) == find(b);}
+
+	/**
+	 * @brief Member function to merge the sets of a and b
+	 * @details A union of two elements already in the same set is recorded as well, so that every call is undone by one step of
+	 * #rollback.
+	 * @return true if two different sets were merged
+	 */
+	bool unite(size_t a, size_t b)
+	{
+		a = find(a);
+		b = find(b);
+		unionRecord r = {a, false};
+		if (a != b)
+		{
+			if (m_rank[a] > m_rank[b]) std::swap(a, b);
+			r.child = a;
+			r.rankIncreased = (m_rank[a] == m_rank[b]);
+			m_parent[a] = b;
+			if (r.rankIncreased) m_rank[b]++;
+			m_components--;
+			stats::unionMerge(1);
+		}
+		m_history.push_back(r);
+		return a != b;
+	}
+
+	///@brief Member function to get the current position in the history, to be given to #rollback
+	size_t checkpoint() const {return m_history.size();}
+
+	///@brief Member function to undo the unions made after the given #checkpoint, latest first
+	void rollback(size_t checkpoint)
+	{
+		while (m_history.size() > checkpoint)
+		{
+			unionRecord r = m_history.back();
+			m_history.pop_back();
+			size_t root = m_parent[r.child];
+			if (root == r.child) continue;
+			if (r.rankIncreased) m_rank[root]--;
+			m_parent[r.child] = r.child;
+			m_components++;
+		}
+	}
+
+	///@brief Member function to undo the latest union
+	void rollback() {if (false == m_history.empty()) rollback(m_history.size() - 1);}
+};
+
+#endif /* UTILS_UNIONFIND_INCLUDE_ROLLBACKUNIONFIND_HPP_ */
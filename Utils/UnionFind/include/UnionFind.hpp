@@ -10,25 +10,28 @@
 
 #include "GraphTraits.hpp"
 #include "UnionFindNode.hpp"
+#include "OpStats.hpp"
 
 
 /**
  * @brief [General Template]: #UnionFind data structure
  * @tparam	nodeProperties	The properties of the user defined node to be encapsulated in the #UnionFind data structure
  * @tparam	nodeContainer	To specify the type of storage which is to be used for the #UFNode. #graphTraits::listStorage or #graphTraits::vectorStorage@n
+ * @tparam	stats			Stats policy which records find path lengths, merges and follower copies. #noStats or #countingStats,
+ * selected by ALGOPP_STATS when not given.
  * @details
  * @b Specializations @b available: @n
- * #UnionFind<nodeProperties*,nodeContainer> @n
+ * #UnionFind<nodeProperties*,nodeContainer,stats> @n
  */
-template <typename nodeProperties, typename nodeContainer = graphTraits::listStorage>
+template <typename nodeProperties, typename nodeContainer = graphTraits::listStorage, typename stats = defaultStatsPolicy>
 class UnionFind{};
 
 /**
  * @brief [Partial Specialization]: #UnionFind which uses node of type pointers
  * @details @copydetails UnionFind
  */
-template <typename nodeProperties, typename nodeContainer>
-class UnionFind <nodeProperties*,nodeContainer>
+template <typename nodeProperties, typename nodeContainer, typename stats>
+class UnionFind <nodeProperties*,nodeContainer,stats>
 {
 	typedef UFNode<nodeProperties*,nodeContainer> nodeType;	///< Node type stored in UnionFind
 	typedef typename container_gen<nodeContainer,nodeType>::type nodeContainerType;	///< The type of container used to store nodes in UnionFind
@@ -81,6 +84,7 @@ public:
 			followerDesciptor itr = second->followers.begin();
 			for( ;itr!= second->followers.end(); itr++) first->followers.insert(followerListValueType(*itr));
 			first->followers.insert(followerListValueType(secondArg));
+			stats::unionMerge(second->followers.size() + 1);
 		}
 		else if(first->rank == second->rank)
 		{
@@ -89,6 +93,7 @@ public:
 			for( ; itr != second->followers.end(); itr++ )	first->followers.insert(followerListValueType(*itr));
 			first->followers.insert(followerListValueType(secondArg));
 			first->rank++;
+			stats::unionMerge(second->followers.size() + 1);
 		}
 		else
 		{
@@ -96,6 +101,7 @@ public:
 			followerDesciptor itr = first->followers.begin();
 			for(;itr!=first->followers.end();itr++) second->followers.insert(followerListValueType(*itr));
 			second->followers.insert(followerListValueType(firstArg));
+			stats::unionMerge(first->followers.size() + 1);
 		}
 	}
 
@@ -116,6 +122,7 @@ public:
 			listOfNodesToUpdate.push_back(startNode);
 			startNode = (*startNode)->leader;
 		}
+		stats::find(listOfNodesToUpdate.size());
 		nodeDescriptor* leader = (*startNode)->leader;
 		for(unsigned int i = 0; i < listOfNodesToUpdate.size();i++)	(*listOfNodesToUpdate[i])->leader = leader;
 		return startNode;
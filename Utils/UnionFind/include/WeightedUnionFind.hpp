@@ -0,0 +1,140 @@
+/**
+ * @file WeightedUnionFind.hpp
+ *
+ *  Created on: 19-Oct-2026
+ *  @author: Karan Talreja
+ *  @details This file contains a dense union-find which keeps the difference of potentials between the elements of a set.
+ */
+
+#ifndef UTILS_UNIONFIND_INCLUDE_WEIGHTEDUNIONFIND_HPP_
+#define UTILS_UNIONFIND_INCLUDE_WEIGHTEDUNIONFIND_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+#include "OpStats.hpp"
+
+/**
+ * @brief Union-find over the elements 0..n-1 checking constraints of the form x_u - x_v = w
+ * @tparam	weightType	Type of the potentials, an additive group such as int or long long. Floating point types work, but the
+ * consistency check compares for exact equality.
+ * @tparam	stats		Stats policy which records find path lengths and merges. #noStats or #countingStats, selected by ALGOPP_STATS
+ * when not given.
+ * @details Every element holds the difference of its potential to the one of its parent, in a flat array next to the parent and rank
+ * arrays. #find compresses the path in two passes without any allocation, rewriting every offset on the path to the offset to the
+ * root, so the usual near constant amortized cost of union by rank with path compression is kept.
+ */
+template <typename weightType = long long, typename stats = defaultStatsPolicy>
+class weightedUnionFind
+{
+	std::vector<size_t> m_parent;	///< Member to hold the parent of every element, roots are their own parent
+	std::vector<weightType> m_offset;	///< Member to hold x_i - x_parent of every element i, zero for roots
+	std::vector<uint8_t> m_rank;	///< Member to hold the rank of every root
+	size_t m_components;	///< Member to hold the number of sets
+public:
+	///@brief Outcome of a #unite
+	enum uniteResult
+	{
+		merged,		///< Two different sets were merged
+		consistent,	///< Both elements were already in the same set and the constraint holds
+		conflict	///< Both elements were already in the same set and the constraint contradicts the earlier ones
+	};
+
+	/**
+	 * @brief Single argument constructor
+	 * @param	n	Number of elements, each in its own set
+	 */
+	explicit weightedUnionFind(size_t n = 0) : m_parent(n),m_offset(n,weightType()),m_rank(n,0),m_components(n)
+	{
+		for (size_t i = 0; i < n; i++) m_parent[i] = i;
+	}
+
+	///@brief Member function to get the number of elements
+	size_t size() const {return m_parent.size();}
+
+	///@brief Member function to get the number of sets
+	size_t components() const {return m_components;}
+
+	/**
+	 * @brief Member function to get the root of the set of x, compressing the path
+	 * @param	x			The element
+	 * @param	potential	Output, x_x - x_root
+	 * @return The root
+	 */
+	size_t find(size_t x, weightType& potential)
+	{
+		size_t root = x, pathLength = 0;
+		potential = weightType();
+		for (; m_parent[root] != root; pathLength++)
+		{
+			potential += m_offset[root];
+			root = m_parent[root];
+		}
+		stats::find(pathLength);
+		weightType toRoot = potential;
+		while (m_parent[x] != root && m_parent[x] != x)
+		{
+			size_t next = m_parent[x];
+			weightType nextToRoot = toRoot - m_offset[x];
+			m_parent[x] = root;
+			m_offset[x] = toRoot;
+			x = next;
+			toRoot = nextToRoot;
+		}
+		return root;
+	}
+
+	///@brief Member function to get the root of the set of x, compressing the path
+	size_t find(size_t x)
+	{
+		weightType potential;
+		return find(x, potential);
+	}
+
+	///@brief Member function to check whether a and b are in the same set
+	bool connected(size_t a, size_t b) {return find(a) == find(b);}
+
+	/**
+	 * @brief Member function to get the difference of potentials implied by the constraints so far
+	 * @param	u		First element
+	 * @param	v		Second element
+	 * @param	retVal	Output, x_u - x_v. Left untouched when the elements are in different sets.
+	 * @return false if u and v are in different sets, so that the difference is not determined
+	 */
+	bool diff(size_t u, size_t v, weightType& retVal)
+	{
+		weightType pu, pv;
+		if (find(u, pu) != find(v, pv)) return false;
+		retVal = pu - pv;
+		return true;
+	}
+
+	/**
+	 * @brief Member function to add the constraint x_u - x_v = w
+	 * @param	u	First element
+	 * @param	v	Second element
+	 * @param	w	Difference of their potentials
+	 * @return #merged, #consistent, or #conflict in which case nothing is changed
+	 */
+	uniteResult unite(size_t u, size_t v, weightType w)
+	{
+		weightType pu, pv;
+		size_t ru = find(u, pu), rv = find(v, pv);
+		if (ru == rv) return (pu - pv == w) ? consistent : conflict;
+		// x_ru - x_rv follows from x_u - x_v = w with both written against their roots
+		weightType rootDiff = w - pu + pv;
+		if (m_rank[ru] > m_rank[rv])
+		{
+			std::swap(ru, rv);
+			rootDiff = -rootDiff;
+		}
+		m_parent[ru] = rv;
+		m_offset[ru] = rootDiff;
+		if (m_rank[ru] == m_rank[rv]) m_rank[rv]++;
+		m_components--;
+		stats::unionMerge(1);
+		return merged;
+	}
+};
+
+#endif /* UTILS_UNIONFIND_INCLUDE_WEIGHTEDUNIONFIND_HPP_ */